@@ -90,10 +90,14 @@
 
 /**
  * The ASCII buffer for receiving from the serial:
+ * Commands are packed back-to-back in BUFSIZE * MAX_CMD_SIZE bytes,
+ * so short lines (G1 X.. Y.. E..) leave room for many more commands.
+ * BUFSIZE_LINES is the maximum number of queued commands (default BUFSIZE * 4).
  * For Arduino DUE setting bufsize to 8.
  */
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
+//#define BUFSIZE_LINES 16
 
 /**
  * Transmission to Host Buffer Size
@@ -167,11 +171,28 @@
  */
 //#define EMERGENCY_PARSER
 
+/**
+ * Binary protocol
+ * Optional binary frames from the host, enabled with M880 S1 and reported
+ * by M115 as Cap:BINARY_PROTOCOL. G0-G3 travel as packed float records with
+ * CRC16 and sequence number, ASCII lines keep working between the frames.
+ * See src/feature/binary_protocol/binary_protocol.h and scripts/binary_gcode.py
+ * Requires GCODE_PRETOKENIZE.
+ */
+//#define BINARY_PROTOCOL
+
 /**
  * Spend 28 bytes of SRAM to optimize the GCode parser
  */
 //#define FASTER_GCODE_PARSER
 
+/**
+ * Decode the numeric parameters of G0-G3 once, when the line is queued.
+ * The values are kept after the line in the command buffer and read back
+ * by the handlers without converting the ASCII again.
+ */
+//#define GCODE_PRETOKENIZE
+
 /**
  * Spend more bytes of SRAM to optimize the GCode execute
  */
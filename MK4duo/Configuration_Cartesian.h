@@ -215,6 +215,8 @@
 
 // Z Probe repetitions, median for best result
 #define Z_PROBE_REPETITIONS 1
+// Stop the repetitions once two consecutive readings agree within this distance (mm)
+//#define Z_PROBE_REPETITIONS_TOLERANCE 0.005
 
 // Enable Z Probe Repeatability test to see how accurate your probe is
 //#define PROBE_REPEATABILITY_TEST
@@ -452,6 +454,11 @@
 // After homing all axes ('G28' or 'G28 XYZ') rest Z at Z MIN POS
 //#define MESH_G28_REST_ORIGIN
 
+// Segment-free mesh leveling: the moves are not split at the mesh lines, each one
+// is a single planner block and the stepper adds the Z of the mesh between its ends
+// at each step segment. For MESH, UBL and BILINEAR. Requires STEP_SEGMENT_BUFFER.
+//#define MESH_SEGMENT_FREE
+
 /** START UNIFIED BED LEVELING **/
 // Sophisticated users prefer no movement of nozzle
 #define UBL_MESH_EDIT_MOVES_Z
@@ -470,6 +477,16 @@
 // Probe along the Y axis, advancing X after each column
 //#define PROBE_Y_FIRST
 
+// Fast probing with G29 K, for AUTO BED LEVELING BILINEAR. The points are probed
+// in nearest neighbour order and the probe travels Z_PROBE_MESH_CLEARANCE over the
+// highest point probed around its travel instead of Z_PROBE_BETWEEN_HEIGHT over the
+// last point.
+// With G29 K<mm> every other point is probed first, then the points inside cells
+// flatter than K are interpolated and the others probed.
+//#define ABL_FAST_PROBING
+// Make it larger than the bed deviation between neighbouring points
+#define Z_PROBE_MESH_CLEARANCE 1
+
 // Experimental Subdivision of the grid by Catmull-Rom method.
 // Synthesizes intermediate points to produce a more detailed mesh.
 //#define ABL_BILINEAR_SUBDIVISION
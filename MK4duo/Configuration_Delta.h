@@ -81,6 +81,13 @@
 // Subsegment per line 10 - xxx
 #define DELTA_SEGMENTS_PER_LINE 20
 
+// Segment-free moves: every G1 is a single planner block on the cartesian line
+// and the stepper computes the exact tower positions at each step segment.
+// Its speed and acceleration are cut for the fastest carriage along the line.
+// The segments above are still used while the bed leveling is active.
+// Requires STEP_SEGMENT_BUFFER.
+//#define DELTA_SEGMENT_FREE
+
 // NOTE: All following values for DELTA_* MUST be floating point,
 // so always have a decimal point in them.
 //
@@ -161,6 +168,34 @@
 /*****************************************************************************************/
 
 
+/*****************************************************************************************
+ ************************** Delta fixed point transform **********************************
+ *****************************************************************************************
+ *                                                                                       *
+ * The segmented moves transform their targets in batches. With this option the batch    *
+ * runs in integers: 16 bit squares of the distances from the towers in 1/64 mm and an   *
+ * integer square root instead of the float one. For the 8 bit processors.               *
+ * The carriages are within about 0.02 mm of the float ones, M963 compares them.         *
+ *                                                                                       *
+ * The towers must be within 512 mm from the nozzle, and the rods up to 1000 mm.         *
+ *                                                                                       *
+ *****************************************************************************************/
+//#define DELTA_FIXED_POINT_TRANSFORM
+/*****************************************************************************************/
+
+
+/*****************************************************************************************
+ ************************** Delta transform benchmark ************************************
+ *****************************************************************************************
+ *                                                                                       *
+ * M963 S<lines> R<seed> transforms the points of random lines one at a time and in      *
+ * batches, and reports the largest carriage difference and the points per second.       *
+ *                                                                                       *
+ *****************************************************************************************/
+//#define DELTA_TRANSFORM_BENCHMARK
+/*****************************************************************************************/
+
+
 /*****************************************************************************************
  ************************* Endstop pullup resistors **************************************
  *****************************************************************************************
@@ -292,6 +327,8 @@
 
 // Z Probe repetitions, median for best result
 #define Z_PROBE_REPETITIONS 1
+// Stop the repetitions once two consecutive readings agree within this distance (mm)
+//#define Z_PROBE_REPETITIONS_TOLERANCE 0.005
 
 // Enable Z Probe Repeatability test to see how accurate your probe is
 //#define PROBE_REPEATABILITY_TEST
@@ -458,6 +495,16 @@
 // Probe along the Y axis, advancing X after each column
 //#define PROBE_Y_FIRST
 
+// Fast probing with G29 K, for AUTO BED LEVELING BILINEAR. The points are probed
+// in nearest neighbour order and the probe travels Z_PROBE_MESH_CLEARANCE over the
+// highest point probed around its travel instead of Z_PROBE_BETWEEN_HEIGHT over the
+// last point.
+// With G29 K<mm> every other point is probed first, then the points inside cells
+// flatter than K are interpolated and the others probed.
+//#define ABL_FAST_PROBING
+// Make it larger than the bed deviation between neighbouring points
+#define Z_PROBE_MESH_CLEARANCE 1
+
 // Experimental Subdivision of the grid by Catmull-Rom method.
 // Synthesizes intermediate points to produce a more detailed mesh.
 //#define ABL_BILINEAR_SUBDIVISION
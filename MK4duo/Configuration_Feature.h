@@ -102,6 +102,7 @@
  * - Maximum stepper rate
  * - Direction Stepper Delay
  * - Adaptive Step Smoothing
+ * - Step segment buffer
  * - Microstepping
  * - Motor's current
  * - I2C DIGIPOT
@@ -566,6 +567,48 @@
 // Only parameter for test mode
 #define LIN_ADVANCE_K_START   0
 #define LIN_ADVANCE_K_FACTOR  0.02
+
+// Compute the advance with the step segments instead of the separate extruder ISR.
+// The extruder target is the nominal E plus K times the E speed, smoothed over
+// LIN_ADVANCE_SMOOTH_TIME, and its steps go in the same Bresenham loop of the
+// other axes. The acceleration is not limited by the E jerk. Before a stop the
+// advance left over is released at the E jerk speed after the other axes end.
+// Requires STEP_SEGMENT_BUFFER.
+//#define LIN_ADVANCE_SMOOTHING
+#define LIN_ADVANCE_SMOOTH_TIME 0.04  // (s)
+/*****************************************************************************************/
+
+
+/*****************************************************************************************
+ ************************************* Input Shaping *************************************
+ *****************************************************************************************
+ *                                                                                       *
+ * Cancel the ringing of the X and Y motors at their resonance frequency.                *
+ * Every step of a shaped motor is split into 2 or 3 impulses, delayed and weighted      *
+ * by the shaper, so the residual vibration of the carriage is cancelled.                *
+ * On CoreXY the shaper is applied to the A and B motors, use the same values for both.  *
+ * Only for Cartesian and CoreXY on 32 bit boards.                                       *
+ *                                                                                       *
+ * Shaper type: 0 = None, 1 = ZV, 2 = ZVD, 3 = MZV, 4 = EI                               *
+ * Frequency in Hz (10 - 200), damping ratio (0 - 0.9)                                   *
+ *                                                                                       *
+ * SHAPING_BUFFER_SIZE is the number of steps per motor waiting for the delayed          *
+ * impulses, power of 2. It must hold the steps of the longest delay (1/F for ZVD and    *
+ * EI), 4 bytes each. When it's full the steps are no longer shaped.                     *
+ *                                                                                       *
+ * Set with M593 X Y S<type> F<frequency> D<damping>, store with M500.                   *
+ *                                                                                       *
+ *****************************************************************************************/
+//#define INPUT_SHAPING
+
+#define SHAPING_X_TYPE      3
+#define SHAPING_X_FREQUENCY 40.0
+#define SHAPING_X_ZETA      0.1
+#define SHAPING_Y_TYPE      3
+#define SHAPING_Y_FREQUENCY 40.0
+#define SHAPING_Y_ZETA      0.1
+
+#define SHAPING_BUFFER_SIZE 1024
 /*****************************************************************************************/
 
 
@@ -1389,6 +1432,17 @@
 // Use CRC checks and retries on the SD communication.
 //#define SD_CHECK_AND_RETRY
 
+//
+// SD CARD: READ AHEAD
+//
+// Read the printing file in whole 512 byte blocks into a double buffer
+// and split the lines in RAM, instead of one SdFat call for every char.
+// The next blocks are read while the command buffer is full.
+// SD_READ_AHEAD_BLOCKS is the number of blocks in each buffer, more than 1
+// uses multi-block reads. Requires 1024 bytes of RAM for every block.
+//#define SD_READ_AHEAD
+#define SD_READ_AHEAD_BLOCKS 1
+
 //
 // Show extended directory including file length.
 // Don't use this with Pronterface
@@ -1452,6 +1506,13 @@
 #define SD_RESTART_FILE_SAVE_TIME    1  // Seconds between update
 #define SD_RESTART_FILE_PURGE_LEN   20  // Purge when restart
 #define SD_RESTART_FILE_RETRACT_LEN  1  // Retract when restart
+
+// Print time estimate, M37 <file> runs the file through the planner with no motion
+// and writes the total time, the time of every layer and progress points in
+// <file>.tim. When the file selected by M23 has a .tim file the print progress
+// goes by the estimated time, not by the bytes read, and M27 tells the time left.
+// G4 dwells are counted, heating, tool changes and waits for the user are not.
+//#define PRINT_TIME_ESTIMATE
 /*****************************************************************************************/
 
 
@@ -1707,6 +1768,37 @@
  *                                                                          *
  ****************************************************************************/
 //#define BEZIER_JERK_CONTROL
+
+/****************************************************************************
+ * Bézier look-ahead                                                        *
+ *                                                                          *
+ * With BEZIER_JERK_CONTROL the junction speeds and the trapezoids are      *
+ * planned with the Bézier curve instead of a constant acceleration, so the *
+ * planned times are the ones the stepper runs. The acceleration settings   *
+ * become the peak of the curve (without this option the curve reaches      *
+ * 15/8 of them) and the jerk never exceeds BEZIER_MAX_JERK (mm/s^3).       *
+ * Float math, for 32 bit boards. Not with FIXED_POINT_TRAPEZOID.           *
+ ****************************************************************************/
+//#define BEZIER_JERK_PLANNING
+#define BEZIER_MAX_JERK 100000
+/****************************************************************************/
+
+
+/****************************************************************************
+ ************************* Fixed point trapezoids ***************************
+ ****************************************************************************
+ *                                                                          *
+ * Compute the acceleration steps and the entry and exit rates of the       *
+ * blocks in integer math, dividing by a reciprocal of the acceleration    *
+ * stored at plan time, instead of float divisions and square roots at     *
+ * every junction. Worth it on boards without FPU (AVR, DUE).               *
+ * Blocks faster than 65535 steps/s keep the float math.                    *
+ *                                                                          *
+ * M962 S<blocks> R<seed> compares the two on random blocks and reports     *
+ * the time per block.                                                      *
+ *                                                                          *
+ ****************************************************************************/
+//#define FIXED_POINT_TRAPEZOID
 /****************************************************************************/
 
 
@@ -1774,8 +1866,64 @@
  * The algorithm adapts to provide the best possible step smoothing    *
  * at the lowest stepping frequencies.                                 *
  *                                                                     *
+ * MULTI_AXIS_STEP_SMOOTHING picks the oversampling for each step      *
+ * segment instead of for the whole block, so the acceleration and     *
+ * deceleration get the smoothing of their own step rate. The steps    *
+ * per ISR are raised only when the rate can't be stepped one at a     *
+ * time. Requires STEP_SEGMENT_BUFFER.                                 *
+ * MULTI_AXIS_STEP_SMOOTHING_LEVELS: maximum oversampling, as a power  *
+ * of 2 (1..4).                                                        *
+ *                                                                     *
+ * M961 reports the worst step interval deviation for each axis of a   *
+ * block, at every oversampling level.                                 *
+ *                                                                     *
  ***********************************************************************/
 //#define ADAPTIVE_STEP_SMOOTHING
+//#define MULTI_AXIS_STEP_SMOOTHING
+#define MULTI_AXIS_STEP_SMOOTHING_LEVELS 3
+/***********************************************************************/
+
+
+/***********************************************************************
+ ************************ Step segment buffer **************************
+ ***********************************************************************
+ *                                                                     *
+ * Slice the planner blocks from idle into short constant-rate         *
+ * segments, each with its timer interval and steps per ISR already    *
+ * computed. The stepper ISR only plays them back, so the trapezoid    *
+ * and Bezier evaluation no longer run at every step interrupt.        *
+ * If the main loop stalls and the buffer runs dry the motion waits   *
+ * for it and "Step segment underruns: <count>" is reported.           *
+ *                                                                     *
+ * STEP_SEGMENT_BUFFER_SIZE: segments in the ring (4..127).            *
+ * STEP_SEGMENT_FREQUENCY: segments per second while accelerating or   *
+ * decelerating. A cruise is played as a single segment.               *
+ *                                                                     *
+ ***********************************************************************/
+//#define STEP_SEGMENT_BUFFER
+#define STEP_SEGMENT_BUFFER_SIZE 16
+#define STEP_SEGMENT_FREQUENCY 1000
+/***********************************************************************/
+
+
+/***********************************************************************
+ ************************** Step timeline ******************************
+ ***********************************************************************
+ *                                                                     *
+ * Record, for every block, the step event count, the acceleration     *
+ * and deceleration points and, for every block phase of the stepper   *
+ * ISR, the chosen interval and steps per ISR in a lock-free ring.     *
+ * The ring is drained from idle to serial (M960 S1) or to the file    *
+ * timeline.log on SD (M960 S2). M960 S0 stop recording.               *
+ * Use scripts/steptimeline.py to rebuild velocity and acceleration    *
+ * profiles per axis from the log.                                     *
+ *                                                                     *
+ * STEP_TIMELINE_BUFFER_SIZE: records in the ring, power of 2 up to    *
+ * 128. Each record takes 20 bytes of RAM.                             *
+ *                                                                     *
+ ***********************************************************************/
+//#define STEP_TIMELINE
+#define STEP_TIMELINE_BUFFER_SIZE 64
 /***********************************************************************/
 
 
@@ -1896,6 +2044,18 @@
 //#define ARC_P_CIRCLES         // Enable the 'P' parameter to specify complete circles
 //#define CNC_WORKSPACE_PLANES  // Allow G2/G3 to operate in XY, ZX, or YZ planes
 
+//
+// G0/G1 Move coalescing
+//
+// Join runs of short collinear G0/G1 moves before the planner, so that a run
+// costs one block and one look-ahead pass. The moves must have the same feedrate
+// and E proportional to the path. With COALESCE_ARCS runs of short chords on a
+// circle in XY are planned as an arc, like G2/G3.
+//#define MOVE_COALESCING
+#define COALESCE_TOLERANCE    0.01  // (mm) Max distance of the joined points from the new path
+#define COALESCE_MAX_SEGMENTS 8     // Max moves joined in one (2..16)
+//#define COALESCE_ARCS             // Requires ARC_SUPPORT
+
 // Moves with fewer segments than this will be ignored and joined with the next movement
 #define MIN_STEPS_PER_SEGMENT 6
 
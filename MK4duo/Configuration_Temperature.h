@@ -101,6 +101,11 @@
 // Thermistor series resistor value in Ohms (see on your board)
 #define THERMISTOR_SERIES_RS 4700.0
 
+// Convert thermistor readings (type 1-9) with a table of the ADC values every 10°C
+// from -20°C to 480°C, built when the sensor is set by M305 or loaded from EEPROM.
+// Saves the LOG and the float divisions of every reading, uses 102 bytes of RAM for each heater.
+//#define THERMISTOR_LUT
+
 // User Sensor
 #define T9_NAME   "User Sensor"
 #define T9_R25    100000.0  // Resistance in Ohms @ 25°C
@@ -231,6 +236,24 @@
 /***********************************************************************/
 
 
+/***********************************************************************
+ ********************** ADC Oversampling *******************************
+ ***********************************************************************
+ *                                                                     *
+ * ADC Oversampling only for Arduino DUE                               *
+ * The ADC converts all the sensors in free run and the PDC stores     *
+ * the results in blocks of ADC_BUFFER_SAMPLES conversions.            *
+ * Each sensor is averaged over this number of blocks (1 - 64).        *
+ * A block lasts about 6 ms, more blocks = quieter but slower reading. *
+ *                                                                     *
+ ***********************************************************************/
+#define HOTEND_ADC_SAMPLES  16
+#define BED_ADC_SAMPLES     32
+#define CHAMBER_ADC_SAMPLES 32
+#define COOLER_ADC_SAMPLES  32
+/***********************************************************************/
+
+
 /***********************************************************************
  ********************** PID Settings - HOTEND **************************
  ***********************************************************************
@@ -247,13 +270,19 @@
 
 #define HOTEND_HYSTERESIS 2       // (degC) range of +/- temperatures considered "close" to the target one
 #define HOTEND_CHECK_INTERVAL 100 // ms between checks in bang-bang control
+#define HOTEND_PID_SAMPLE_MS 1000 // ms between PID computations (100 - 10000), for each heater with M301 S<ms>
+
+// The derivative goes through a low-pass filter with time constant Kd / (Kp * N).
+// Higher N filters less, the temperatures are read every 100 ms.
+#define PID_DERIVATIVE_FILTER_N 10
 
 #define PID_AUTOTUNE_MENU // Add PID Autotune to the LCD "Temperature" menu to run M303 and apply the result.
 
-// this adds an experimental additional term to the heating power, proportional to the extrusion speed.
+// this adds an additional term to the heating power, proportional to the extrusion speed (mm/s of filament)
+// planned by the blocks in the planner buffer, so the power rises before the flow does.
 // if Kc is chosen well, the additional required power due to increased melting should be compensated.
+// The planned blocks replace the history of past extrusion, LPQ_MAX_LEN and M301 L are no longer used.
 //#define PID_ADD_EXTRUSION_RATE
-#define LPQ_MAX_LEN 50
 
 //      HotEnd    {HE0,HE1,HE2,HE3,HE4,HE5}
 #define HOTEND_Kp {40, 40, 40, 40, 40, 40}
@@ -279,6 +308,7 @@
 
 #define BED_HYSTERESIS        2 // Only disable heating if T>target+BED HYSTERESIS and enable heating if T<target-BED HYSTERESIS
 #define BED_CHECK_INTERVAL  500 // ms between checks in bang-bang control
+#define BED_PID_SAMPLE_MS  1000 // ms between PID computations (100 - 10000)
 
 //      BED     {BED0,BED1,BED2,BED3}
 #define BED_Kp  {10,10,10,10}
@@ -305,6 +335,7 @@
 
 #define CHAMBER_HYSTERESIS        2 // Only disable heating if T>target+CHAMBER HYSTERESIS and enable heating if T<target-CHAMBER HYSTERESIS
 #define CHAMBER_CHECK_INTERVAL  500 // ms between checks in bang-bang control
+#define CHAMBER_PID_SAMPLE_MS  1000 // ms between PID computations (100 - 10000)
 
 //      CHAMBER     {CHAMBER0,CHAMBER1,CHAMBER2,CHAMBER3}
 #define CHAMBER_Kp  {10,10,10,10}
@@ -329,6 +360,7 @@
 
 #define COOLER_HYSTERESIS        2 // only disable heating if T<target-COOLER_HYSTERESIS and enable heating if T>target+COOLER_HYSTERESIS
 #define COOLER_CHECK_INTERVAL  500 // ms between checks in bang-bang control
+#define COOLER_PID_SAMPLE_MS  1000 // ms between PID computations (100 - 10000)
 
 #define COOLER_Kp  10
 #define COOLER_Ki  1
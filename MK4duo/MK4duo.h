@@ -106,6 +106,8 @@
 #include "src/lib/enum.h"
 #include "src/lib/restorer.h"
 #include "src/lib/circular_queue.h"
+#include "src/lib/spsc_queue.h"
+#include "src/lib/spsc_arena.h"
 #include "src/lib/driver_types.h"
 #include "src/lib/duration_t.h"
 #include "src/lib/matrix.h"
@@ -156,6 +158,7 @@
 #include "src/feature/bezier/bezier.h"
 #include "src/feature/digipot/digipot.h"
 #include "src/feature/emergency_parser/emergency_parser.h"
+#include "src/feature/binary_protocol/binary_protocol.h"
 #include "src/feature/probe/probe.h"
 #include "src/feature/bedlevel/bedlevel.h"
 #include "src/feature/babystep/babystep.h"
@@ -179,3 +182,7 @@
 #include "src/feature/rgbled/led_events.h"
 #include "src/feature/caselight/caselight.h"
 #include "src/feature/restart/restart.h"
+#include "src/feature/steptimeline/steptimeline.h"
+#include "src/feature/input_shaping/input_shaping.h"
+#include "src/feature/coalescer/coalescer.h"
+#include "src/feature/printtime/printtime.h"
@@ -229,7 +229,7 @@
  *          H[heaters] 0-5 Hotend, -1 BED, -2 CHAMBER, -3 COOLER
  *          T[int] 0-3 For Select Beds or Chambers (default 0)
  *          P[float] Kp term, I[float] Ki term, D[float] Kd term
- *          With PID_ADD_EXTRUSION_RATE: C[float] Kc term, L[int] LPQ length
+ *          With PID_ADD_EXTRUSION_RATE: C[float] Kc term
  * M302 - Allow cold extrudes, or set the minimum extrude S[temperature].
  * M303 - PID relay autotune.
  *          H[heaters] 0-5 Hotend, -1 BED, -2 CHAMBER, -3 COOLER
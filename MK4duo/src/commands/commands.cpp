@@ -32,7 +32,7 @@
 Commands commands;
 
 /** Public Parameters */
-Circular_Queue<gcode_t, BUFSIZE> Commands::buffer_ring;
+SPSC_Arena<gcode_t, BUFSIZE_BYTES, BUFSIZE_LINES, MAX_CMD_SIZE> Commands::buffer_ring;
 
 long Commands::gcode_last_N = 0;
 
@@ -43,6 +43,8 @@ int Commands::serial_count[NUM_SERIAL] = { 0 };
 
 PGM_P Commands::injected_commands_P = nullptr;
 
+bool Commands::running_front = false;
+
 /** Public Function */
 void Commands::flush_and_request_resend() {
   SERIAL_FLUSH();
@@ -64,12 +66,19 @@ void Commands::advance_queue() {
   if (process_injected()) return;
 
   // Return if the G-code buffer is empty
-  if (!buffer_ring.count()) return;
+  if (buffer_ring.isEmpty()) {
+    #if ENABLED(MOVE_COALESCING)
+      coalescer.idle();
+    #endif
+    return;
+  }
+
+  running_front = true;
 
   #if HAS_SD_SUPPORT
 
     if (card.isSaving()) {
-      gcode_t command = buffer_ring.peek();
+      gcode_t &command = buffer_ring.front();
       if (is_M29(command.gcode)) {
         // M29 closes the file
         card.finishWrite();
@@ -86,7 +95,11 @@ void Commands::advance_queue() {
       }
       else {
         // Write the string from the read buffer to SD
-        card.write_command(command.gcode);
+        #if ENABLED(BINARY_PROTOCOL)
+          card.write_command(command.tokens ? binary_protocol.line_text(command.gcode, command.tokens) : command.gcode);
+        #else
+          card.write_command(command.gcode);
+        #endif
         ok_to_send();
       }
     }
@@ -99,13 +112,15 @@ void Commands::advance_queue() {
 
   #endif // !HAS_SD_SUPPORT
 
-  // The buffer_ring may be reset by a command handler or by code invoked by idle() within a handler
-  buffer_ring.dequeue();
+  // The buffer_ring may be reset by a command handler or by code invoked by idle() within a handler,
+  // the running command is kept until here and the lines dropped by the reset go with it
+  running_front = false;
+  buffer_ring.pop();
 
 }
 
 void Commands::clear_queue() {
-  buffer_ring.clear();
+  buffer_ring.clear(running_front);
 }
 
 void Commands::inject_P(PGM_P const pgcode) {
@@ -284,7 +299,7 @@ Heater* Commands::get_target_heater() {
 /** Private Function */
 void Commands::ok_to_send() {
 
-  gcode_t tmp = buffer_ring.peek();
+  const gcode_t &tmp = buffer_ring.front();
 
   if (tmp.s_port < 0 || !tmp.send_ok) return;
 
@@ -292,7 +307,7 @@ void Commands::ok_to_send() {
   SERIAL_STR(OK);
 
   #if ENABLED(ADVANCED_OK)
-    char* p = tmp.gcode;
+    const char* p = tmp.gcode;
     if (*p == 'N') {
       SERIAL_CHR(' ');
       SERIAL_CHR(*p++);
@@ -300,7 +315,7 @@ void Commands::ok_to_send() {
         SERIAL_CHR(*p++);
     }
     SERIAL_MV(" P", int(planner.moves_free()));
-    SERIAL_MV(" B", int(BUFSIZE - buffer_ring.count()));
+    SERIAL_MV(" B", int(BUFSIZE_LINES - buffer_ring.count()));
   #endif
 
   SERIAL_EOL();
@@ -329,6 +344,10 @@ void Commands::get_serial() {
     }
   #endif
 
+  #if ENABLED(BINARY_PROTOCOL)
+    binary_protocol.check_timeout();
+  #endif
+
   /**
    * Loop while serial characters are incoming and the buffer_ring is not full
    */
@@ -341,6 +360,14 @@ void Commands::get_serial() {
       const int c = Com::serialRead(i);
       if (c < 0) continue;
 
+      #if ENABLED(BINARY_PROTOCOL)
+        // A binary frame may start where an ASCII line could start
+        const BinaryResultEnum binary = binary_protocol.process_char(i, c, !serial_count[i] && serial_input_state[i] == PS_NORMAL);
+        if (binary == BINARY_LINE && !enqueue(binary_protocol.line, true, i, binary_protocol.tokens_size ? binary_protocol.tokens : nullptr, binary_protocol.tokens_size))
+          binary_protocol.reject_frame(i);
+        if (binary != BINARY_NONE) continue;
+      #endif
+
       const char serial_char = c;
 
       if (serial_char == '\n' || serial_char == '\r') {
@@ -464,41 +491,102 @@ void Commands::get_serial() {
       }
     #endif
 
-    int sd_count = 0;
-    bool card_eof = card.eof();
+    #if ENABLED(SD_READ_AHEAD)
 
-    while (!buffer_ring.isFull() && !card_eof) {
+      static int sd_count = 0;
 
-      const int16_t n = card.get();
-      card_eof = card.eof();
+      // A new file or a new position, drop what is left of the last line
+      if (card.stream_is_new()) {
+        sd_input_state = PS_NORMAL;
+        sd_count = 0;
+      }
 
-      if (n < 0 && !card_eof) { SERIAL_LM(ER, STR_SD_ERR_READ); continue; }
+      while (!buffer_ring.isFull()) {
 
-      const char sd_char  = (char)n;
-      const bool is_eol   = sd_char == '\n' || sd_char == '\r';
+        uint16_t len;
+        const char * const data = card.stream_get(len);
 
-      printer.max_inactivity_timer.start();
+        if (!data) {
+          if (!card.eof()) { SERIAL_LM(ER, STR_SD_ERR_READ); break; }
+          // End of file with no newline
+          if (!process_line_done(sd_input_state, sd_line_buffer, sd_count)) {
+            enqueue(sd_line_buffer, false, -2);
+            #if HAS_SD_RESTART
+              restart.cmd_sdpos = card.getIndex();
+            #endif
+          }
+          card.fileHasFinished();
+          break;
+        }
+
+        printer.max_inactivity_timer.start();
+
+        // Parse up to the first end of line in the buffer
+        const char *eol = (const char*)memchr(data, '\n', len);
+        const char * const cr = (const char*)memchr(data, '\r', eol ? eol - data : len);
+        if (cr) eol = cr;
 
-      if (is_eol || card_eof) {
+        const uint16_t count = eol ? eol - data : len;
+        for (uint16_t i = 0; i < count; i++)
+          process_stream_char(data[i], sd_input_state, sd_line_buffer, sd_count);
 
-        // Reset stream state, terminate the buffer, and commit a non-empty command
-        if (!is_eol && sd_count) ++sd_count;    // End of file with no newline
-        if (!process_line_done(sd_input_state, sd_line_buffer, sd_count)) {
+        card.stream_consume(eol ? count + 1 : count);
+
+        if (eol && !process_line_done(sd_input_state, sd_line_buffer, sd_count)) {
           enqueue(sd_line_buffer, false, -2);   // Port -2 for SD non answer and no send ok.
           #if HAS_SD_RESTART
             restart.cmd_sdpos = card.getIndex();
           #endif
         }
 
-        if (card_eof) card.fileHasFinished();
+      }
+
+      // The queue is full, read the next blocks while it drains
+      if (IS_SD_PRINTING()) card.stream_prefetch();
+
+    #else
+
+      int sd_count = 0;
+      bool card_eof = card.eof();
+
+      while (!buffer_ring.isFull() && !card_eof) {
+
+        const int16_t n = card.get();
+        card_eof = card.eof();
+
+        if (n < 0 && !card_eof) { SERIAL_LM(ER, STR_SD_ERR_READ); continue; }
+
+        const char sd_char  = (char)n;
+        const bool is_eol   = sd_char == '\n' || sd_char == '\r';
+
+        printer.max_inactivity_timer.start();
+
+        if (is_eol || card_eof) {
+
+          // Reset stream state, terminate the buffer, and commit a non-empty command
+          if (!is_eol && sd_count) ++sd_count;    // End of file with no newline
+          if (!process_line_done(sd_input_state, sd_line_buffer, sd_count)) {
+            enqueue(sd_line_buffer, false, -2);   // Port -2 for SD non answer and no send ok.
+            #if HAS_SD_RESTART
+              restart.cmd_sdpos = card.getIndex();
+            #endif
+          }
+
+          if (card_eof) card.fileHasFinished();
+
+        }
+        else
+          process_stream_char(sd_char, sd_input_state, sd_line_buffer, sd_count);
 
       }
-      else
-        process_stream_char(sd_char, sd_input_state, sd_line_buffer, sd_count);
 
-    }
+    #endif
 
-    printer.progress = card.percentDone();
+    #if ENABLED(PRINT_TIME_ESTIMATE)
+      printer.progress = printtime.percentDone();
+    #else
+      printer.progress = card.percentDone();
+    #endif
 
   }
 
@@ -506,25 +594,31 @@ void Commands::get_serial() {
 
 void Commands::process_next() {
 
-  gcode_t cmd = buffer_ring.peek();
+  gcode_t &cmd = buffer_ring.front();
 
   if (printer.debugEcho()) {
     SERIAL_PORT(cmd.s_port);
-    SERIAL_LT(ECHO, cmd.gcode);
+    #if ENABLED(BINARY_PROTOCOL)
+      SERIAL_LT(ECHO, cmd.tokens ? binary_protocol.line_text(cmd.gcode, cmd.tokens) : cmd.gcode);
+    #else
+      SERIAL_LT(ECHO, cmd.gcode);
+    #endif
   }
 
   printer.reset_move_timer(); // Keep steppers powered
 
   // Parse the next command in the buffer_ring
   parser.parse(cmd.gcode);
+  #if ENABLED(GCODE_PRETOKENIZE)
+    parser.tokens = cmd.tokens;
+  #endif
   process_parsed();
 
 }
 
 void Commands::unknown_warning() {
   #if NUM_SERIAL > 1
-    gcode_t tmp = buffer_ring.peek();
-    SERIAL_PORT(tmp.s_port);
+    SERIAL_PORT(buffer_ring.front().s_port);
   #endif
   SERIAL_SMT(ECHO, STR_UNKNOWN_COMMAND, parser.command_ptr);
   SERIAL_CHR('"');
@@ -558,16 +652,45 @@ bool Commands::enqueue_one(const char * cmd) {
   return false;
 }
 
-bool Commands::enqueue(const char * cmd, bool say_ok/*=false*/, int8_t port/*=-2*/) {
-  if (*cmd == ';' || buffer_ring.isFull()) return false;
-  gcode_t temp_cmd;
-  strcpy(temp_cmd.gcode, cmd);
-  temp_cmd.s_port = port;
-  temp_cmd.send_ok = say_ok;
+#if ENABLED(GCODE_PRETOKENIZE)
+  bool Commands::enqueue(const char * cmd, bool say_ok/*=false*/, int8_t port/*=-2*/, const uint8_t * tokens/*=nullptr*/, uint8_t tokens_size/*=0*/) {
+#else
+  bool Commands::enqueue(const char * cmd, bool say_ok/*=false*/, int8_t port/*=-2*/) {
+#endif
+  if (*cmd == ';') return false;
+  const uint16_t len = MIN(strlen(cmd), size_t(MAX_CMD_SIZE - 1));
+  #if ENABLED(GCODE_PRETOKENIZE)
+    const bool predecoded = tokens != nullptr;
+    uint8_t line_tokens[GCODE_TOKENS_SIZE];
+    if (!predecoded) {
+      tokens_size = parser.tokenize(cmd, line_tokens);
+      tokens = line_tokens;
+    }
+    // Decoded values go after the line, if there is room for them
+    gcode_t *slot = tokens_size ? buffer_ring.reserve(len + 1 + tokens_size) : nullptr;
+    if (slot) {
+      memcpy(slot->gcode + len + 1, tokens, tokens_size);
+      slot->tokens = (const uint8_t*)slot->gcode + len + 1;
+    }
+    else {
+      // The ASCII line can stand alone, unless the values came pre-decoded
+      if (predecoded) return false;
+      slot = buffer_ring.reserve(len + 1);
+      if (!slot) return false;
+      slot->tokens = nullptr;
+    }
+  #else
+    gcode_t * const slot = buffer_ring.reserve(len + 1);
+    if (!slot) return false;
+  #endif
+  memcpy(slot->gcode, cmd, len);
+  slot->gcode[len] = '\0';
+  slot->s_port = port;
+  slot->send_ok = say_ok;
   #if HAS_SD_RESTART
     restart.set_sdpos();
   #endif
-  buffer_ring.enqueue(temp_cmd);
+  buffer_ring.commit();
   return true;
 }
 
@@ -610,6 +733,11 @@ void Commands::process_parsed(const bool say_ok/*=true*/) {
 
   PRINTER_KEEPALIVE(InHandler);
 
+  #if ENABLED(MOVE_COALESCING)
+    // Only G0/G1 may join the pending moves, anything else runs after them
+    if (parser.command_letter != 'G' || parser.codenum > 1) coalescer.flush();
+  #endif
+
   #if ENABLED(FASTER_GCODE_EXECUTE)
 
     // Handle a known G, M, or T
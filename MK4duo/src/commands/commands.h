@@ -36,7 +36,10 @@
 #define PS_ESC    4
     
 struct gcode_t {
-  char    gcode[MAX_CMD_SIZE];  // Char for gcode
+  char    *gcode;               // Command line in the buffer arena
+  #if ENABLED(GCODE_PRETOKENIZE)
+    const uint8_t *tokens;      // Decoded values after the line, nullptr if none
+  #endif
   bool    send_ok = true;       // Send "ok" after commands by default
   int8_t  s_port  = -1;         // Serial port for print information:
                                 //    -1 for all port
@@ -53,14 +56,16 @@ class Commands {
 
     /**
      * GCode Command Buffer Ring
-     * A simple ring buffer of BUFSIZE command strings.
+     * A single producer single consumer queue of up to BUFSIZE_LINES
+     * command strings, packed back-to-back in BUFSIZE_BYTES of arena.
      *
-     * Commands are copied into this buffer by the command injectors
-     * (immediate, serial, sd card) and they are processed sequentially by
-     * the main loop. The process_next function parses the next
-     * command and hands off execution to individual handler functions.
+     * Commands are written in place into a reserved line by the command
+     * injectors (immediate, serial, sd card) and they are processed
+     * sequentially by the main loop. The process_next function parses the
+     * front command where it lies and hands off execution to individual
+     * handler functions. The line is released only after the command is done.
      */
-    static Circular_Queue<gcode_t, BUFSIZE> buffer_ring;
+    static SPSC_Arena<gcode_t, BUFSIZE_BYTES, BUFSIZE_LINES, MAX_CMD_SIZE> buffer_ring;
 
     /**
      * GCode line number handling. Hosts may opt to include line numbers when
@@ -82,6 +87,12 @@ class Commands {
      */
     static PGM_P injected_commands_P;
 
+    /**
+     * True while the front command of the buffer_ring is being run,
+     * clear_queue() must leave it in place until advance_queue() pops it.
+     */
+    static bool running_front;
+
   public: /** Public Function */
 
     /**
@@ -104,7 +115,8 @@ class Commands {
     static void advance_queue();
 
     /**
-     * Clear the MK4duo command buffer_ring
+     * Clear the MK4duo command buffer_ring.
+     * The command being run, if any, is released by advance_queue().
      */
     static void clear_queue();
 
@@ -218,7 +230,12 @@ class Commands {
      * Return true if the command was successfully added.
      * Return false for a full buffer, or if the 'command' is a comment.
      */
-    static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2);
+    #if ENABLED(GCODE_PRETOKENIZE)
+      // With tokens the values are already decoded, otherwise the line is tokenized here
+      static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2, const uint8_t * tokens=nullptr, uint8_t tokens_size=0);
+    #else
+      static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2);
+    #endif
 
     /**
      * Process the next "immediate" command
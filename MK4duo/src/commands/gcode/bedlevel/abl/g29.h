@@ -44,6 +44,135 @@
   #endif
 #endif
 
+#if ENABLED(ABL_FAST_PROBING)
+
+  /**
+   * Probe the bilinear grid for G29 K, return the last measured Z or NAN on failure.
+   *
+   * The next point is always the nearest one still to probe. With PROBE_PT_RAISE
+   * the probe only rises to Z_PROBE_MESH_CLEARANCE over the highest point probed
+   * so far in the cells crossed by the travel and around them, so the slow
+   * approach of the next point is short.
+   *
+   * With a flat_tolerance every other point (and the last line) is probed first.
+   * The points between them are interpolated when the corners of their cell
+   * agree within flat_tolerance, the others are probed in a second pass.
+   */
+  inline float g29_fast_probing(const xy_pos_t &probe_position_lf, const xy_float_t &gridSpacing,
+    const float zoffset, const float flat_tolerance, const ProbePtRaiseEnum raise_after,
+    const int verbose_level, const bool faux
+  ) {
+
+    enum : uint8_t { PT_SKIP, PT_TODO, PT_DONE };
+    uint8_t state[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+    auto coarse = [](const uint8_t i, const uint8_t n) { return !(i & 1) || i == n - 1; };
+    auto grid_pos = [&](const uint8_t x, const uint8_t y) {
+      return probe_position_lf + gridSpacing * xy_float_t({ float(x), float(y) });
+    };
+
+    bool adaptive = flat_tolerance > 0;
+
+    GRID_LOOP(x, y) {
+      abl.data.z_values[x][y] = NAN;
+      state[x][y] = !adaptive || (coarse(x, GRID_MAX_POINTS_X) && coarse(y, GRID_MAX_POINTS_Y)) ? PT_TODO : PT_SKIP;
+      #if IS_KINEMATIC
+        // Avoid probing outside the round or hexagonal area, extrapolated later
+        if (!mechanics.position_is_reachable_by_probe(grid_pos(x, y))) state[x][y] = PT_DONE;
+      #endif
+    }
+
+    xy_pos_t here = { mechanics.position.x + probe.data.offset.x, mechanics.position.y + probe.data.offset.y };
+    xy_int8_t last = { -1, -1 };
+    float measured_z = 0;
+    uint16_t probed = 0, interpolated = 0;
+
+    for (;;) {
+
+      for (;;) {
+
+        // The nearest point still to probe
+        xy_int8_t pt = { -1, -1 };
+        float best = 0;
+        GRID_LOOP(x, y) {
+          if (state[x][y] != PT_TODO) continue;
+          const xy_pos_t d = grid_pos(x, y) - here;
+          const float dist = sq(d.x) + sq(d.y);
+          if (pt.x < 0 || dist < best) { best = dist; pt.set(x, y); }
+        }
+        if (pt.x < 0) break;
+
+        const xy_pos_t probePos = grid_pos(pt.x, pt.y);
+
+        if (probed && raise_after == PROBE_PT_RAISE && !faux) {
+          // Clear the highest point probed over the cells of the travel and one point
+          // around them, the bed under the next point is not known yet
+          float top = measured_z;
+          for (int8_t x = MAX(MIN(last.x, pt.x) - 1, 0); x <= MIN(MAX(last.x, pt.x) + 1, GRID_MAX_POINTS_X - 1); x++)
+            for (int8_t y = MAX(MIN(last.y, pt.y) - 1, 0); y <= MIN(MAX(last.y, pt.y) + 1, GRID_MAX_POINTS_Y - 1); y++)
+              if (state[x][y] == PT_DONE && !isnan(abl.data.z_values[x][y]))
+                NOLESS(top, abl.data.z_values[x][y] - zoffset);
+          mechanics.do_blocking_move_to_z(mechanics.position.z + top - measured_z + (Z_PROBE_MESH_CLEARANCE), MMM_TO_MMS(probe.data.speed_fast));
+        }
+
+        if (verbose_level) {
+          SERIAL_MV("Probing mesh point ", int(probed + 1));
+          SERIAL_MV(" (", int(pt.x));
+          SERIAL_MV(",", int(pt.y));
+          SERIAL_EM(")");
+        }
+        #if HAS_LCD
+          lcdui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(probed + 1), int(GRID_MAX_POINTS));
+        #endif
+
+        measured_z = faux ? 0.001f * random(-100, 101)
+                          : probe.check_at_point(probePos, raise_after == PROBE_PT_RAISE ? PROBE_PT_NONE : raise_after, verbose_level);
+        if (isnan(measured_z)) return NAN;
+
+        abl.data.z_values[pt.x][pt.y] = measured_z + zoffset;
+        state[pt.x][pt.y] = PT_DONE;
+        here = probePos;
+        last = pt;
+        probed++;
+
+        bedlevel.flag.leveling_previous = false;
+        printer.idle();
+      }
+
+      if (!adaptive) break;
+      adaptive = false;
+
+      // Interpolate the points of the flat cells, probe the others
+      GRID_LOOP(x, y) {
+        if (state[x][y] != PT_SKIP) continue;
+        const uint8_t x0 = coarse(x, GRID_MAX_POINTS_X) ? x : x - 1, x1 = coarse(x, GRID_MAX_POINTS_X) ? x : x + 1,
+                      y0 = coarse(y, GRID_MAX_POINTS_Y) ? y : y - 1, y1 = coarse(y, GRID_MAX_POINTS_Y) ? y : y + 1;
+        const float z00 = abl.data.z_values[x0][y0], z10 = abl.data.z_values[x1][y0],
+                    z01 = abl.data.z_values[x0][y1], z11 = abl.data.z_values[x1][y1];
+        if (!isnan(z00) && !isnan(z10) && !isnan(z01) && !isnan(z11)
+          && MAX(z00, z10, z01, z11) - MIN(z00, z10, z01, z11) <= flat_tolerance
+        ) {
+          abl.data.z_values[x][y] = (z00 + z10 + z01 + z11) * 0.25f;
+          state[x][y] = PT_DONE;
+          interpolated++;
+        }
+        else
+          state[x][y] = PT_TODO;
+      }
+
+    }
+
+    if (verbose_level) {
+      SERIAL_MV("Probed ", int(probed));
+      SERIAL_MV(" interpolated ", int(interpolated));
+      SERIAL_EMV(" of ", int(GRID_MAX_POINTS));
+    }
+
+    return measured_z;
+  }
+
+#endif // ABL_FAST_PROBING
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -108,6 +237,12 @@
  *  Y  Y for mesh point, overrides J
  *  Z  Z for mesh point. Otherwise, raw current Z.
  *
+ * With ABL_FAST_PROBING:
+ *
+ *  K  Probe in nearest neighbour order at Z_PROBE_MESH_CLEARANCE.
+ *     K<mm> probes every other point first and interpolates the
+ *     points of the cells flatter than the given value.
+ *
  * Without PROBE_MANUALLY:
  *
  *  E  By default G29 will engage the Z probe, test the bed, then disengage.
@@ -612,13 +747,23 @@ inline void gcode_G29() {
 
     #if ABL_GRID
 
+      #if ENABLED(ABL_FAST_PROBING)
+        const bool fast = parser.seen('K');
+        if (fast) {
+          measured_z = g29_fast_probing(probe_position_lf, gridSpacing, zoffset, parser.value_linear_units(), raise_after, verbose_level, faux);
+          if (isnan(measured_z)) bedlevel.restore_bed_leveling_state();
+        }
+      #else
+        constexpr bool fast = false;
+      #endif
+
       bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
       xy_int8_t meshCount;
 
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
+      for (PR_OUTER_VAR = 0; !fast && PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
 
         int8_t inStart, inStop, inInc;
 
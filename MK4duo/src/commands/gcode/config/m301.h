@@ -31,7 +31,7 @@
 #define CODE_M301
 
 /**
- * M301: Set PID parameters P I D (and optionally C, L)
+ * M301: Set PID parameters P I D S (and optionally C)
  *
  *   H[heaters]   0-5 Hotend, -1 BED, -2 CHAMBER, -3 COOLER
  *
@@ -40,11 +40,11 @@
  *    P[float]    Kp term
  *    I[float]    Ki term
  *    D[float]    Kd term
+ *    S[int]      Sample period in ms (100 - 10000)
  *
  * With PID_ADD_EXTRUSION_RATE:
  *
- *    C[float]    Kc term
- *    L[int]      LPQ length
+ *    C[float]    Kc term, power for each mm/s of planned extrusion speed
  */
 inline void gcode_M301() {
 
@@ -54,7 +54,7 @@ inline void gcode_M301() {
 
   #if DISABLED(DISABLE_M503)
     // No arguments? Show M301 report.
-    if (!parser.seen("PIDCL")) {
+    if (!parser.seen("PIDSC")) {
       act->print_M301();
       return;
     }
@@ -63,14 +63,10 @@ inline void gcode_M301() {
   if (parser.seen('P')) act->data.pid.Kp = parser.value_float();
   if (parser.seen('I')) act->data.pid.Ki = parser.value_float();
   if (parser.seen('D')) act->data.pid.Kd = parser.value_float();
+  if (parser.seen('S')) act->data.pid.sample_period = constrain(parser.value_ushort(), 100, 10000);
 
   #if ENABLED(PID_ADD_EXTRUSION_RATE)
-    if (act->type == IS_HOTEND) {
-      if (parser.seen('C')) act->data.pid.Kc = parser.value_float();
-      if (parser.seen('L')) tempManager.heater.lpq_len = parser.value_int();
-      if (tempManager.heater.lpq_len > LPQ_MAX_LEN) tempManager.heater.lpq_len = LPQ_MAX_LEN;
-      if (tempManager.heater.lpq_len < 0) tempManager.heater.lpq_len = 0;
-    }
+    if (act->type == IS_HOTEND && parser.seen('C')) act->data.pid.Kc = parser.value_float();
   #endif
 
   act->setPidTuned(true);
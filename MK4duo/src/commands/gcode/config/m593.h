@@ -0,0 +1,94 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(INPUT_SHAPING)
+
+#define CODE_M593
+
+/**
+ * M593: Set Input Shaping
+ *
+ *  X Y           Axes to set, both if none
+ *  S<type>       Shaper 0 = None, 1 = ZV, 2 = ZVD, 3 = MZV, 4 = EI
+ *  F<frequency>  Resonance frequency in Hz (10 - 200)
+ *  D<damping>    Damping ratio (0 - 0.9)
+ */
+inline void gcode_M593() {
+
+  #if DISABLED(DISABLE_M503)
+    // No arguments? Show M593 report.
+    if (!parser.seen("SFD")) {
+      inputshaping.print_M593();
+      return;
+    }
+  #endif
+
+  const bool  seen_x = parser.seen('X'),
+              seen_y = parser.seen('Y');
+
+  // Wait for the moves and their delayed impulses
+  planner.synchronize();
+
+  LOOP_XY(i) {
+    if ((i == X_AXIS && !seen_x && seen_y) || (i == Y_AXIS && !seen_y && seen_x)) continue;
+
+    shaper_data_t &data = inputshaping.data[i];
+
+    if (parser.seenval('S')) {
+      const uint8_t type = parser.value_byte();
+      if (type < SHAPER_COUNT)
+        data.type = (ShaperEnum)type;
+      else
+        SERIAL_EM("?S value out of range (0-4).");
+    }
+
+    if (parser.seenval('F')) {
+      const float freq = parser.value_float();
+      if (WITHIN(freq, 10.0f, 200.0f))
+        data.frequency = freq;
+      else
+        SERIAL_EM("?F value out of range (10-200).");
+    }
+
+    if (parser.seenval('D')) {
+      const float zeta = parser.value_float();
+      if (WITHIN(zeta, 0.0f, 0.9f))
+        data.zeta = zeta;
+      else
+        SERIAL_EM("?D value out of range (0-0.9).");
+    }
+  }
+
+  inputshaping.update();
+
+  // The motors that are no longer shaped follow the planner direction again
+  stepper.set_directions();
+
+}
+
+#endif // ENABLED(INPUT_SHAPING)
@@ -0,0 +1,55 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+
+#define CODE_M961
+
+/**
+ * M961: Step smoothing benchmark
+ *
+ *  X Y Z E   Steps of the block for each motor
+ *  F         Step rate of the block, in steps per second
+ *
+ *  Report for every oversampling level up to the one in use the worst
+ *  deviation of the step intervals from even steps, for each motor
+ */
+inline void gcode_M961() {
+
+  xyze_ulong_t steps;
+  LOOP_XYZE(i) steps[i] = parser.ulongval(axis_codes[i]);
+
+  const uint32_t rate = parser.ulongval('F');
+  if (!rate) return;
+
+  planner.synchronize();
+  stepper.smoothing_benchmark(steps, rate);
+
+}
+
+#endif // ENABLED(ADAPTIVE_STEP_SMOOTHING)
@@ -0,0 +1,59 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+
+#if ENABLED(FIXED_POINT_TRAPEZOID)
+
+#define CODE_M962
+
+/**
+ * M962: Trapezoid generator benchmark
+ *
+ *  S   Number of blocks (default 1000)
+ *  R   Seed of the random blocks (default 1)
+ *  P1  Check the trapezoids of the moves that follow instead
+ *  P0  Stop checking them and report
+ *
+ *  Report the blocks where the fixed point trapezoid differs from the
+ *  float one by more than one step or one step/s, and the time per block
+ */
+inline void gcode_M962() {
+
+  if (parser.seen('P')) {
+    planner.trapezoid_check(parser.value_bool());
+    return;
+  }
+
+  const uint16_t count = parser.ushortval('S', 1000);
+  if (!count) return;
+
+  planner.trapezoid_benchmark(count, parser.ulongval('R', 1));
+
+}
+
+#endif // ENABLED(FIXED_POINT_TRAPEZOID)
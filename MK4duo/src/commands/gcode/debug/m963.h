@@ -0,0 +1,51 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(DELTA_TRANSFORM_BENCHMARK)
+
+#define CODE_M963
+
+/**
+ * M963: Delta kinematics benchmark
+ *
+ *  S   Number of lines (default 1000)
+ *  R   Seed of the random lines (default 1)
+ *
+ *  Transform the points of the lines one at a time and in batches,
+ *  report the largest carriage difference and the points per second
+ */
+inline void gcode_M963() {
+
+  const uint16_t count = parser.ushortval('S', 1000);
+  if (!count) return;
+
+  mechanics.transform_benchmark(count, parser.ulongval('R', 1));
+
+}
+
+#endif // DELTA_TRANSFORM_BENCHMARK
@@ -38,8 +38,7 @@
  */
 inline void gcode_M500() {
   #if NUM_SERIAL > 1
-    gcode_t tmp = commands.buffer_ring.peek();
-    SERIAL_PORT(tmp.s_port);
+    SERIAL_PORT(commands.buffer_ring.front().s_port);
   #endif
   (void)eeprom.store();
   SERIAL_PORT(-1);
@@ -50,8 +49,7 @@ inline void gcode_M500() {
  */
 inline void gcode_M501() {
   #if NUM_SERIAL > 1
-    gcode_t tmp = commands.buffer_ring.peek();
-    SERIAL_PORT(tmp.s_port);
+    SERIAL_PORT(commands.buffer_ring.front().s_port);
   #endif
   (void)eeprom.load();
   SERIAL_PORT(-1);
@@ -62,8 +60,7 @@ inline void gcode_M501() {
  */
 inline void gcode_M502() {
   #if NUM_SERIAL > 1
-    gcode_t tmp = commands.buffer_ring.peek();
-    SERIAL_PORT(tmp.s_port);
+    SERIAL_PORT(commands.buffer_ring.front().s_port);
   #endif
   (void)eeprom.reset();
   SERIAL_PORT(-1);
@@ -74,8 +71,7 @@ inline void gcode_M502() {
  */
 inline void gcode_M503() {
   #if NUM_SERIAL > 1
-    gcode_t tmp = commands.buffer_ring.peek();
-    SERIAL_PORT(tmp.s_port);
+    SERIAL_PORT(commands.buffer_ring.front().s_port);
   #endif
   (void)eeprom.Print_Settings();
   SERIAL_PORT(-1);
@@ -120,7 +120,7 @@ inline int32_t count_test_bytes(const char * const start_free_memory) {
    */
   inline void dump_free_memory(char *start_free_memory, char *end_free_memory) {
 
-    gcode_t tmp = commands.buffer_ring.peek();
+    const gcode_t &tmp = commands.buffer_ring.front();
 
     //
     // Start and end the dump on a nice 16 byte boundary
@@ -142,7 +142,7 @@ inline int32_t count_test_bytes(const char * const start_free_memory) {
       SERIAL_CHR('|');                      // Point out non test bytes
       for (uint8_t i = 0; i < 16; i++) {
         char ccc = (char)start_free_memory[i]; // cast to char before automatically casting to char on assignment, in case the compiler is broken
-        if (&start_free_memory[i] >= (char*)tmp.gcode && &start_free_memory[i] < (char*)tmp.gcode + sizeof(tmp)) { // Print out ASCII in the command buffer area
+        if (&start_free_memory[i] >= (char*)tmp.gcode && &start_free_memory[i] < (char*)tmp.gcode + strlen(tmp.gcode) + 1) { // Print out ASCII in the command buffer area
           if (!WITHIN(ccc, ' ', 0x7E)) ccc = ' ';
         }
         else { // If not in the command buffer area, flag bytes that don't match the test byte
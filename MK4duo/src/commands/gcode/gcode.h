@@ -69,6 +69,7 @@
 #include "config/m353.h"                  // Set Number total driver extruder
 #include "config/m563.h"                  // Set Tools heater assignment
 #include "config/m575.h"                  // Change serial baud rate
+#include "config/m593.h"                  // Set Input Shaping
 #include "config/m595.h"                  // Set AD595 offset & Gain
 #include "config/m569.h"                  // Set Stepper Direction
 #include "config/m900.h"                  // Set and/or Get advance K factor
@@ -100,6 +101,10 @@
 #include "debug/m42.h"
 #include "debug/m43.h"
 #include "debug/m44_pre_table.h"          // Debug Code Info
+#include "debug/m960.h"                   // Step timeline recorder
+#include "debug/m961.h"                   // Step smoothing benchmark
+#include "debug/m962.h"                   // Trapezoid generator benchmark
+#include "debug/m963.h"                   // Delta kinematics benchmark
 #include "debug/m1000.h"                  // Debug GCODE Parser
 
 // Delta Commands
@@ -152,6 +157,7 @@
 #include "host/m531.h"                    // Define filename being printed
 #include "host/m532_m73.h"                // Update current print state progress
 #include "host/m876.h"                    // Host Prompt Response
+#include "host/m880.h"                    // Binary protocol
 #include "host/m890.h"                    // Run User Gcode
 
 // LCD Commands
@@ -227,6 +233,7 @@
 #include "sdcard/m30.h"
 #include "sdcard/m32.h"
 #include "sdcard/m34.h"
+#include "sdcard/m37.h"
 #include "sdcard/m39.h"
 #include "sdcard/m524.h"
 #include "sdcard/m1001.h"
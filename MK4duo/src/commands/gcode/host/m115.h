@@ -127,6 +127,13 @@ inline void gcode_M115() {
     SERIAL_CAP_OFF("EMERGENCY_PARSER");
   #endif
 
+  // BINARY_PROTOCOL (M880)
+  #if ENABLED(BINARY_PROTOCOL)
+    SERIAL_CAP_ON("BINARY_PROTOCOL");
+  #else
+    SERIAL_CAP_OFF("BINARY_PROTOCOL");
+  #endif
+
   // CHAMBER_TEMPERATURE (M141, M191)
   #if HAS_CHAMBERS
     SERIAL_CAP_ON("CHAMBER_TEMPERATURE");
@@ -0,0 +1,46 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(BINARY_PROTOCOL)
+
+#define CODE_M880
+
+/**
+ * M880: Binary protocol
+ *
+ *  S1  Enable binary frames, the next frame sequence number is 0
+ *  S0  Disable binary frames
+ *
+ *  Without S report the state
+ */
+inline void gcode_M880() {
+  if (parser.seenval('S')) binary_protocol.set_enabled(parser.value_bool());
+  SERIAL_EMV("BINARY_PROTOCOL:", int(binary_protocol.enabled ? 1 : 0));
+}
+
+#endif // ENABLED(BINARY_PROTOCOL)
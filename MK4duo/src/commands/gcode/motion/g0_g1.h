@@ -46,6 +46,9 @@ inline void gcode_G0_G1(
           const float echange = mechanics.destination.e - mechanics.position.e;
           // Is this move an attempt to retract or recover?
           if (WITHIN(ABS(echange), MIN_AUTORETRACT, MAX_AUTORETRACT) && fwretract.retracted[toolManager.extruder.active] == (echange > 0.0)) {
+            #if ENABLED(MOVE_COALESCING)
+              coalescer.flush();                                    // The joined moves go before the retract
+            #endif
             mechanics.position.e = mechanics.destination.e; // Hide a G1-based retract/recover from calculations
             mechanics.sync_plan_position_e();                       // AND from the planner
             return fwretract.retract(echange < 0.0);                // Firmware-based retract/recover (double-retract ignored)
@@ -58,7 +61,16 @@ inline void gcode_G0_G1(
       if (lfire) laser.set_power();
     #endif
 
-    #if IS_SCARA
+    #if ENABLED(MOVE_COALESCING)
+      #if IS_SCARA
+        if (fast_move) {
+          coalescer.flush();
+          mechanics.prepare_uninterpolated_move_to_destination();
+        }
+        else
+      #endif
+          coalescer.prepare_move_to_destination();
+    #elif IS_SCARA
       fast_move ? mechanics.prepare_uninterpolated_move_to_destination() : mechanics.prepare_move_to_destination();
     #else
       mechanics.prepare_move_to_destination();
@@ -60,7 +60,7 @@
       #endif
     }
 
-    if (parser.seen('D')) laser.raster_num_pixels = base64_decode(laser.raster_data, parser.string_arg + 1, laser.raster_raw_length);
+    if (parser.seen('D')) laser.raster_num_pixels = laser.raster_decode(parser.string_arg + 1, laser.raster_raw_length);
 
     switch (laser.raster_direction) {
       case 0: // Negative X
@@ -38,6 +38,9 @@ inline void gcode_M23() {
   // Questa funzione blocca il nome al primo spazio quindi file con spazio nei nomi non funziona da rivedere
   //for (char *fn = parser.string_arg; *fn; ++fn) if (*fn == ' ') *fn = '\0';
   card.selectFile(parser.string_arg);
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    printtime.load(parser.string_arg);
+  #endif
   lcdui.set_status(card.fileName);
 }
 
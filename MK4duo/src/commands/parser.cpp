@@ -50,6 +50,11 @@ uint16_t GCodeParser::codenum;
   uint8_t GCodeParser::subcode;
 #endif
 
+#if ENABLED(GCODE_PRETOKENIZE)
+  const uint8_t *GCodeParser::tokens,
+                *GCodeParser::value_token;
+#endif
+
 #if ENABLED(FASTER_GCODE_PARSER)
   // Optimized Parameters
   uint32_t  GCodeParser::codebits;  // found bits
@@ -74,6 +79,9 @@ void GCodeParser::reset() {
   #if USE_GCODE_SUBCODES
     subcode = 0;                      // No command sub-code
   #endif
+  #if ENABLED(GCODE_PRETOKENIZE)
+    tokens = value_token = nullptr;   // No decoded values
+  #endif
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                     // No codes yet
     //ZERO(param);                    // No parameters (should be safe to comment out this line)
@@ -191,7 +199,7 @@ void GCodeParser::parse(char *p) {
 
   // Only use string_arg for these M codes
   if (letter == 'M') switch (codenum) {
-    case 23: case 28: case 30: case 117: case 118: case 928:
+    case 23: case 28: case 30: case 37: case 117: case 118: case 928:
       string_arg = unescape_string(p);
       return;
     default: break;
@@ -278,6 +286,70 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(GCODE_PRETOKENIZE)
+
+  uint8_t GCodeParser::tokenize(const char *p, uint8_t * const out) {
+
+    while (*p == ' ') ++p;
+
+    // Skip N[-0-9] if included in the command line
+    if (*p == 'N' && NUMERIC_SIGNED(p[1])) {
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    // Only G0, G1, G2 and G3, the motion hot path
+    if (*p++ != 'G') return 0;
+    while (*p == ' ') ++p;
+    if (!WITHIN(*p, '0', '3') || NUMERIC(p[1]) || p[1] == '.') return 0;
+    ++p;
+
+    uint32_t bits = 0;
+    uint8_t count = 0;
+    uint8_t * const value = out + sizeof(bits);
+
+    while (*p == ' ') ++p;
+    while (WITHIN(*p, 'A', 'Z')) {
+      const uint8_t ind = LETTER_BIT(*p++);
+      while (*p == ' ') ++p;
+      if (valid_float(p)) {
+
+        // Copy the number alone, 'E' is a parameter and not an exponent
+        char num[16];
+        uint8_t n = 0;
+        while (DECIMAL_SIGNED(*p)) {
+          if (n >= sizeof(num) - 1) return 0;
+          num[n++] = *p++;
+        }
+        num[n] = '\0';
+        const float f = strtof(num, nullptr);
+
+        // Values are kept in letter order
+        const uint8_t pos = __builtin_popcountl(bits & (_BV32(ind) - 1));
+        if (!TEST32(bits, ind)) {
+          if (count >= GCODE_TOKENS_MAX) return 0;
+          memmove(value + (pos + 1) * sizeof(float), value + pos * sizeof(float), (count - pos) * sizeof(float));
+          SBI32(bits, ind);
+          count++;
+          memcpy(value + pos * sizeof(float), &f, sizeof(f));
+        }
+        #if ENABLED(FASTER_GCODE_PARSER)
+          else memcpy(value + pos * sizeof(float), &f, sizeof(f)); // The last one wins, like set()
+        #endif
+      }
+      while (*p == ' ') ++p;
+    }
+
+    // Anything else (checksum, lowercase, strings) is left to the ASCII parser
+    if (*p && *p != '*') return 0;
+
+    memcpy(out, &bits, sizeof(bits));
+    return sizeof(bits) + count * sizeof(float);
+  }
+
+#endif // GCODE_PRETOKENIZE
+
 #if ENABLED(INCH_MODE_SUPPORT)
 
   float GCodeParser::axis_unit_factor(const AxisEnum axis) {
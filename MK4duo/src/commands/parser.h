@@ -29,6 +29,16 @@
 
 //#define DEBUG_GCODE_PARSER
 
+#if ENABLED(GCODE_PRETOKENIZE)
+  /**
+   * Pre-tokenized parameters of a G0-G3 line, stored after the line in the
+   * command buffer: uint32_t letter bitmap followed by one float per letter,
+   * in letter order. At most GCODE_TOKENS_MAX values, otherwise not stored.
+   */
+  #define GCODE_TOKENS_MAX  8
+  #define GCODE_TOKENS_SIZE (sizeof(uint32_t) + GCODE_TOKENS_MAX * sizeof(float))
+#endif
+
 /**
  * Parser Gcode
  *
@@ -36,6 +46,8 @@
  *  - FASTER_GCODE_PARSER:
  *    - Flags existing params (1 bit each)
  *    - Stores value offsets (1 byte each)
+ *  - GCODE_PRETOKENIZE:
+ *    - G0-G3 numeric values decoded once when the line is queued
  *  - Provide accessors for parameters:
  *    - Parameter exists
  *    - Parameter has value
@@ -66,10 +78,18 @@ class GCodeParser {
       static uint8_t subcode;     // .1
     #endif
 
+    #if ENABLED(GCODE_PRETOKENIZE)
+      static const uint8_t *tokens; // Decoded values of the current command, nullptr if none
+    #endif
+
   private: /** Private Parameters */
 
     static char *value_ptr;       // Set by seen, used to fetch the value
 
+    #if ENABLED(GCODE_PRETOKENIZE)
+      static const uint8_t *value_token;  // Set by seen, decoded value or nullptr
+    #endif
+
     #if ENABLED(FASTER_GCODE_PARSER)
       static uint32_t codebits;   // Parameters pre-scanned
       static uint8_t param[26];   // For A-Z, offsets into command args
@@ -88,6 +108,31 @@ class GCodeParser {
 
     #define LETTER_BIT(N) ((N) - 'A')
 
+    #if ENABLED(GCODE_PRETOKENIZE)
+
+      /**
+       * Decode the numeric parameters of a G0-G3 line into out (GCODE_TOKENS_SIZE bytes).
+       * The line is not modified. Return the used size, 0 if the line is not decoded.
+       */
+      static uint8_t tokenize(const char *p, uint8_t * const out);
+
+      // Decoded value of a parameter, nullptr if not decoded
+      FORCE_INLINE static const uint8_t* token_ptr(const uint8_t ind) {
+        if (!tokens || ind >= 26) return nullptr;
+        uint32_t bits;
+        memcpy(&bits, tokens, sizeof(bits));
+        if (!TEST32(bits, ind)) return nullptr;
+        return tokens + sizeof(bits) + sizeof(float) * __builtin_popcountl(bits & (_BV32(ind) - 1));
+      }
+
+      #define SET_VALUE_TOKEN(IND) (value_token = token_ptr(IND))
+
+    #else
+
+      #define SET_VALUE_TOKEN(IND) NOOP
+
+    #endif
+
     FORCE_INLINE static bool valid_signless(const char * const p) {
       return NUMERIC(p[0]) || (p[0] == '.' && NUMERIC(p[1])); // .?[0-9]
     }
@@ -127,6 +172,7 @@ class GCodeParser {
         if (b) {
           char * const ptr = command_ptr + param[ind];
           value_ptr = param[ind] && valid_float(ptr) ? ptr : nullptr;
+          SET_VALUE_TOKEN(ind);
         }
         return b;
       }
@@ -178,7 +224,10 @@ class GCodeParser {
       static inline bool seen(const char c) {
         char *p = strgchr(command_args, c);
         const bool b = !!p;
-        if (b) value_ptr = valid_float(&p[1]) ? &p[1] : nullptr;
+        if (b) {
+          value_ptr = valid_float(&p[1]) ? &p[1] : nullptr;
+          SET_VALUE_TOKEN(LETTER_BIT(c));
+        }
         return b;
       }
 
@@ -207,7 +256,11 @@ class GCodeParser {
     static void parse(char * p);
 
     // Code value pointer was set
-    FORCE_INLINE static bool has_value() { return value_ptr != nullptr; }
+    #if ENABLED(GCODE_PRETOKENIZE)
+      FORCE_INLINE static bool has_value() { return value_ptr != nullptr || value_token != nullptr; }
+    #else
+      FORCE_INLINE static bool has_value() { return value_ptr != nullptr; }
+    #endif
 
     // Seen a parameter with a value
     static inline bool seenval(const char c) { return seen(c) && has_value(); }
@@ -217,6 +270,13 @@ class GCodeParser {
 
     // Float removes 'E' to prevent scientific notation interpretation
     static inline float value_float() {
+      #if ENABLED(GCODE_PRETOKENIZE)
+        if (value_token) {
+          float f;
+          memcpy(&f, value_token, sizeof(f));
+          return f;
+        }
+      #endif
       if (value_ptr) {
         char *e = value_ptr;
         for (;;) {
@@ -236,8 +296,14 @@ class GCodeParser {
     }
 
     // Code value as a long or ulong
-    static inline int32_t   value_long()  { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-    static inline uint32_t  value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+    #if ENABLED(GCODE_PRETOKENIZE)
+      // A binary protocol line has only the decoded value
+      static inline int32_t   value_long()  { return value_ptr ? strtol(value_ptr, nullptr, 10) : value_token ? (int32_t)value_float() : 0L; }
+      static inline uint32_t  value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : value_token ? (uint32_t)value_float() : 0UL; }
+    #else
+      static inline int32_t   value_long()  { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+      static inline uint32_t  value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+    #endif
 
     // Code value for use as time
     static inline millis_l  value_millis()              { return value_ulong(); }
@@ -240,6 +240,14 @@
   #endif
 #endif
 
+/**
+ * Command buffer
+ */
+#if DISABLED(BUFSIZE_LINES)
+  #define BUFSIZE_LINES (BUFSIZE * 4)
+#endif
+#define BUFSIZE_BYTES   (BUFSIZE * MAX_CMD_SIZE)
+
 /**
  * Host keep alive
  */
@@ -744,6 +752,22 @@
   #define COOLER_PWM_FREQUENCY 1000
 #endif
 
+/**
+ * ADC OVERSAMPLING
+ */
+#if DISABLED(HOTEND_ADC_SAMPLES)
+  #define HOTEND_ADC_SAMPLES 16
+#endif
+#if DISABLED(BED_ADC_SAMPLES)
+  #define BED_ADC_SAMPLES 32
+#endif
+#if DISABLED(CHAMBER_ADC_SAMPLES)
+  #define CHAMBER_ADC_SAMPLES 32
+#endif
+#if DISABLED(COOLER_ADC_SAMPLES)
+  #define COOLER_ADC_SAMPLES 32
+#endif
+
 /**
  * ENDSTOPPULLUPS
  */
@@ -845,6 +869,7 @@
 #define HAS_CLASSIC_JERK        (IS_KINEMATIC || DISABLED(JUNCTION_DEVIATION))
 #define HAS_CLASSIC_E_JERK      (DISABLED(LIN_ADVANCE) || DISABLED(JUNCTION_DEVIATION))
 #define HAS_LINEAR_E_JERK       (ENABLED(LIN_ADVANCE) && ENABLED(JUNCTION_DEVIATION))
+#define HAS_LIN_ADVANCE_ISR     (ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING))
 #define HAS_DIST_MM_ARG         (IS_KINEMATIC && ENABLED(JUNCTION_DEVIATION))
 
 /**
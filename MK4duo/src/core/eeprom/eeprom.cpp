@@ -55,7 +55,7 @@
  * Keep this data structure up to date so
  * EEPROM size is known at compile time!
  */
-#define EEPROM_VERSION "MKV80"
+#define EEPROM_VERSION "MKV82"
 #define EEPROM_OFFSET 100
 
 typedef struct EepromDataStruct {
@@ -84,6 +84,13 @@ typedef struct EepromDataStruct {
   //
   stepper_data_t    stepper_data;
 
+  //
+  // Input Shaping data
+  //
+  #if ENABLED(INPUT_SHAPING)
+    shaper_data_t   shaper_data[XY];
+  #endif
+
   //
   // Driver
   //
@@ -339,6 +346,10 @@ void EEPROM::post_process() {
     mechanics.recalculate_max_e_jerk();
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    inputshaping.update();
+  #endif
+
   // Setup Endstops pullup
   endstops.setup_pullup();
 
@@ -453,6 +464,14 @@ void EEPROM::post_process() {
     EEPROM_TEST(stepper_data);
     EEPROM_WRITE(stepper.data);
 
+    //
+    // Input Shaping data
+    //
+    #if ENABLED(INPUT_SHAPING)
+      EEPROM_TEST(shaper_data);
+      EEPROM_WRITE(inputshaping.data);
+    #endif
+
     //
     // Driver data
     //
@@ -857,6 +876,13 @@ void EEPROM::post_process() {
       //
       EEPROM_READ(stepper.data);
 
+      //
+      // Input Shaping data
+      //
+      #if ENABLED(INPUT_SHAPING)
+        EEPROM_READ(inputshaping.data);
+      #endif
+
       //
       // Driver data
       //
@@ -1418,6 +1444,10 @@ void EEPROM::reset() {
     hysteresis.factory_parameters();
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    inputshaping.factory_parameters();
+  #endif
+
   post_process();
 
   SERIAL_LM(ECHO, "Factory Settings Loaded");
@@ -1734,6 +1764,13 @@ void EEPROM::reset() {
      */
     stepper.print_M569();
 
+    /**
+     * Input Shaping M593
+     */
+    #if ENABLED(INPUT_SHAPING)
+      inputshaping.print_M593();
+    #endif
+
     /**
      * Alligator current drivers M906
      */
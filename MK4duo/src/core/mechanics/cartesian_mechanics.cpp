@@ -474,7 +474,8 @@ void Cartesian_Mechanics::do_homing_move(const AxisEnum axis, const float distan
  * Prepare a linear move in a Cartesian setup.
  *
  * When a mesh-based leveling system is active, moves are segmented
- * according to the configuration of the leveling system.
+ * according to the configuration of the leveling system, or queued
+ * whole for the stepper to follow the mesh with MESH_SEGMENT_FREE.
  *
  * Returns true if position[] was set to destination[]
  */
@@ -491,7 +492,11 @@ bool Cartesian_Mechanics::prepare_move_to_destination_mech_specific() {
 
   #if HAS_MESH
     if (bedlevel.flag.leveling_active && bedlevel.leveling_active_at_z(destination.z)) {
-      #if ENABLED(AUTO_BED_LEVELING_UBL)
+      #if ENABLED(MESH_SEGMENT_FREE)
+        // One block, the stepper follows the mesh along it
+        planner.buffer_level_line(position, destination, scaled_fr_mm_s, toolManager.extruder.active);
+        return false;
+      #elif ENABLED(AUTO_BED_LEVELING_UBL)
         ubl.line_to_destination_cartesian(scaled_fr_mm_s, toolManager.extruder.active);
         return true;
       #else
@@ -580,7 +585,7 @@ float Cartesian_Mechanics::axis_home_pos(const AxisEnum axis) {
     case X_AXIS: return x_home_pos(); break;
     case Y_AXIS: return y_home_pos(); break;
     case Z_AXIS: return z_home_pos(); break;
-    default: break;
+    default: return 0;
   }
 }
 
@@ -126,8 +126,9 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
   /**
    * Prepare a linear move in a DELTA setup.
    *
-   * This calls buffer_line several times, adding
-   * small incremental moves for DELTA.
+   * This buffers several small incremental moves
+   * for DELTA, their carriage positions transformed
+   * in batches, or one for a segment-free line.
    */
   bool Delta_Mechanics::prepare_move_to_destination_mech_specific() {
 
@@ -155,6 +156,19 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
     // No E move either? Game over.
     if (UNEAR_ZERO(cartesian_distance)) return true;
 
+    #if ENABLED(DELTA_SEGMENT_FREE)
+      // The stepper follows the line, the leveling still needs the segments
+      #if HAS_LEVELING
+        if (!bedlevel.flag.leveling_active)
+      #endif
+      {
+        planner.flag.delta_line = true;
+        planner.buffer_line(destination, _feedrate_mm_s, toolManager.extruder.active, cartesian_distance);
+        planner.flag.delta_line = false;
+        return false; // caller will update position
+      }
+    #endif
+
     // Minimum number of seconds to move the given distance
     const float seconds = cartesian_distance / _feedrate_mm_s;
 
@@ -183,6 +197,11 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
     // Get the current position as starting point
     xyze_pos_t raw = position;
 
+    // The segment targets and their carriage positions, transformed in batches
+    xyze_pos_t  target[DELTA_TRANSFORM_BATCH];
+    abc_pos_t   carriages[DELTA_TRANSFORM_BATCH];
+    uint8_t     batch_index = 0, batch_count = 0;
+
     // Calculate and execute the segments
     while (--numLines) {
 
@@ -191,8 +210,22 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
 
       raw += segment_distance;
 
-      if (!planner.buffer_line(raw, _feedrate_mm_s, toolManager.extruder.active, cartesian_segment_mm))
-        break;
+      if (batch_index == batch_count) {
+        batch_count = MIN(numLines, uint16_t(DELTA_TRANSFORM_BATCH));
+        batch_index = 0;
+        transform_segments(raw, segment_distance, batch_count, target, carriages);
+      }
+
+      const abc_pos_t &carriage = carriages[batch_index];
+      if (!planner.buffer_segment(carriage.a, carriage.b, carriage.c, target[batch_index].e
+        #if HAS_DIST_MM_ARG
+          , segment_distance
+        #endif
+        , _feedrate_mm_s, toolManager.extruder.active, cartesian_segment_mm
+      )) break;
+
+      planner.position_cart = raw;
+      batch_index++;
 
     }
 
@@ -202,6 +235,49 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
 
   }
 
+  /**
+   * The leveling and the other modifiers move the evenly spaced
+   * targets of a line by the same amount in XY, so the batch
+   * Transform takes them from the first and the last one, and
+   * the Z of the leveling is added to each carriage after.
+   */
+  void Delta_Mechanics::transform_segments(const xyze_pos_t &first, const xyze_float_t &step, const uint8_t count, xyze_pos_t * const target, abc_pos_t * const carriages) {
+
+    xyze_pos_t point = first;
+    LOOP_L_N(i, count) {
+      target[i] = point;
+      #if HAS_POSITION_MODIFIERS
+        planner.apply_modifiers(target[i]);
+      #endif
+      point += step;
+    }
+
+    const xyz_pos_t start = { target[0].x, target[0].y, target[0].z };
+    #if HAS_POSITION_MODIFIERS
+      xyz_pos_t batch_step{0.0f};
+      if (count > 1) {
+        const float inv_steps = 1.0f / float(count - 1);
+        batch_step.set( (target[count - 1].x - start.x) * inv_steps,
+                        (target[count - 1].y - start.y) * inv_steps,
+                        (target[count - 1].z - start.z) * inv_steps);
+      }
+    #else
+      const xyz_pos_t batch_step = { step.x, step.y, step.z };
+    #endif
+
+    Transform(start, batch_step, count, carriages);
+
+    #if HAS_POSITION_MODIFIERS
+      LOOP_L_N(i, count) {
+        const float zadj = target[i].z - (start.z + batch_step.z * i);
+        carriages[i].a += zadj;
+        carriages[i].b += zadj;
+        carriages[i].c += zadj;
+      }
+    #endif
+
+  }
+
 #endif // DISABLED(AUTO_BED_LEVELING_UBL)
 
 /**
@@ -373,12 +449,189 @@ void Delta_Mechanics::Transform(const xyz_pos_t &raw) {
                           raw.z
   };
 
-  delta.a = pos.z + _SQRT(D2.a - sq(pos.x - towerX.a) - sq(pos.y - towerY.a));
-  delta.b = pos.z + _SQRT(D2.b - sq(pos.x - towerX.b) - sq(pos.y - towerY.b));
-  delta.c = pos.z + _SQRT(D2.c - sq(pos.x - towerX.c) - sq(pos.y - towerY.c));
+  carriage_positions(pos, delta);
+
+}
+
+/**
+ * The carriage positions for a position with the hotend offset already applied
+ */
+void Delta_Mechanics::carriage_positions(const xyz_pos_t &pos, abc_pos_t &carriages) {
+  carriages.a = pos.z + _SQRT(D2.a - sq(pos.x - towerX.a) - sq(pos.y - towerY.a));
+  carriages.b = pos.z + _SQRT(D2.b - sq(pos.x - towerX.b) - sq(pos.y - towerY.b));
+  carriages.c = pos.z + _SQRT(D2.c - sq(pos.x - towerX.c) - sq(pos.y - towerY.c));
+}
+
+#if ENABLED(DELTA_FIXED_POINT_TRANSFORM)
+
+  /**
+   * Integer square root rounded to the nearest, shifts and additions only
+   */
+  static uint16_t isqrt32(uint32_t value) {
+    uint32_t root = 0, bit = 1UL << 30;
+    while (bit > value) bit >>= 2;
+    while (bit) {
+      if (value >= root + bit) {
+        value -= root + bit;
+        root = (root >> 1) + bit;
+      }
+      else
+        root >>= 1;
+      bit >>= 2;
+    }
+    if (value > root) root++;
+    return root;
+  }
+
+#endif
+
+/**
+ * Delta Transform of count points evenly spaced on a line,
+ * the point i at first + step * i, results in carriages[i].
+ *
+ * Under each root D2 - r^2 is quadratic in i, two additions
+ * give the next one. The fixed point version steps the XY of
+ * the point in 1/64 mm with 16 fraction bits instead.
+ */
+void Delta_Mechanics::Transform(const xyz_pos_t &first, const xyz_pos_t &step, const uint8_t count, abc_pos_t * const carriages) {
+
+  const xyz_pos_t &offset = nozzle.data.hotend_offset[toolManager.active_hotend()];
+
+  #if ENABLED(DELTA_FIXED_POINT_TRANSFORM)
+
+    const int32_t step_x = LROUND(step.x * 4194304.0f),
+                  step_y = LROUND(step.y * 4194304.0f);
+
+    LOOP_ABC(axis) {
+      const uint32_t d2 = D2[axis] * 4096.0f;
+      int32_t x = LROUND((first.x - offset.x - towerX[axis]) * 4194304.0f),
+              y = LROUND((first.y - offset.y - towerY[axis]) * 4194304.0f);
+      LOOP_L_N(i, count) {
+        const int16_t px = (x + 0x8000L) >> 16,
+                      py = (y + 0x8000L) >> 16;
+        carriages[i][axis] = first.z + step.z * i + isqrt32(d2 - int32_t(px) * px - int32_t(py) * py) * (1.0f / 64.0f);
+        x += step_x;
+        y += step_y;
+      }
+    }
+
+  #else
+
+    const float step2 = sq(step.x) + sq(step.y);
+
+    LOOP_ABC(axis) {
+      const float rx = first.x - offset.x - towerX[axis],
+                  ry = first.y - offset.y - towerY[axis];
+      float s   = D2[axis] - sq(rx) - sq(ry),
+            ds  = -2.0f * (rx * step.x + ry * step.y) - step2;
+      LOOP_L_N(i, count) {
+        carriages[i][axis] = first.z + step.z * i + _SQRT(s);
+        s += ds;
+        ds -= 2.0f * step2;
+      }
+    }
+
+  #endif
 
 }
 
+#if ENABLED(DELTA_SEGMENT_FREE)
+
+  /**
+   * Along a line of unit vector u a carriage moves at
+   *   dH/ds = uz - (r . uxy) / sqrt(D2 - r^2)
+   * with r the horizontal distance from the tower, and |r| is the
+   * largest at one end of the line. The ratio of each carriage
+   * is bound there, the step events are those of the fastest one.
+   * Return the worst ratio, the carriage speed over the line speed.
+   */
+  float Delta_Mechanics::line_step_events(const xyz_pos_t &start, const xyz_pos_t &dist, uint32_t &step_events) {
+
+    step_events = 0;
+    const float length = dist.magnitude();
+    if (UNEAR_ZERO(length)) return 0;
+
+    const float inv_length  = 1.0f / length,
+                uxy         = HYPOT(dist.x, dist.y) * inv_length,
+                uz          = ABS(dist.z) * inv_length;
+
+    float events = 0, worst = 0;
+    LOOP_ABC(axis) {
+      const float r2 = MAX(sq(start.x - towerX[axis]) + sq(start.y - towerY[axis]),
+                           sq(start.x + dist.x - towerX[axis]) + sq(start.y + dist.y - towerY[axis])),
+                  ratio = uz + uxy * SQRT(r2 / (D2[axis] - r2));
+      NOLESS(events, length * MAX(ratio, 1.0f) * data.axis_steps_per_mm[axis]);
+      NOLESS(worst, ratio);
+    }
+
+    step_events = CEIL(events);
+    return worst;
+  }
+
+#endif // DELTA_SEGMENT_FREE
+
+#if ENABLED(DELTA_TRANSFORM_BENCHMARK)
+
+  void Delta_Mechanics::transform_benchmark(const uint16_t count, uint32_t seed) {
+
+    abc_pos_t carriages[DELTA_TRANSFORM_BATCH],
+              reference[DELTA_TRANSFORM_BATCH];
+
+    uint32_t  points = 0, single_us = 0, batch_us = 0;
+    float     max_diff = 0;
+
+    // Xorshift, the same seed gives the same stream of lines
+    NOLESS(seed, 1UL);
+    auto rnd = [&seed](const float lo, const float hi) {
+      seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+      return lo + (hi - lo) * (seed & 0xFFFF) * (1.0f / 65535.0f);
+    };
+
+    // The single Transform leaves its result in delta
+    const abc_pos_t saved_delta = delta;
+
+    for (uint16_t line = 0; line < count; line++) {
+
+      // A short line inside the print radius, cut as the segmented moves do
+      const float radius  = rnd(0, data.print_radius - 1.0f),
+                  angle   = rnd(0, 2.0f * M_PI),
+                  heading = rnd(0, 2.0f * M_PI),
+                  length  = rnd(0.1f, 1.0f);
+      const xyz_pos_t first = { radius * COS(angle), radius * SIN(angle), rnd(0, 50) },
+                      step  = { length * COS(heading), length * SIN(heading), rnd(-0.1f, 0.1f) };
+
+      millis_l start = BENCHMARK_MICROS();
+      xyz_pos_t point = first;
+      LOOP_L_N(i, DELTA_TRANSFORM_BATCH) {
+        Transform(point);
+        reference[i] = delta;
+        point += step;
+      }
+      single_us += BENCHMARK_MICROS() - start;
+
+      start = BENCHMARK_MICROS();
+      Transform(first, step, DELTA_TRANSFORM_BATCH, carriages);
+      batch_us += BENCHMARK_MICROS() - start;
+
+      LOOP_L_N(i, DELTA_TRANSFORM_BATCH) LOOP_ABC(axis)
+        NOLESS(max_diff, ABS(carriages[i][axis] - reference[i][axis]));
+
+      points += DELTA_TRANSFORM_BATCH;
+      if (!(line & 0xFF)) printer.idle();
+    }
+
+    delta = saved_delta;
+
+    SERIAL_MV("Points:", points);
+    SERIAL_MV(" Max diff(mm):", max_diff, 5);
+    SERIAL_MV(" Single(us/point):", float(single_us) / points, 3);
+    SERIAL_MV(" Batch(us/point):", float(batch_us) / points, 3);
+    SERIAL_MV(" Points/s single:", uint32_t(points * 1000000.0f / MAX(single_us, 1UL)));
+    SERIAL_EMV(" batch:", uint32_t(points * 1000000.0f / MAX(batch_us, 1UL)));
+  }
+
+#endif // DELTA_TRANSFORM_BENCHMARK
+
 void Delta_Mechanics::recalc_delta_settings() {
 
   // Get a minimum radius for clamping
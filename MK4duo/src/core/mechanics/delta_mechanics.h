@@ -28,6 +28,9 @@
 
 #pragma once
 
+// Segment targets transformed in one call by the segmented moves
+#define DELTA_TRANSFORM_BATCH 8
+
 // Struct Delta Settings
 typedef struct : public generic_data_t {
 
@@ -97,7 +100,8 @@ class Delta_Mechanics : public Mechanics {
        * Prepare a linear move in a DELTA setup.
        *
        * This calls buffer_line several times, adding
-       * small incremental moves for DELTA.
+       * small incremental moves for DELTA, or once
+       * for a segment-free line.
        */
       static bool prepare_move_to_destination_mech_specific();
     #endif
@@ -149,8 +153,27 @@ class Delta_Mechanics : public Mechanics {
     static void InverseTransform(const float Ha, const float Hb, const float Hc, xyz_pos_t &cartesian);
     FORCE_INLINE static void InverseTransform(const abc_pos_t &pos, xyz_pos_t &cartesian) { InverseTransform(pos.a, pos.b, pos.c, cartesian); }
     static void Transform(const xyz_pos_t &raw);
+    static void Transform(const xyz_pos_t &first, const xyz_pos_t &step, const uint8_t count, abc_pos_t * const carriages);
+    static void carriage_positions(const xyz_pos_t &pos, abc_pos_t &carriages);
     static void recalc_delta_settings();
 
+    #if ENABLED(DELTA_SEGMENT_FREE)
+      /**
+       * Step events for a segment-free line in the machine space,
+       * enough for one step of the fastest carriage on each event.
+       * Return the worst carriage speed over the line speed.
+       */
+      static float line_step_events(const xyz_pos_t &start, const xyz_pos_t &dist, uint32_t &step_events);
+    #endif
+
+    #if ENABLED(DELTA_TRANSFORM_BENCHMARK)
+      /**
+       * Transform a stream of random lines one point at a time and in
+       * batches, report the largest difference and the points per second
+       */
+      static void transform_benchmark(const uint16_t count, uint32_t seed);
+    #endif
+
     /**
      * Home Delta
      */
@@ -233,6 +256,13 @@ class Delta_Mechanics : public Mechanics {
      */
     static void Set_clip_start_height();
 
+    #if DISABLED(AUTO_BED_LEVELING_UBL)
+      /**
+       * The modified targets of count segments from first and their carriage positions
+       */
+      static void transform_segments(const xyze_pos_t &first, const xyze_float_t &step, const uint8_t count, xyze_pos_t * const target, abc_pos_t * const carriages);
+    #endif
+
     #if ENABLED(DELTA_FAST_SQRT) && ENABLED(__AVR__)
       static float Q_rsqrt(float number);
     #endif
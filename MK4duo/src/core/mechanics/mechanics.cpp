@@ -153,7 +153,7 @@ void Mechanics::prepare_move_to_destination() {
     if (mechanics.dual_x_carriage_unpark()) return;
   #endif
 
-  if (!printer.debugSimulation()) { // Simulation Mode no movement
+  if (!printer.debugSimulation() || planner.flag.timing_only) { // Simulation Mode no movement
     if (
       #if UBL_DELTA
         ubl.line_to_destination_segmented(MMS_SCALED(feedrate_mm_s))
@@ -342,6 +342,15 @@
     "DEPENDENCY ERROR: LIN_ADVANCE_K must be a value from 0 to 10."
   );
 #endif
+#if ENABLED(LIN_ADVANCE_SMOOTHING)
+  #if DISABLED(LIN_ADVANCE)
+    #error "DEPENDENCY ERROR: LIN_ADVANCE_SMOOTHING requires LIN_ADVANCE."
+  #elif DISABLED(STEP_SEGMENT_BUFFER)
+    #error "DEPENDENCY ERROR: LIN_ADVANCE_SMOOTHING requires STEP_SEGMENT_BUFFER."
+  #elif DISABLED(LIN_ADVANCE_SMOOTH_TIME)
+    #error "DEPENDENCY ERROR: Missing setting LIN_ADVANCE_SMOOTH_TIME."
+  #endif
+#endif
 
 // Z late enable
 #if MECH(COREXZ) && ENABLED(Z_LATE_ENABLE)
@@ -501,6 +510,23 @@
     #error "DEPENDENCY ERROR: TWO ENDSTOPS for Delta is imposible"
   #endif
 
+  /**
+   * Segment-free moves
+   */
+  #if ENABLED(DELTA_SEGMENT_FREE)
+    #if DISABLED(STEP_SEGMENT_BUFFER)
+      #error "DEPENDENCY ERROR: DELTA_SEGMENT_FREE requires STEP_SEGMENT_BUFFER."
+    #elif ENABLED(AUTO_BED_LEVELING_UBL)
+      #error "DEPENDENCY ERROR: DELTA_SEGMENT_FREE is not compatible with AUTO_BED_LEVELING_UBL."
+    #endif
+  #endif
+
+#elif ENABLED(DELTA_SEGMENT_FREE)
+  #error "DEPENDENCY ERROR: DELTA_SEGMENT_FREE is only for DELTA."
+#elif ENABLED(DELTA_FIXED_POINT_TRANSFORM)
+  #error "DEPENDENCY ERROR: DELTA_FIXED_POINT_TRANSFORM is only for DELTA."
+#elif ENABLED(DELTA_TRANSFORM_BENCHMARK)
+  #error "DEPENDENCY ERROR: DELTA_TRANSFORM_BENCHMARK is only for DELTA."
 #endif // MECH(DELTA)
 
 // Scara settings
@@ -74,6 +74,7 @@ Planner planner;
 plan_flag_t       Planner::flag;
 
 block_t           Planner::block_buffer[BLOCK_BUFFER_SIZE];
+block_plan_t      Planner::block_plan[BLOCK_BUFFER_SIZE];
 
 volatile uint8_t  Planner::block_buffer_head        = 0,
                   Planner::block_buffer_nonbusy     = 0,
@@ -90,6 +91,15 @@ uint8_t           Planner::delay_before_delivering  = 0;
   xyze_pos_t Planner::position_cart{0.0f};
 #endif
 
+#if ENABLED(DELTA_SEGMENT_FREE) || ENABLED(MESH_SEGMENT_FREE)
+  xyz_pos_t Planner::line_start{0.0f},
+            Planner::line_dist{0.0f};
+#endif
+
+#if ENABLED(PID_ADD_EXTRUSION_RATE)
+  volatile float Planner::extrusion_rate = 0.0f;
+#endif
+
 #if HAS_TEMP_HOTEND && ENABLED(AUTOTEMP)
   float Planner::autotemp_max     = 250,
         Planner::autotemp_min     = 210,
@@ -673,7 +683,7 @@ void Planner::init() {
     for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
       block_t* block = &block_buffer[b];
       if (block->steps.x || block->steps.y || block->steps.z) {
-        float se = (float)block->steps.e / block->step_event_count * SQRT(block->nominal_speed_sqr); // mm/sec;
+        float se = (float)block->steps.e / block->step_event_count * SQRT(block_plan[b].nominal_speed_sqr); // mm/sec;
         NOLESS(high, se);
       }
     }
@@ -690,6 +700,33 @@ void Planner::init() {
 /**
  * Manage Axis, paste pressure, etc.
  */
+#if ENABLED(PID_ADD_EXTRUSION_RATE)
+
+  /**
+   * Filament of the extruder over the time of all queued blocks at
+   * their nominal rate. The buffer holds the next second or so of
+   * motion, about the lag of the hotend, so the power rises in time.
+   * Refreshed every 100ms, as often as the temperatures are read.
+   */
+  void Planner::update_extrusion_rate() {
+    static short_timer_t next_update_timer(millis());
+    if (!next_update_timer.expired(100)) return;
+
+    const uint8_t e = toolManager.extruder.active;
+    float e_steps = 0.0f, time = 0.0f;
+    const uint8_t head = block_buffer_head;
+    for (uint8_t b = block_buffer_tail; b != head; b = next_block_index(b)) {
+      const block_t * const block = &block_buffer[b];
+      if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) || !block->nominal_rate) continue;
+      time += float(block->step_event_count) / float(block->nominal_rate);
+      if (block->active_extruder == e && !TEST(block->direction_bits, E_AXIS))
+        e_steps += block->steps.e;
+    }
+    extrusion_rate = (e_steps == 0.0f || time == 0.0f) ? 0.0f : e_steps * extruders[e]->steps_to_mm / time;
+  }
+
+#endif
+
 void Planner::check_axes_activity() {
 
   xyze_bool_t axis_active = { false };
@@ -710,10 +747,10 @@ void Planner::check_axes_activity() {
     #if ENABLED(BARICUDA)
       block = &block_buffer[block_buffer_tail];
       #if HAS_HEATER_HE1
-        tail_valve_pressure = block->valve_pressure;
+        tail_valve_pressure = block_plan[block_buffer_tail].valve_pressure;
       #endif
       #if HAS_HEATER_HE2
-        tail_e_to_p_pressure = block->e_to_p_pressure;
+        tail_e_to_p_pressure = block_plan[block_buffer_tail].e_to_p_pressure;
       #endif
     #endif
 
@@ -822,6 +859,16 @@ void Planner::quick_stop() {
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
+  #if ENABLED(LASER) && ENABLED(LASER_RASTER)
+    // The dropped blocks won't release their raster lines
+    laser.raster_reset();
+  #endif
+
+  #if ENABLED(MOVE_COALESCING)
+    // Nor the moves waiting to be joined
+    coalescer.discard();
+  #endif
+
   // And restart the block delay for the first movement - As the queue was
   // forced to empty, there is no risk the ISR could touch this variable.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
@@ -888,7 +935,14 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 }
 
 void Planner::synchronize() {
-  while (has_blocks_queued() || flag.clean_buffer_flag) {
+  #if ENABLED(MOVE_COALESCING)
+    coalescer.flush();
+  #endif
+  while (has_blocks_queued() || flag.clean_buffer_flag
+    #if ENABLED(INPUT_SHAPING)
+      || inputshaping.busy()
+    #endif
+  ) {
     printer.idle();
     PRINTER_KEEPALIVE(InProcess);
   }
@@ -986,6 +1040,8 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   , feedrate_t fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
 ) {
 
+  block_plan_t * const plan = plan_of(block);
+
   const int32_t dx = target.x - position.x,
                 dy = target.y - position.y,
                 dz = target.z - position.z;
@@ -1007,7 +1063,7 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   #if ENABLED(PREVENT_COLD_EXTRUSION) || ENABLED(PREVENT_LENGTHY_EXTRUDE)
     if (de && printer.mode == PRINTER_MODE_FFF) {
       #if ENABLED(PREVENT_COLD_EXTRUSION)
-        if (tempManager.tooColdToExtrude(extruder)) {
+        if (tempManager.tooColdToExtrude(extruder) && !flag.timing_only) {  // The estimate runs with the heaters off
           position.e = target.e; // Behave as if the move really took place, but ignore E part
           #if HAS_POSITION_FLOAT
             position_float.e = target_float.e;
@@ -1134,13 +1190,13 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   steps_dist_mm.e = esteps_float * extruders[extruder]->steps_to_mm;
 
   if (block->steps.x < MIN_STEPS_PER_SEGMENT && block->steps.y < MIN_STEPS_PER_SEGMENT && block->steps.z < MIN_STEPS_PER_SEGMENT) {
-    block->millimeters = ABS(steps_dist_mm.e);
+    plan->millimeters = ABS(steps_dist_mm.e);
   }
   else {
     if (millimeters)
-      block->millimeters = millimeters;
+      plan->millimeters = millimeters;
     else
-      block->millimeters = SQRT(
+      plan->millimeters = SQRT(
         #if CORE_IS_XY
           sq(steps_dist_mm.head.x) + sq(steps_dist_mm.head.y) + sq(steps_dist_mm.z)
         #elif CORE_IS_XZ
@@ -1161,6 +1217,31 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   block->steps.e = esteps;
   block->step_event_count = MAX(block->steps.x, block->steps.y, block->steps.z, esteps);
 
+  #if ENABLED(DELTA_SEGMENT_FREE)
+    // The step events run along the line, the stepper works out the carriage steps
+    float line_ratio = 0;
+    if (flag.delta_line) {
+      SBI(block->flag, BLOCK_BIT_DELTA_LINE);
+      block->line_start = line_start;
+      block->line_dist  = line_dist;
+      uint32_t line_events;
+      line_ratio = mechanics.line_step_events(line_start, line_dist, line_events);
+      NOLESS(block->step_event_count, line_events);
+    }
+  #endif
+
+  #if ENABLED(MESH_SEGMENT_FREE)
+    // The Z of the mesh between the ends moves Z even with no steps from end to end
+    if (flag.level_line) {
+      SBI(block->flag, BLOCK_BIT_LEVEL_LINE);
+      block->line_start   = line_start;
+      block->line_dist    = line_dist;
+      block->level_start  = bedlevel.get_z_offset(line_start);
+      block->level_end    = bedlevel.get_z_offset(line_start + line_dist);
+      stepper.enable_Z();
+    }
+  #endif
+
   // Bail if this is a zero-length block
   if (printer.mode == PRINTER_MODE_FFF && block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
@@ -1170,8 +1251,8 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   #endif
 
   #if ENABLED(BARICUDA)
-    block->valve_pressure   = printer.baricuda_valve_pressure;
-    block->e_to_p_pressure  = printer.baricuda_e_to_p_pressure;
+    plan->valve_pressure   = printer.baricuda_valve_pressure;
+    plan->e_to_p_pressure  = printer.baricuda_e_to_p_pressure;
   #endif
 
   #if EXTRUDERS > 1
@@ -1314,26 +1395,10 @@ bool Planner::fill_block(block_t * const block, bool split_move,
     // Calculate steps between laser firings (steps_l) and consider that when determining largest
     // interval between steps for X, Y, Z, E, L to feed to the motion control code.
     if (laser.mode == RASTER || laser.mode == PULSED) {
-      block->steps_l = ABS(block->millimeters * laser.ppm);
+      block->steps_l = ABS(plan->millimeters * laser.ppm);
       #if ENABLED(LASER_RASTER)
-        for (uint8_t i = 0; i < LASER_MAX_RASTER_LINE; i++) {
-          // Scale the image intensity based on the raster power.
-          // 100% power on a pixel basis is 255, convert back to 255 = 100.
-          #if ENABLED(LASER_REMAP_INTENSITY)
-            const int NewRange = (laser.rasterlaserpower * 255.0 / 100.0 - LASER_REMAP_INTENSITY);
-            float     NewValue = (float)(((((float)laser.raster_data[i] - 0) * NewRange) / 255.0) + LASER_REMAP_INTENSITY);
-          #else
-            const int NewRange = (laser.rasterlaserpower * 255.0 / 100.0);
-            float     NewValue = (float)(((((float)laser.raster_data[i] - 0) * NewRange) / 255.0));
-          #endif
-
-          #if ENABLED(LASER_REMAP_INTENSITY)
-            // If less than 7%, turn off the laser tube.
-            if (NewValue <= LASER_REMAP_INTENSITY) NewValue = 0;
-          #endif
-
-          block->laser_raster_data[i] = NewValue;
-        }
+        // The line was decoded and scaled by G7, the block only references it
+        if (laser.mode == RASTER) block->raster_line = laser.raster_hold();
       #endif
     }
     else
@@ -1346,7 +1411,7 @@ bool Planner::fill_block(block_t * const block, bool split_move,
 
   #endif // LASER
 
-  const float inverse_millimeters = 1.0f / block->millimeters;  // Inverse millimeters to remove multiple divides
+  const float inverse_millimeters = 1.0f / plan->millimeters;  // Inverse millimeters to remove multiple divides
 
   // Calculate inverse time for this move. No divide by zero due to previous checks.
   // Example: At 120mm/s a 60mm move takes 0.5s. So this will give 2.0.
@@ -1380,13 +1445,13 @@ bool Planner::fill_block(block_t * const block, bool split_move,
     if (isr_enabled) DISABLE_STEPPER_INTERRUPT();
 
     block_buffer_runtime_us += segment_time_us;
-    block->segment_time_us = segment_time_us;
+    plan->segment_time_us = segment_time_us;
 
     // Reenable Stepper ISR
     if (isr_enabled) ENABLE_STEPPER_INTERRUPT();
   #endif
 
-  block->nominal_speed_sqr = sq(block->millimeters * inverse_secs);   //   (mm/sec)^2 Always > 0
+  plan->nominal_speed_sqr = sq(plan->millimeters * inverse_secs);   //   (mm/sec)^2 Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -1433,6 +1498,17 @@ bool Planner::fill_block(block_t * const block, bool split_move,
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(DELTA_SEGMENT_FREE)
+    // Along the line a carriage runs up to the worst ratio times the line speed
+    if (line_ratio > 0) {
+      const float line_speed = plan->millimeters * inverse_secs;
+      LOOP_XYZ(axis) {
+        const float max_fr = mechanics.data.max_feedrate_mm_s[axis] / line_ratio;
+        if (line_speed > max_fr) NOMORE(speed_factor, max_fr / line_speed);
+      }
+    }
+  #endif
+
   // Max segment time in µs.
   #if ENABLED(XY_FREQUENCY_LIMIT)
 
@@ -1475,7 +1551,7 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   if (speed_factor < 1.0f) {
     current_speed *= speed_factor;
     block->nominal_rate *= speed_factor;
-    block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
+    plan->nominal_speed_sqr = plan->nominal_speed_sqr * sq(speed_factor);
   }
 
   // Compute and limit the acceleration rate for the trapezoid generator.
@@ -1510,9 +1586,9 @@ bool Planner::fill_block(block_t * const block, bool split_move,
                               && de > 0;
 
       if (block->use_advance_lead) {
-        block->e_D_ratio = (target_float.e - position_float.e) /
+        plan->e_D_ratio = (target_float.e - position_float.e) /
           #if IS_KINEMATIC
-            block->millimeters
+            plan->millimeters
           #else
             SQRT(sq(target_float.x - position_float.x)
                + sq(target_float.y - position_float.y)
@@ -1522,13 +1598,15 @@ bool Planner::fill_block(block_t * const block, bool split_move,
 
         // Check for unusual high e_D ratio to detect if a retract move was combined with the last print move due to min. steps per segment. Never execute this with advance!
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
-        if (block->e_D_ratio > 3.0f)
+        if (plan->e_D_ratio > 3.0f)
           block->use_advance_lead = false;
+        #if HAS_LIN_ADVANCE_ISR
         else {
-          const uint32_t max_accel_steps_per_s2 = extruders[extruder]->data.max_jerk / (extruders[extruder]->data.advance_K * block->e_D_ratio) * steps_per_mm;
+          const uint32_t max_accel_steps_per_s2 = extruders[extruder]->data.max_jerk / (extruders[extruder]->data.advance_K * plan->e_D_ratio) * steps_per_mm;
           if (printer.debugFeature() && accel > max_accel_steps_per_s2) DEBUG_EM("Acceleration limited.");
           NOMORE(accel, max_accel_steps_per_s2);
         }
+        #endif
       }
     #endif
 
@@ -1558,16 +1636,28 @@ bool Planner::fill_block(block_t * const block, bool split_move,
       }
     }
   }
-  block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
+
+  #if ENABLED(DELTA_SEGMENT_FREE)
+    // And so does its acceleration
+    if (line_ratio > 0) LOOP_XYZ(axis) {
+      const float max_accel = mechanics.data.max_acceleration_mm_per_s2[axis] / line_ratio * steps_per_mm;
+      if (accel > max_accel) accel = max_accel;
+    }
+  #endif
+
+  plan->acceleration_steps_per_s2 = accel;
+  plan->acceleration = accel / steps_per_mm;
+  #if ENABLED(FIXED_POINT_TRAPEZOID)
+    calculate_trapezoid_factors(block, plan);
+  #endif
   #if DISABLED(BEZIER_JERK_CONTROL)
     block->acceleration_rate = (uint32_t)(accel * (4096.0f * 4096.0f / (STEPPER_TIMER_RATE)));
   #endif
-  #if ENABLED(LIN_ADVANCE)
+  #if HAS_LIN_ADVANCE_ISR
     if (block->use_advance_lead) {
-      block->advance_speed = (STEPPER_TIMER_RATE) / (extruders[extruder]->data.advance_K * block->e_D_ratio * block->acceleration * extruders[extruder]->data.axis_steps_per_mm);
+      block->advance_speed = (STEPPER_TIMER_RATE) / (extruders[extruder]->data.advance_K * plan->e_D_ratio * plan->acceleration * extruders[extruder]->data.axis_steps_per_mm);
       if (printer.debugFeature()) {
-        if (extruders[extruder]->data.advance_K * block->e_D_ratio * block->acceleration * 2 < SQRT(block->nominal_speed_sqr) * block->e_D_ratio)
+        if (extruders[extruder]->data.advance_K * plan->e_D_ratio * plan->acceleration * 2 < SQRT(plan->nominal_speed_sqr) * plan->e_D_ratio)
           DEBUG_EM("More than 2 steps per eISR loop executed.");
         if (block->advance_speed < 200)
           DEBUG_EM("eISR running at > 10kHz.");
@@ -1619,25 +1709,25 @@ bool Planner::fill_block(block_t * const block, bool split_move,
         xyze_float_t junction_unit_vec = unit_vec - previous_unit_vec;
         normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
+        const float junction_acceleration = limit_value_by_axis_maximum(plan->acceleration, junction_unit_vec),
                     sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
 
         vmax_junction_sqr = (junction_acceleration * mechanics.data.junction_deviation_mm * sin_theta_d2) / (1.0f - sin_theta_d2);
-        if (block->millimeters < 1) {
+        if (plan->millimeters < 1) {
 
           // Fast acos approximation, minus the error bar to be safe
           const float junction_theta = (RADIANS(-40) * sq(junction_cos_theta) - RADIANS(50)) * junction_cos_theta + RADIANS(90) - 0.18f;
 
           // If angle is greater than 135 degrees (octagon), find speed for approximate arc
           if (junction_theta > RADIANS(135)) {
-            const float limit_sqr = block->millimeters / (RADIANS(180) - junction_theta) * junction_acceleration;
+            const float limit_sqr = plan->millimeters / (RADIANS(180) - junction_theta) * junction_acceleration;
             NOMORE(vmax_junction_sqr, limit_sqr);
           }
         }
       }
 
       // Get the lowest speed
-      vmax_junction_sqr = MIN(vmax_junction_sqr, block->nominal_speed_sqr, previous_nominal_speed_sqr);
+      vmax_junction_sqr = MIN(vmax_junction_sqr, plan->nominal_speed_sqr, previous_nominal_speed_sqr);
     }
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
       vmax_junction_sqr = 0;
@@ -1648,7 +1738,7 @@ bool Planner::fill_block(block_t * const block, bool split_move,
 
   #if HAS_CLASSIC_JERK
 
-    const float nominal_speed = SQRT(block->nominal_speed_sqr);
+    const float nominal_speed = SQRT(plan->nominal_speed_sqr);
 
     // Exit speed limited by a jerk to full halt of a previous last segment
     static float previous_safe_speed;
@@ -1743,14 +1833,14 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   #endif // Classic Jerk Limiting
 
   // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
+  plan->max_entry_speed_sqr = vmax_junction_sqr;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(MINIMUM_PLANNER_SPEED), block->millimeters);
+  const float v_allowable_sqr = max_allowable_speed_sqr(-plan->acceleration, sq(MINIMUM_PLANNER_SPEED), plan->millimeters);
 
   // If we are trying to add a split block, start with the
   // max. allowed speed to avoid an interrupted first move.
-  block->entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : MIN(vmax_junction_sqr, v_allowable_sqr);
+  plan->entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : MIN(vmax_junction_sqr, v_allowable_sqr);
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -1760,11 +1850,11 @@ bool Planner::fill_block(block_t * const block, bool split_move,
   // block nominal speed limits both the current and next maximum junction speeds. Hence, in both
   // the reverse and forward planners, the corresponding block junction speed will always be at the
   // the maximum junction speed and may always be ignored for any speed reduction checks.
-  block->flag |= block->nominal_speed_sqr <= v_allowable_sqr ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
+  block->flag |= plan->nominal_speed_sqr <= v_allowable_sqr ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
-  previous_nominal_speed_sqr = block->nominal_speed_sqr;
+  previous_nominal_speed_sqr = plan->nominal_speed_sqr;
 
   // Update the position
   position = target;
@@ -1796,6 +1886,7 @@ void Planner::buffer_sync_block() {
 
   // Clear block
   memset(block, 0, sizeof(block_t));
+  memset(plan_of(block), 0, sizeof(block_plan_t));
 
   block->flag = BLOCK_FLAG_SYNC_POSITION;
 
@@ -1852,7 +1943,7 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
   #endif
 
   // DRYRUN or Simulation prevents E moves from taking place
-  if (printer.debugDryrun() || printer.debugSimulation()) {
+  if ((printer.debugDryrun() || printer.debugSimulation()) && !flag.timing_only) {
     position.e = target.e;
     #if HAS_POSITION_FLOAT
       position_float.e = e;
@@ -1888,7 +1979,7 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
   //*/
 
   // Simulation Mode no movement
-  if (printer.debugSimulation()) position = target;
+  if (printer.debugSimulation() && !flag.timing_only) position = target;
 
   // Queue the movement
   if (!buffer_steps(target
@@ -1942,6 +2033,19 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
 
     mechanics.Transform(raw);
 
+    #if ENABLED(DELTA_SEGMENT_FREE)
+      if (flag.delta_line) {
+        // The line from the last position, in the space of the carriages
+        xyze_pos_t start = position_cart;
+        #if HAS_POSITION_MODIFIERS
+          apply_modifiers(start);
+        #endif
+        const xyz_pos_t &offset = nozzle.data.hotend_offset[toolManager.active_hotend()];
+        line_start.set(start.x - offset.x, start.y - offset.y, start.z);
+        line_dist.set(raw.x - start.x, raw.y - start.y, raw.z - start.z);
+      }
+    #endif
+
     #if ENABLED(SCARA_FEEDRATE_SCALING)
       // For SCARA scale the feed rate from mm/s to degrees/s
       // i.e., Complete the angular vector in the given time.
@@ -1971,6 +2075,27 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
 
 }
 
+#if ENABLED(MESH_SEGMENT_FREE)
+
+  bool Planner::buffer_level_line(const xyze_pos_t &start, const xyze_pos_t &cart, const feedrate_t &fr_mm_s, const uint8_t extruder) {
+
+    line_start.set(start.x, start.y, start.z);
+    line_dist.set(cart.x - start.x, cart.y - start.y, cart.z - start.z);
+
+    xyze_pos_t target = cart;
+    #if ENABLED(AUTO_BED_LEVELING_UBL)
+      // The planner leaves UBL out, level the end here
+      bedlevel.apply_leveling(target);
+    #endif
+
+    flag.level_line = true;
+    const bool queued = buffer_line(target, fr_mm_s, extruder);
+    flag.level_line = false;
+    return queued;
+  }
+
+#endif
+
 /**
  * Directly set the planner ABC position (and stepper positions)
  * converting mm (or angles for SCARA) into steps.
@@ -2088,10 +2213,172 @@ void Planner::refresh_positioning() {
 
 #endif
 
+#if ENABLED(FIXED_POINT_TRAPEZOID)
+
+  /**
+   * Differences of the fixed point trapezoids from the float ones,
+   * more than one step or one step/s is a mismatch
+   */
+  static struct {
+    uint32_t  blocks, mismatch, max_steps_diff, max_rate_diff;
+
+    void reset() { blocks = mismatch = max_steps_diff = max_rate_diff = 0; }
+
+    void add(const block_t * const block, const uint32_t accelerate_until, const uint32_t decelerate_after, const uint32_t initial_rate, const uint32_t final_rate) {
+      const uint32_t  steps_diff = MAX(ABS(int32_t(block->accelerate_until - accelerate_until)),
+                                       ABS(int32_t(block->decelerate_after - decelerate_after))),
+                      rate_diff  = MAX(ABS(int32_t(block->initial_rate - initial_rate)),
+                                       ABS(int32_t(block->final_rate - final_rate)));
+      NOLESS(max_steps_diff, steps_diff);
+      NOLESS(max_rate_diff, rate_diff);
+      if (steps_diff > 1 || rate_diff > 1) mismatch++;
+      blocks++;
+    }
+
+    void report() {
+      SERIAL_MV("Blocks:", blocks);
+      SERIAL_MV(" Mismatch:", mismatch);
+      SERIAL_MV(" Max diff steps:", max_steps_diff);
+      SERIAL_MV(" rate:", max_rate_diff);
+    }
+  } trapezoid_diff;
+
+  void Planner::trapezoid_benchmark(const uint16_t count, uint32_t seed) {
+
+    // The buffer is empty, its blocks are free to use as scratch
+    synchronize();
+
+    uint32_t  accelerate_until[BLOCK_BUFFER_SIZE],
+              decelerate_after[BLOCK_BUFFER_SIZE],
+              initial_rate[BLOCK_BUFFER_SIZE],
+              final_rate[BLOCK_BUFFER_SIZE];
+    float     entry_factor[BLOCK_BUFFER_SIZE],
+              entry_speed_sqr[BLOCK_BUFFER_SIZE],
+              exit_speed_sqr[BLOCK_BUFFER_SIZE];
+
+    uint32_t  float_us = 0, fixed_us = 0;
+
+    trapezoid_diff.reset();
+
+    // Xorshift, the same seed gives the same stream of blocks
+    NOLESS(seed, 1UL);
+    auto rnd = [&seed](const float lo, const float hi) {
+      seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+      return lo + (hi - lo) * (seed & 0xFFFF) * (1.0f / 65535.0f);
+    };
+
+    while (trapezoid_diff.blocks < count) {
+
+      // A buffer of blocks at rates the fixed point generator takes
+      LOOP_L_N(i, BLOCK_BUFFER_SIZE) {
+        block_t * const block = &block_buffer[i];
+        block_plan_t * const plan = &block_plan[i];
+        const float steps_per_mm    = rnd(5, 3200),
+                    millimeters     = rnd(0.02f, 40),
+                    nominal_speed   = rnd(1, MIN(300.0f, 65000.0f / steps_per_mm)),
+                    inverse_secs    = nominal_speed / millimeters;
+        block->step_event_count       = MAX(1UL, uint32_t(millimeters * steps_per_mm));
+        block->nominal_rate           = CEIL(block->step_event_count * inverse_secs);
+        plan->nominal_speed_sqr       = sq(millimeters * inverse_secs);
+        plan->acceleration_steps_per_s2 = rnd(50, 10000) * steps_per_mm;
+        calculate_trapezoid_factors(block, plan);
+        entry_factor[i]    = rnd(0, 1);
+        entry_speed_sqr[i] = plan->nominal_speed_sqr * sq(entry_factor[i]);
+        exit_speed_sqr[i]  = plan->nominal_speed_sqr * sq(rnd(0, 1));
+      }
+
+      // The float generator pays the roots of recalculate_trapezoids(), the entry one is carried over
+      millis_l start = BENCHMARK_MICROS();
+      LOOP_L_N(i, BLOCK_BUFFER_SIZE) {
+        block_t * const block = &block_buffer[i];
+        const float nomr = 1.0f / SQRT(block_plan[i].nominal_speed_sqr);
+        calculate_trapezoid_float(block, entry_factor[i], SQRT(exit_speed_sqr[i]) * nomr);
+        accelerate_until[i] = block->accelerate_until;
+        decelerate_after[i] = block->decelerate_after;
+        initial_rate[i]     = block->initial_rate;
+        final_rate[i]       = block->final_rate;
+      }
+      float_us += BENCHMARK_MICROS() - start;
+
+      start = BENCHMARK_MICROS();
+      LOOP_L_N(i, BLOCK_BUFFER_SIZE)
+        calculate_trapezoid_fixed(&block_buffer[i], entry_speed_sqr[i], exit_speed_sqr[i]);
+      fixed_us += BENCHMARK_MICROS() - start;
+
+      LOOP_L_N(i, BLOCK_BUFFER_SIZE)
+        trapezoid_diff.add(&block_buffer[i], accelerate_until[i], decelerate_after[i], initial_rate[i], final_rate[i]);
+
+      printer.idle();
+    }
+
+    const uint32_t blocks = trapezoid_diff.blocks;
+    trapezoid_diff.report();
+    SERIAL_MV(" Float(us/block):", float(float_us) / blocks, 2);
+    SERIAL_MV(" Fixed(us/block):", float(fixed_us) / blocks, 2);
+    SERIAL_MV(" Cycles/block float:", uint32_t(float(float_us) / blocks * (F_CPU / 1000000UL)));
+    SERIAL_EMV(" fixed:", uint32_t(float(fixed_us) / blocks * (F_CPU / 1000000UL)));
+  }
+
+  void Planner::trapezoid_check(const bool onoff) {
+    if (onoff) {
+      trapezoid_diff.reset();
+      flag.trapezoid_check = true;
+    }
+    else {
+      // The blocks still queued are checked as they are planned
+      synchronize();
+      flag.trapezoid_check = false;
+      trapezoid_diff.report();
+      SERIAL_EOL();
+    }
+  }
+
+#endif // ENABLED(FIXED_POINT_TRAPEZOID)
+
 /** Private Function */
+#if ENABLED(BEZIER_JERK_CONTROL)
+  /**
+   * Time of a speed change at constant acceleration, in STEP timer counts
+   */
+  static FORCE_INLINE uint32_t speed_change_time(const uint32_t delta_rate, const int32_t accel) {
+    return ((float)delta_rate / accel) * (STEPPER_TIMER_RATE);
+  }
+#endif
+
 /**
- * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
- * by the provided factors.
+ * Store the trapezoid in the block, with the Bezier times if needed
+ */
+static FORCE_INLINE void store_trapezoid(block_t* const block, const uint32_t initial_rate, const uint32_t final_rate,
+  const uint32_t accelerate_steps, const uint32_t plateau_steps
+  #if ENABLED(BEZIER_JERK_CONTROL)
+    , const uint32_t cruise_rate, const uint32_t acceleration_time, const uint32_t deceleration_time
+  #endif
+) {
+
+  #if ENABLED(BEZIER_JERK_CONTROL)
+    // Jerk controlled speed requires to express speed versus time, NOT steps,
+    // and to offload calculations from the ISR, we also calculate the inverse of those times here
+    uint32_t  acceleration_time_inverse = get_period_inverse(acceleration_time),
+              deceleration_time_inverse = get_period_inverse(deceleration_time);
+  #endif
+
+  // Store new block parameters
+  block->accelerate_until = accelerate_steps;
+  block->decelerate_after = accelerate_steps + plateau_steps;
+  block->initial_rate = initial_rate;
+  #if ENABLED(BEZIER_JERK_CONTROL)
+    block->acceleration_time = acceleration_time;
+    block->deceleration_time = deceleration_time;
+    block->acceleration_time_inverse = acceleration_time_inverse;
+    block->deceleration_time_inverse = deceleration_time_inverse;
+    block->cruise_rate = cruise_rate;
+  #endif
+  block->final_rate = final_rate;
+
+}
+
+/**
+ * Calculate trapezoid parameters for the entry and exit speeds, in (mm/sec)^2.
  **
  * ############ VERY IMPORTANT ############
  * NOTE that the PRECONDITION to call this function is that the block is
@@ -2101,7 +2388,7 @@ void Planner::refresh_positioning() {
  */
 #define MINIMAL_STEP_RATE 120
 
-void Planner::calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor) {
+void Planner::calculate_trapezoid_float(block_t* const block, const float &entry_factor, const float &exit_factor) {
 
   uint32_t initial_rate = CEIL(entry_factor * block->nominal_rate),
            final_rate   = CEIL(exit_factor  * block->nominal_rate); // (steps per second)
@@ -2114,7 +2401,7 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
     uint32_t cruise_rate = initial_rate;
   #endif
 
-  const int32_t accel = block->acceleration_steps_per_s2;
+  const int32_t accel = plan_of(block)->acceleration_steps_per_s2;
 
             // Steps required for acceleration, deceleration to/from nominal rate
   uint32_t  accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
@@ -2141,30 +2428,247 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
       cruise_rate = block->nominal_rate;
   #endif
 
-  #if ENABLED(BEZIER_JERK_CONTROL)
-    // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t  acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-              deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE);
+  store_trapezoid(block, initial_rate, final_rate, accelerate_steps, plateau_steps
+    #if ENABLED(BEZIER_JERK_CONTROL)
+      , cruise_rate, speed_change_time(cruise_rate - initial_rate, accel), speed_change_time(cruise_rate - final_rate, accel)
+    #endif
+  );
 
-    // And to offload calculations from the ISR, we also calculate the inverse of those times here
-    uint32_t  acceleration_time_inverse = get_period_inverse(acceleration_time),
-              deceleration_time_inverse = get_period_inverse(deceleration_time);
-  #endif
+}
 
-  // Store new block parameters
-  block->accelerate_until = accelerate_steps;
-  block->decelerate_after = accelerate_steps + plateau_steps;
-  block->initial_rate = initial_rate;
-  #if ENABLED(BEZIER_JERK_CONTROL)
-    block->acceleration_time = acceleration_time;
-    block->deceleration_time = deceleration_time;
-    block->acceleration_time_inverse = acceleration_time_inverse;
-    block->deceleration_time_inverse = deceleration_time_inverse;
-    block->cruise_rate = cruise_rate;
-  #endif
-  block->final_rate = final_rate;
+#if ENABLED(BEZIER_JERK_PLANNING)
 
-}
+  /**
+   * Highest speed reachable from 'speed' within 'distance' with a Bézier speed change.
+   * When the acceleration is the limit the curve averages 8/15 of it, so the classic
+   * formula holds with that acceleration. For smaller speed changes the jerk is the limit and
+   * the distance is (v + dv/2) * sqrt(k dv), with k = 10/sqrt(3)/jerk: with u = sqrt(dv)
+   * it is a convex cubic, solved by Newton from the acceleration limited speed above.
+   */
+  float Planner::bezier_max_speed(const float &accel, const float &jerk, const float &speed, const float &distance) {
+    const float accel_speed = SQRT(sq(speed) + 2 * (accel / (BEZIER_PEAK_ACCEL)) * distance);
+    if (accel_speed - speed >= (BEZIER_PEAK_JERK) / sq(BEZIER_PEAK_ACCEL) * sq(accel) / jerk) return accel_speed;
+
+    const float c = distance * SQRT(jerk / (BEZIER_PEAK_JERK));
+    float u = SQRT(accel_speed - speed);
+    LOOP_L_N(i, 4) u -= (u * (0.5f * sq(u) + speed) - c) / (1.5f * sq(u) + speed);
+    return speed + sq(u);
+  }
+
+  /**
+   * Trapezoid of Bézier speed changes, for the entry and exit factors of the nominal speed.
+   * The acceleration and deceleration take the times of the curve and the cruise
+   * rate of a block too short to reach its nominal rate is the highest that fits.
+   * Same preconditions as calculate_trapezoid_float().
+   */
+  void Planner::calculate_trapezoid_bezier(block_t* const block, const float &entry_factor, const float &exit_factor) {
+
+    const block_plan_t * const plan = plan_of(block);
+
+    uint32_t  initial_rate = CEIL(entry_factor * block->nominal_rate),
+              final_rate   = CEIL(exit_factor  * block->nominal_rate);
+
+    // A junction with a block on other axes can be faster than this block
+    NOMORE(initial_rate,  block->nominal_rate);
+    NOMORE(final_rate,    block->nominal_rate);
+
+    // Limit minimal step rate (Otherwise the timer will overflow.)
+    NOLESS(initial_rate,  uint32_t(MINIMAL_STEP_RATE));
+    NOLESS(final_rate,    uint32_t(MINIMAL_STEP_RATE));
+
+    // Acceleration and jerk in steps
+    const float accel = plan->acceleration_steps_per_s2,
+                jerk  = float(BEZIER_MAX_JERK) * accel / plan->acceleration,
+                steps = block->step_event_count;
+
+    auto change_time = [&](const float rate1, const float rate2) {
+      return bezier_time(ABS(rate2 - rate1), accel, jerk);
+    };
+    auto change_steps = [&](const float rate1, const float rate2) {
+      return 0.5f * (rate1 + rate2) * change_time(rate1, rate2);
+    };
+
+    float cruise_rate = block->nominal_rate;
+    bool cruise = true;
+
+    // No cruising: bisect the highest rate from which the block can still brake to final_rate
+    if (change_steps(initial_rate, cruise_rate) + change_steps(cruise_rate, final_rate) > steps) {
+      cruise = false;
+      float low = MAX(initial_rate, final_rate), high = cruise_rate;
+      LOOP_L_N(i, 12) {
+        const float mid = 0.5f * (low + high);
+        if (change_steps(initial_rate, mid) + change_steps(mid, final_rate) > steps)
+          high = mid;
+        else
+          low = mid;
+      }
+      cruise_rate = low;
+    }
+
+    // Without cruise the steps left by the rounding brake, or the stepper would run them at the nominal rate
+    const uint32_t  accelerate_steps = MIN(uint32_t(CEIL(change_steps(initial_rate, cruise_rate))), block->step_event_count),
+                    decelerate_steps = cruise
+                      ? MIN(uint32_t(FLOOR(change_steps(cruise_rate, final_rate))), block->step_event_count - accelerate_steps)
+                      : block->step_event_count - accelerate_steps;
+
+    store_trapezoid(block, initial_rate, final_rate, accelerate_steps, block->step_event_count - accelerate_steps - decelerate_steps,
+      cruise_rate, change_time(initial_rate, cruise_rate) * (STEPPER_TIMER_RATE), change_time(cruise_rate, final_rate) * (STEPPER_TIMER_RATE)
+    );
+
+  }
+
+#endif // ENABLED(BEZIER_JERK_PLANNING)
+
+#if ENABLED(FIXED_POINT_TRAPEZOID)
+
+  /**
+   * Square root of a 32 bit integer, rounded down, one result bit per loop
+   */
+  static uint32_t isqrt32(uint32_t x) {
+    uint32_t res = 0, one = 1UL << 30;
+    while (one > x) one >>= 2;
+    while (one) {
+      if (x >= res + one) {
+        x -= res + one;
+        res = (res >> 1) + one;
+      }
+      else
+        res >>= 1;
+      one >>= 2;
+    }
+    return res;
+  }
+
+  /**
+   * Quotient of n by 2 * acceleration, from the reciprocal of the block.
+   * The estimate is never above the quotient and at most 2 below it.
+   */
+  static FORCE_INLINE uint32_t div_accel_2(const uint32_t n, const uint32_t a2, const uint32_t a2_inv, uint32_t &rem) {
+    uint32_t q = (uint64_t(n) * a2_inv) >> 32;
+    rem = n - q * a2;
+    while (rem >= a2) { rem -= a2; q++; }
+    return q;
+  }
+
+  /**
+   * Step rate for a speed in (mm/sec)^2, rounded up as the float version does
+   */
+  static FORCE_INLINE uint32_t rate_for_speed_sqr(const block_t* const block, const block_plan_t* const plan, const float &speed_sqr) {
+    const float rate_sqr = speed_sqr * plan->rate_sqr_per_speed_sqr;
+    if (rate_sqr >= float(sq(uint32_t(block->nominal_rate)))) return block->nominal_rate;
+    const uint32_t x = rate_sqr, r = isqrt32(x);
+    return r * r < x ? r + 1 : r;
+  }
+
+  /**
+   * Once per block, when its nominal rate and acceleration are set
+   */
+  void Planner::calculate_trapezoid_factors(const block_t* const block, block_plan_t* const plan) {
+    plan->rate_sqr_per_speed_sqr = sq(float(block->nominal_rate)) / plan->nominal_speed_sqr;
+    const uint32_t a2 = plan->acceleration_steps_per_s2 << 1;
+    plan->accel_2_inv = a2 ? 0xFFFFFFFF / a2 : 0;
+  }
+
+  /**
+   * Same trapezoid as calculate_trapezoid_float() in integer math, for a block
+   * with a nominal rate up to 65535 steps/s: with the rates squared the steps
+   * to accelerate are (v1^2 - v0^2) / 2a, divided with the reciprocal of 2a.
+   */
+  void Planner::calculate_trapezoid_fixed(block_t* const block, const float &entry_speed_sqr, const float &exit_speed_sqr) {
+
+    const block_plan_t * const plan = plan_of(block);
+
+    uint32_t  initial_rate = rate_for_speed_sqr(block, plan, entry_speed_sqr),
+              final_rate   = rate_for_speed_sqr(block, plan, exit_speed_sqr);
+
+    // Limit minimal step rate (Otherwise the timer will overflow.)
+    NOLESS(initial_rate,  uint32_t(MINIMAL_STEP_RATE));
+    NOLESS(final_rate,    uint32_t(MINIMAL_STEP_RATE));
+
+    const uint32_t  nominal_rate_sqr  = uint32_t(block->nominal_rate) * block->nominal_rate,
+                    initial_rate_sqr  = initial_rate * initial_rate,
+                    final_rate_sqr    = final_rate * final_rate,
+                    step_event_count  = block->step_event_count,
+                    a2                = plan->acceleration_steps_per_s2 << 1,
+                    a2_inv            = plan->accel_2_inv;
+
+    uint32_t  accelerate_steps = 0,
+              decelerate_steps = 0,
+              rem;
+
+    #if ENABLED(BEZIER_JERK_CONTROL)
+      uint32_t cruise_rate = block->nominal_rate;
+    #endif
+
+    // Steps required for acceleration, deceleration to/from nominal rate
+    if (a2) {
+      if (nominal_rate_sqr > initial_rate_sqr) {
+        accelerate_steps = div_accel_2(nominal_rate_sqr - initial_rate_sqr, a2, a2_inv, rem);
+        if (rem) accelerate_steps++;
+      }
+      if (nominal_rate_sqr > final_rate_sqr)
+        decelerate_steps = div_accel_2(nominal_rate_sqr - final_rate_sqr, a2, a2_inv, rem);
+    }
+
+    // Steps between acceleration and deceleration, if any
+    uint32_t plateau_steps = 0;
+
+    // No cruising: accelerate until the braking reaches final_rate at the end, that is
+    // ceil((N + (vf^2 - vi^2) / 2a) / 2), with the quotient and remainder of the division
+    if (accelerate_steps + decelerate_steps <= step_event_count)
+      plateau_steps = step_event_count - accelerate_steps - decelerate_steps;
+    else {
+      accelerate_steps = 0;
+      if (a2) {
+        const bool faster = final_rate_sqr >= initial_rate_sqr;
+        uint32_t q = div_accel_2(faster ? final_rate_sqr - initial_rate_sqr : initial_rate_sqr - final_rate_sqr, a2, a2_inv, rem);
+        if (faster) {
+          if (q >= step_event_count)
+            accelerate_steps = step_event_count;
+          else {
+            const uint32_t t = step_event_count + q;
+            accelerate_steps = (t & 1) ? (t + 1) >> 1 : (t >> 1) + (rem ? 1 : 0);
+          }
+        }
+        else {
+          if (rem) { q++; rem = a2 - rem; }
+          if (q <= step_event_count) {
+            const uint32_t t = step_event_count - q;
+            accelerate_steps = (t & 1) ? (t + 1) >> 1 : (t >> 1) + (rem ? 1 : 0);
+          }
+        }
+        NOMORE(accelerate_steps, step_event_count);
+      }
+
+      #if ENABLED(BEZIER_JERK_CONTROL)
+        // We won't reach the cruising rate. Let's calculate the speed we will reach
+        const uint64_t cruise_rate_sqr = initial_rate_sqr + uint64_t(a2) * accelerate_steps;
+        cruise_rate = isqrt32(cruise_rate_sqr < 0xFFFFFFFFUL ? uint32_t(cruise_rate_sqr) : 0xFFFFFFFFUL);
+      #endif
+    }
+
+    store_trapezoid(block, initial_rate, final_rate, accelerate_steps, plateau_steps
+      #if ENABLED(BEZIER_JERK_CONTROL)
+        , cruise_rate, speed_change_time(cruise_rate - initial_rate, plan->acceleration_steps_per_s2), speed_change_time(cruise_rate - final_rate, plan->acceleration_steps_per_s2)
+      #endif
+    );
+
+  }
+
+  /**
+   * Fixed point trapezoid of a planned block, compared with the float one (M962 P1)
+   */
+  void Planner::calculate_trapezoid_checked(block_t* const block, const float &entry_factor, const float &exit_factor, const float &entry_speed_sqr, const float &exit_speed_sqr) {
+    calculate_trapezoid_float(block, entry_factor, exit_factor);
+    const uint32_t  accelerate_until  = block->accelerate_until,
+                    decelerate_after  = block->decelerate_after,
+                    initial_rate      = block->initial_rate,
+                    final_rate        = block->final_rate;
+    calculate_trapezoid_fixed(block, entry_speed_sqr, exit_speed_sqr);
+    trapezoid_diff.add(block, accelerate_until, decelerate_after, initial_rate, final_rate);
+  }
+
+#endif // ENABLED(FIXED_POINT_TRAPEZOID)
 
 /*                            PLANNER SPEED DEFINITION
                                      +--------+   <- current->nominal_speed
@@ -2232,15 +2736,17 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 void Planner::reverse_pass_kernel(block_t* const current_block, const block_t* const next_block) {
 
   if (current_block) {
+    block_plan_t * const current_plan = plan_of(current_block);
+
     // If entry speed is already at the maximum entry speed, and there was no change of speed
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
     // compute anything for this block,
     // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
-    const float max_entry_speed_sqr = current_block->max_entry_speed_sqr;
+    const float max_entry_speed_sqr = current_plan->max_entry_speed_sqr;
 
     // Compute maximum entry speed decelerating over the current block from its exit speed.
     // If not at the maximum entry speed, or the previous block entry speed changed
-    if (current_block->entry_speed_sqr != max_entry_speed_sqr || (next_block && TEST(next_block->flag, BLOCK_BIT_RECALCULATE))) {
+    if (current_plan->entry_speed_sqr != max_entry_speed_sqr || (next_block && TEST(next_block->flag, BLOCK_BIT_RECALCULATE))) {
 
       // If nominal length true, max junction speed is guaranteed to be reached.
       // If a block can de/ac-celerate from nominal speed to zero within the length of the block, then
@@ -2252,8 +2758,8 @@ void Planner::reverse_pass_kernel(block_t* const current_block, const block_t* c
 
       const float new_entry_speed_sqr = TEST(current_block->flag, BLOCK_BIT_NOMINAL_LENGTH)
         ? max_entry_speed_sqr
-        : MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current_block->acceleration, next_block ? next_block->entry_speed_sqr : sq(MINIMUM_PLANNER_SPEED), current_block->millimeters));
-      if (current_block->entry_speed_sqr != new_entry_speed_sqr) {
+        : MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current_plan->acceleration, next_block ? plan_of(next_block)->entry_speed_sqr : sq(MINIMUM_PLANNER_SPEED), current_plan->millimeters));
+      if (current_plan->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
         // ISR does not consume the block before being recalculated
@@ -2271,7 +2777,7 @@ void Planner::reverse_pass_kernel(block_t* const current_block, const block_t* c
         else {
           // Block is not BUSY, we won the race against the Stepper ISR:
           // Just Set the new entry speed
-          current_block->entry_speed_sqr = new_entry_speed_sqr;
+          current_plan->entry_speed_sqr = new_entry_speed_sqr;
         }
       }
     }
@@ -2282,18 +2788,21 @@ void Planner::reverse_pass_kernel(block_t* const current_block, const block_t* c
 void Planner::forward_pass_kernel(const block_t* const previous_block, block_t* const current_block, const uint8_t block_index) {
 
   if (previous_block) {
+    const block_plan_t * const previous_plan = plan_of(previous_block);
+    block_plan_t * const current_plan = plan_of(current_block);
+
     // If the previous block is an acceleration block, too short to complete the full speed
     // change, adjust the entry speed accordingly. Entry speeds have already been reset,
     // maximized, and reverse-planned. If nominal length is set, max junction speed is
     // guaranteed to be reached. No need to recheck.
     if (!TEST(previous_block->flag, BLOCK_BIT_NOMINAL_LENGTH) &&
-      previous_block->entry_speed_sqr < current_block->entry_speed_sqr) {
+      previous_plan->entry_speed_sqr < current_plan->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous_block->acceleration, previous_block->entry_speed_sqr, previous_block->millimeters);
+      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous_plan->acceleration, previous_plan->entry_speed_sqr, previous_plan->millimeters);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
-      if (new_entry_speed_sqr < current_block->entry_speed_sqr) {
+      if (new_entry_speed_sqr < current_plan->entry_speed_sqr) {
 
         // Mark we need to recompute the trapezoidal shape, and do it now,
         // so the stepper ISR does not consume the block before being recalculated
@@ -2313,7 +2822,7 @@ void Planner::forward_pass_kernel(const block_t* const previous_block, block_t*
           // Block is not BUSY, we won the race against the Stepper ISR:
 
           // Always <= max_entry_speed_sqr. Backward pass sets this.
-          current_block->entry_speed_sqr = new_entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
+          current_plan->entry_speed_sqr = new_entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
 
           // Set optimal plan pointer.
           block_buffer_planned = block_index;
@@ -2325,7 +2834,7 @@ void Planner::forward_pass_kernel(const block_t* const previous_block, block_t*
     // point in the buffer. When the plan is bracketed by either the beginning of the
     // buffer and a maximum entry speed or two maximum entry speeds, every block in between
     // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-    if (current_block->entry_speed_sqr == current_block->max_entry_speed_sqr)
+    if (current_plan->entry_speed_sqr == current_plan->max_entry_speed_sqr)
       block_buffer_planned = block_index;
   }
 }
@@ -2454,6 +2963,10 @@ void Planner::recalculate_trapezoids() {
           *next_block     = nullptr;
   float   current_entry_speed = 0.0,
           next_entry_speed    = 0.0;
+  #if ENABLED(FIXED_POINT_TRAPEZOID)
+    float current_entry_speed_sqr = 0.0,
+          next_entry_speed_sqr    = 0.0;
+  #endif
 
   while (block_index != head_block_index) {
 
@@ -2461,7 +2974,10 @@ void Planner::recalculate_trapezoids() {
 
     // Skip sync blocks
     if (!TEST(next_block->flag, BLOCK_BIT_SYNC_POSITION)) {
-      next_entry_speed = SQRT(next_block->entry_speed_sqr);
+      #if ENABLED(FIXED_POINT_TRAPEZOID)
+        next_entry_speed_sqr = plan_of(next_block)->entry_speed_sqr;
+      #endif
+      next_entry_speed = SQRT(plan_of(next_block)->entry_speed_sqr);
 
       if (current_block) {
         // Recalculate if current block entry or exit junction speed has changed.
@@ -2479,14 +2995,21 @@ void Planner::recalculate_trapezoids() {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
             // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float current_nominal_speed = SQRT(current_block->nominal_speed_sqr),
-                        nomr = 1.0f / current_nominal_speed;
-            calculate_trapezoid_for_block(current_block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
+            const float current_nominal_speed = SQRT(plan_of(current_block)->nominal_speed_sqr),
+                        nomr = 1.0f / current_nominal_speed,
+                        // A classic jerk junction may allow the safe speed of the next block,
+                        // above the nominal speed of this one. The block ends at its nominal speed.
+                        exit_speed = MIN(next_entry_speed, current_nominal_speed);
+            calculate_trapezoid_for_block(current_block, current_entry_speed * nomr, exit_speed * nomr
+              #if ENABLED(FIXED_POINT_TRAPEZOID)
+                , current_entry_speed_sqr, MIN(next_entry_speed_sqr, plan_of(current_block)->nominal_speed_sqr)
+              #endif
+            );
+            #if HAS_LIN_ADVANCE_ISR
               if (current_block->use_advance_lead) {
-                const float comp = current_block->e_D_ratio * extruders[toolManager.extruder.active]->data.advance_K * extruders[toolManager.extruder.active]->data.axis_steps_per_mm;
+                const float comp = plan_of(current_block)->e_D_ratio * extruders[toolManager.extruder.active]->data.advance_K * extruders[toolManager.extruder.active]->data.axis_steps_per_mm;
                 current_block->max_adv_steps = current_nominal_speed * comp;
-                current_block->final_adv_steps = next_entry_speed * comp;
+                current_block->final_adv_steps = exit_speed * comp;
               }
             #endif
           }
@@ -2499,6 +3022,9 @@ void Planner::recalculate_trapezoids() {
 
       current_block = next_block;
       current_entry_speed = next_entry_speed;
+      #if ENABLED(FIXED_POINT_TRAPEZOID)
+        current_entry_speed_sqr = next_entry_speed_sqr;
+      #endif
     }
 
     block_index = next_block_index(block_index);
@@ -2518,12 +3044,16 @@ void Planner::recalculate_trapezoids() {
     if (!stepper.is_block_busy(current_block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float next_nominal_speed = SQRT(next_block->nominal_speed_sqr),
+      const float next_nominal_speed = SQRT(plan_of(next_block)->nominal_speed_sqr),
                   nomr = 1.0f / next_nominal_speed;
-      calculate_trapezoid_for_block(next_block, next_entry_speed * nomr, (MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
+      calculate_trapezoid_for_block(next_block, next_entry_speed * nomr, (MINIMUM_PLANNER_SPEED) * nomr
+        #if ENABLED(FIXED_POINT_TRAPEZOID)
+          , next_entry_speed_sqr, sq(float(MINIMUM_PLANNER_SPEED))
+        #endif
+      );
+      #if HAS_LIN_ADVANCE_ISR
         if (next_block->use_advance_lead) {
-          const float comp = next_block->e_D_ratio * extruders[toolManager.extruder.active]->data.advance_K * extruders[toolManager.extruder.active]->data.axis_steps_per_mm;
+          const float comp = plan_of(next_block)->e_D_ratio * extruders[toolManager.extruder.active]->data.advance_K * extruders[toolManager.extruder.active]->data.axis_steps_per_mm;
           next_block->max_adv_steps = next_nominal_speed * comp;
           next_block->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
         }
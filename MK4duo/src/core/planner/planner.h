@@ -36,10 +36,10 @@ union plan_flag_t {
     bool  clean_buffer_flag     : 1;  // A flag to disable queuing of blocks
     bool  abort_on_endstop_hit  : 1;  // Abort when endstop hit
     bool  autotemp_enabled      : 1;  // Autotemp
-    bool  bit3                  : 1;
-    bool  bit4                  : 1;
-    bool  bit5                  : 1;
-    bool  bit6                  : 1;
+    bool  timing_only           : 1;  // The print time estimate times the blocks, the stepper leaves them
+    bool  delta_line            : 1;  // The next line is one segment-free block for the delta carriages
+    bool  level_line            : 1;  // The next line is one block over the mesh, the stepper adds its Z
+    bool  trapezoid_check       : 1;  // M962 P1, every fixed point trapezoid is checked against the float one
     bool  bit7                  : 1;
   };
   plan_flag_t() { all = 0x00; }
@@ -53,18 +53,12 @@ union plan_flag_t {
  *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
+ *
+ * Only the fields read by the Stepper ISR are here, widest first so
+ * there is no padding. The look-ahead state is in block_plan_t.
  */
 typedef struct block_t {
 
-  volatile uint8_t flag;                    // Block flags (See BlockFlagEnum enum above) - Modified by ISR and main thread!
-
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
   union {
     xyze_ulong_t steps;                     // Step count along each axis
     xyze_long_t position;                   // New position to force when this sync block is executed
@@ -72,12 +66,6 @@ typedef struct block_t {
 
   uint32_t step_event_count;                // The number of step events required to complete this block
 
-  uint8_t active_extruder;                  // The extruder to move (if E move)
-
-  #if ENABLED(COLOR_MIXING_EXTRUDER)
-    mixer_color_t b_color[MIXING_STEPPERS]; // Normalized color for the mixing steppers
-  #endif
-
   // Settings for the trapezoid generator
   uint32_t  accelerate_until,               // The index of the step event on which to stop acceleration
             decelerate_after;               // The index of the step event on which to start decelerating
@@ -92,51 +80,109 @@ typedef struct block_t {
     uint32_t  acceleration_rate;            // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block
+  uint32_t  nominal_rate,                   // The nominal step rate for this block in step_events/sec
+            initial_rate,                   // The jerk-adjusted step rate at start of block
+            final_rate;                     // The minimal rate at exit
+
+  #if ENABLED(DELTA_SEGMENT_FREE) || ENABLED(MESH_SEGMENT_FREE)
+    xyz_pos_t line_start,                   // The cartesian line of a segment-free block, hotend offset applied for delta,
+              line_dist;                    // not leveled over the mesh
+  #endif
+
+  #if ENABLED(MESH_SEGMENT_FREE)
+    float     level_start,                  // Z of the mesh at the ends of the line
+              level_end;
+  #endif
+
+  #if ENABLED(LASER)
+    float     laser_intensity;  // Laser firing instensity in clock cycles for the PWM timer
+    uint32_t  laser_duration,   // Laser firing duration in microseconds, for pulsed and raster firing modes
+              steps_l;          // Step count between firings of the laser, for pulsed firing mode
+  #endif
+
+  #if HAS_SD_RESTART
+    uint32_t sdpos;
+  #endif
+
+  #if ENABLED(COLOR_MIXING_EXTRUDER)
+    mixer_color_t b_color[MIXING_STEPPERS]; // Normalized color for the mixing steppers
+  #endif
 
   // Advance extrusion
-  #if ENABLED(LIN_ADVANCE)
-    bool      use_advance_lead;
+  #if HAS_LIN_ADVANCE_ISR
     uint16_t  advance_speed,                // STEP timer value for extruder speed offset ISR
               max_adv_steps,                // max. advance steps to get cruising speed pressure (not always nominal_speed!)
               final_adv_steps;              // advance steps due to exit speed
-    float     e_D_ratio;
   #endif
 
-  uint32_t  nominal_rate,                   // The nominal step rate for this block in step_events/sec
-            initial_rate,                   // The jerk-adjusted step rate at start of block
-            final_rate,                     // The minimal rate at exit
-            acceleration_steps_per_s2;      // acceleration steps/sec^2
+  volatile uint8_t flag;                    // Block flags (See BlockFlagEnum enum above) - Modified by ISR and main thread!
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
-  #endif
+  uint8_t active_extruder,                  // The extruder to move (if E move)
+          direction_bits;                   // The direction bit set for this block
 
-  #if HAS_SPI_LCD
-    uint32_t segment_time_us;
+  #if ENABLED(LIN_ADVANCE)
+    bool      use_advance_lead;
   #endif
 
   #if ENABLED(LASER)
     uint8_t   laser_mode;       // CONTINUOUS, PULSED, RASTER
     bool      laser_status;     // LASER_OFF, LASER_ON
-    float     laser_ppm,        // pulses per millimeter, for pulsed and raster firing modes
-              laser_intensity;  // Laser firing instensity in clock cycles for the PWM timer
-    uint32_t  laser_duration,   // Laser firing duration in microseconds, for pulsed and raster firing modes
-              steps_l;          // Step count between firings of the laser, for pulsed firing mode
-
     #if ENABLED(LASER_RASTER)
-      unsigned char laser_raster_data[LASER_MAX_RASTER_LINE];
+      uint8_t raster_line;      // Line of the laser raster pool burnt by this block
     #endif
   #endif
 
-  #if HAS_SD_RESTART
-    uint32_t sdpos;
+} block_t;
+
+/**
+ * struct block_plan_t
+ *
+ * The planner side of a block, never read by the Stepper ISR.
+ * Planner::block_plan holds it at the index of the block in the buffer.
+ */
+typedef struct block_plan_t {
+
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
+
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(FIXED_POINT_TRAPEZOID)
+    float     rate_sqr_per_speed_sqr;       // (steps/mm)^2, from a speed squared to a step rate squared
+    uint32_t  accel_2_inv;                  // 2^32 / (2 * acceleration_steps_per_s2)
   #endif
 
-} block_t;
+  #if ENABLED(LIN_ADVANCE)
+    float e_D_ratio;
+  #endif
+
+  #if HAS_SPI_LCD
+    uint32_t segment_time_us;
+  #endif
+
+  #if ENABLED(LASER)
+    float laser_ppm;                        // pulses per millimeter, for pulsed and raster firing modes
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
+} block_plan_t;
 
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
 
+#if ENABLED(BEZIER_JERK_PLANNING)
+  // Peaks of the Bézier speed curve for a change dv in a time T:
+  // acceleration 15/8 dv/T and jerk 10/sqrt(3) dv/T^2
+  #define BEZIER_PEAK_ACCEL 1.875f
+  #define BEZIER_PEAK_JERK  5.7735027f
+#endif
+
 class Planner {
 
   public: /** Constructor */
@@ -161,6 +207,7 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t          block_buffer[BLOCK_BUFFER_SIZE];
+    static block_plan_t     block_plan[BLOCK_BUFFER_SIZE];    // Look-ahead state, same index as block_buffer
     static volatile uint8_t block_buffer_head,        // Index of the next block to be pushed
                             block_buffer_nonbusy,     // Index of the first non busy block
                             block_buffer_planned,     // Index of the optimally planned block
@@ -175,6 +222,15 @@ class Planner {
       static xyze_pos_t position_cart;
     #endif
 
+    #if ENABLED(DELTA_SEGMENT_FREE) || ENABLED(MESH_SEGMENT_FREE)
+      static xyz_pos_t  line_start,   // The line of the next segment-free block
+                        line_dist;
+    #endif
+
+    #if ENABLED(PID_ADD_EXTRUSION_RATE)
+      static volatile float extrusion_rate;   // Planned extrusion speed of the active extruder, for the hotend PID
+    #endif
+
     #if HAS_TEMP_HOTEND && ENABLED(AUTOTEMP)
       static float  autotemp_min,
                     autotemp_max,
@@ -238,6 +294,15 @@ class Planner {
      */
     static void check_axes_activity();
 
+    #if ENABLED(PID_ADD_EXTRUSION_RATE)
+      /**
+       * Set extrusion_rate to the filament speed in mm/s that the queued
+       * blocks plan for the active extruder. Called from the main loop,
+       * the hotend PID reads the result in the temperature interrupt.
+       */
+      static void update_extrusion_rate();
+    #endif
+
     #if ENABLED(FWRETRACT)
 
       static void apply_retract(float &rz, float &e);
@@ -298,6 +363,11 @@ class Planner {
      */
     FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - moves_planned(); }
 
+    /**
+     * The look-ahead state of a block
+     */
+    FORCE_INLINE static block_plan_t* plan_of(const block_t * const block) { return &block_plan[block - block_buffer]; }
+
     /**
      * Planner::get_next_free_block
      *
@@ -424,6 +494,17 @@ class Planner {
       );
     }
 
+    #if ENABLED(MESH_SEGMENT_FREE)
+      /**
+       * Add a move over the mesh as one block, leveled at its ends.
+       * The stepper adds the Z of the mesh between them.
+       *
+       *  start       - the cartesian position before the move
+       *  cart        - the target position
+       */
+      static bool buffer_level_line(const xyze_pos_t &start, const xyze_pos_t &cart, const feedrate_t &fr_mm_s, const uint8_t extruder);
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -543,7 +624,7 @@ class Planner {
         if (TEST(block->flag, BLOCK_BIT_RECALCULATE)) return nullptr;
 
         #if HAS_SPI_LCD
-          block_buffer_runtime_us -= block->segment_time_us; // We can't be sure how long an active block will take, so don't count it.
+          block_buffer_runtime_us -= block_plan[block_buffer_tail].segment_time_us; // We can't be sure how long an active block will take, so don't count it.
         #endif
 
         // As this block is busy, advance the nonbusy block pointer
@@ -565,6 +646,52 @@ class Planner {
       return nullptr;
     }
 
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+
+      /**
+       * The oldest block not handed to the stepper yet. nullptr if there is none.
+       * This also marks the block as busy. The delivery delay is counted down by the ISR.
+       * WARNING: Called from the segment preparation, Stepper ISR context included!
+       */
+      static block_t* get_next_block() {
+
+        // All the queued moves are busy?
+        if (block_buffer_nonbusy == block_buffer_head) {
+          #if HAS_SPI_LCD
+            if (!moves_planned()) clear_block_buffer_runtime(); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+          #endif
+          return nullptr;
+        }
+
+        // If the number of movements queued is less than 3, and there is still time
+        //  to wait, do not deliver anything
+        if (delay_before_delivering) {
+          if (moves_planned() < 3) return nullptr;
+          delay_before_delivering = 0;
+        }
+
+        block_t * const block = &block_buffer[block_buffer_nonbusy];
+
+        // No trapezoid calculated? Don't execute yet.
+        if (TEST(block->flag, BLOCK_BIT_RECALCULATE)) return nullptr;
+
+        #if HAS_SPI_LCD
+          block_buffer_runtime_us -= block_plan[block_buffer_nonbusy].segment_time_us; // We can't be sure how long an active block will take, so don't count it.
+        #endif
+
+        // Push block_buffer_planned pointer, if encountered.
+        const uint8_t next = next_block_index(block_buffer_nonbusy);
+        if (block_buffer_nonbusy == block_buffer_planned)
+          block_buffer_planned = next;
+
+        // As this block is busy, advance the nonbusy block pointer
+        block_buffer_nonbusy = next;
+
+        return block;
+      }
+
+    #endif
+
     #if HAS_SPI_LCD
 
       static uint16_t block_buffer_runtime() {
@@ -614,6 +741,20 @@ class Planner {
       static void autotemp_M104_M109();
     #endif
 
+    #if ENABLED(FIXED_POINT_TRAPEZOID)
+      /**
+       * Run the float and the fixed point trapezoid generators over a stream
+       * of random blocks, report the differences and the time per block
+       */
+      static void trapezoid_benchmark(const uint16_t count, uint32_t seed);
+
+      /**
+       * Start checking the trapezoid of every planned block against the
+       * float generator, or stop and report the differences
+       */
+      static void trapezoid_check(const bool onoff);
+    #endif
+
   private: /** Private Function */
 
     /**
@@ -650,9 +791,25 @@ class Planner {
      * 'distance'.
      */
     static float max_allowable_speed_sqr(const float &accel, const float &target_velocity_sqr, const float &distance) {
-      return target_velocity_sqr - 2 * accel * distance;
+      #if ENABLED(BEZIER_JERK_PLANNING)
+        return sq(bezier_max_speed(ABS(accel), BEZIER_MAX_JERK, SQRT(target_velocity_sqr), distance));
+      #else
+        return target_velocity_sqr - 2 * accel * distance;
+      #endif
     }
 
+    #if ENABLED(BEZIER_JERK_PLANNING)
+      /**
+       * Time of a Bézier speed change of 'delta_speed', with the peak
+       * acceleration within 'accel' and the peak jerk within 'jerk'
+       */
+      static float bezier_time(const float &delta_speed, const float &accel, const float &jerk) {
+        return MAX(BEZIER_PEAK_ACCEL * delta_speed / accel, SQRT(BEZIER_PEAK_JERK * delta_speed / jerk));
+      }
+      static float bezier_max_speed(const float &accel, const float &jerk, const float &speed, const float &distance);
+      static void calculate_trapezoid_bezier(block_t* const block, const float &entry_factor, const float &exit_factor);
+    #endif
+
     #if ENABLED(BEZIER_JERK_CONTROL)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -662,7 +819,35 @@ class Planner {
       }
     #endif
 
-    static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
+    static void calculate_trapezoid_float(block_t* const block, const float &entry_factor, const float &exit_factor);
+
+    #if ENABLED(FIXED_POINT_TRAPEZOID)
+      static void calculate_trapezoid_factors(const block_t* const block, block_plan_t* const plan);
+      static void calculate_trapezoid_fixed(block_t* const block, const float &entry_speed_sqr, const float &exit_speed_sqr);
+      static void calculate_trapezoid_checked(block_t* const block, const float &entry_factor, const float &exit_factor, const float &entry_speed_sqr, const float &exit_speed_sqr);
+    #endif
+
+    /**
+     * Set the trapezoid of a block for its entry and exit factors of the nominal speed.
+     * The fixed point generator takes the entry and exit speeds in (mm/sec)^2.
+     */
+    FORCE_INLINE static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor
+      #if ENABLED(FIXED_POINT_TRAPEZOID)
+        , const float &entry_speed_sqr, const float &exit_speed_sqr
+      #endif
+    ) {
+      #if ENABLED(BEZIER_JERK_PLANNING)
+        return calculate_trapezoid_bezier(block, entry_factor, exit_factor);
+      #endif
+      #if ENABLED(FIXED_POINT_TRAPEZOID)
+        // Step rates squared must fit in 32 bits
+        if (block->nominal_rate <= 0xFFFFUL) {
+          if (flag.trapezoid_check) return calculate_trapezoid_checked(block, entry_factor, exit_factor, entry_speed_sqr, exit_speed_sqr);
+          return calculate_trapezoid_fixed(block, entry_speed_sqr, exit_speed_sqr);
+        }
+      #endif
+      calculate_trapezoid_float(block, entry_factor, exit_factor);
+    }
 
     static void reverse_pass_kernel(block_t* const current_block, const block_t* const next_block);
     static void forward_pass_kernel(const block_t* const previous_block, block_t* const current_block, const uint8_t block_index);
@@ -358,6 +358,7 @@ void Printer::zero_fan_speed() {
 
 /**
  * Manage several activities:
+ *  - Step segment preparation
  *  - Lcd update
  *  - Keep the command buffer full
  *  - Host Keepalive
@@ -376,6 +377,10 @@ void Printer::zero_fan_speed() {
  */
 void Printer::idle(const bool no_stepper_sleep/*=false*/) {
 
+  #if ENABLED(HAL_IDLETASK)
+    HAL::idletask();
+  #endif
+
   #if ENABLED(SPI_ENDSTOPS)
     if (endstops.tmc_spi_homing.any
       #if ENABLED(IMPROVE_HOMING_RELIABILITY)
@@ -387,8 +392,26 @@ void Printer::idle(const bool no_stepper_sleep/*=false*/) {
     }
   #endif
 
+  #if ENABLED(STEP_SEGMENT_BUFFER)
+    stepper.prepare_segments();
+    stepper.report_underruns();
+  #endif
+
   lcdui.update();
 
+  #if ENABLED(STEP_SEGMENT_BUFFER)
+    // The display update can be long
+    stepper.prepare_segments();
+  #endif
+
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    printtime.idle();
+  #endif
+
+  #if ENABLED(PID_ADD_EXTRUSION_RATE)
+    planner.update_extrusion_rate();
+  #endif
+
   #if HAS_POWER_CHECK
     powerManager.outage();
   #endif
@@ -435,6 +458,10 @@ void Printer::idle(const bool no_stepper_sleep/*=false*/) {
     babystep.spin();
   #endif
 
+  #if ENABLED(STEP_TIMELINE)
+    steptimeline.spin();
+  #endif
+
   // Prevent steppers timing-out in the middle of M600
   #if ENABLED(ADVANCED_PAUSE_FEATURE) && ENABLED(PAUSE_PARK_NO_STEPPER_TIMEOUT)
     #define MOVE_AWAY_TEST !advancedpause.did_pause_print
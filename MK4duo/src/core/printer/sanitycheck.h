@@ -118,6 +118,12 @@
 #if DISABLED(BUFSIZE)
   #error "DEPENDENCY ERROR: Missing setting BUFSIZE."
 #endif
+#if BUFSIZE_LINES < BUFSIZE || BUFSIZE_LINES > 127
+  #error "DEPENDENCY ERROR: BUFSIZE_LINES must be from BUFSIZE to 127."
+#endif
+#if BUFSIZE_BYTES > 32767
+  #error "DEPENDENCY ERROR: BUFSIZE * MAX_CMD_SIZE must be less than 32768."
+#endif
 #if ENABLED(SERIAL_XON_XOFF) && RX_BUFFER_SIZE < 1024
   #error "DEPENDENCY ERROR: For SERIAL_XON_XOFF set RX_BUFFER_SIZE to 1024 or more."
 #endif
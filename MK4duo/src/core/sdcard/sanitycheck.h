@@ -36,6 +36,13 @@
   #if DISABLED(SD_FINISHED_RELEASECOMMAND)
     #error "DEPENDENCY ERROR: Missing setting SD_FINISHED_RELEASECOMMAND."
   #endif
+  #if ENABLED(SD_READ_AHEAD)
+    #if DISABLED(SD_READ_AHEAD_BLOCKS)
+      #error "DEPENDENCY ERROR: Missing setting SD_READ_AHEAD_BLOCKS."
+    #elif SD_READ_AHEAD_BLOCKS < 1 || SD_READ_AHEAD_BLOCKS > 8
+      #error "DEPENDENCY ERROR: SD_READ_AHEAD_BLOCKS must be from 1 to 8."
+    #endif
+  #endif
 #elif ENABLED(EEPROM_SETTINGS) && ENABLED(EEPROM_SD)
   #error "DEPENDENCY ERROR: You have to enable SDSUPPORT || USB_FLASH_DRIVE_SUPPORT to use EEPROM_SD."
 #endif
@@ -53,6 +53,15 @@ char  SDCard::fileName[LONG_FILENAME_LENGTH*SD_MAX_FOLDER_DEPTH+SD_MAX_FOLDER_DE
 /** Private Parameters */
 uint16_t SDCard::nrFile_index = 0;
 
+#if ENABLED(SD_READ_AHEAD)
+  char      SDCard::stream_buffer[2][SD_READ_AHEAD_SIZE];
+  uint16_t  SDCard::stream_length[2]  = { 0 },
+            SDCard::stream_index      = 0;
+  uint8_t   SDCard::stream_front      = 0;
+  uint32_t  SDCard::stream_filepos    = 0;
+  bool      SDCard::stream_new        = true;
+#endif
+
 #if HAS_EEPROM_SD
   SdFile SDCard::eeprom_file;
 #endif
@@ -267,10 +276,9 @@ void SDCard::write_command(char* buf) {
     begin = strchr(npos, ' ') + 1;
     end = strchr(npos, '*') - 1;
   }
-  end[1] = '\r';
-  end[2] = '\n';
-  end[3] = '\0';
-  gcode_file.write(begin);
+  // The line is written as it lies in the command buffer, the next line may follow it
+  gcode_file.write(begin, end - begin + 1);
+  gcode_file.write("\r\n", 2);
   if (gcode_file.getWriteError()) {
     SERIAL_LM(ER, STR_SD_ERR_WRITE_TO_FILE);
   }
@@ -280,6 +288,9 @@ void SDCard::print_status() {
   if (isPrinting()) {
     SERIAL_MV(STR_SD_PRINTING_BYTE, sdpos);
     SERIAL_EMV(STR_SD_SLASH, fileSize);
+    #if ENABLED(PRINT_TIME_ESTIMATE)
+      printtime.print_status();
+    #endif
   }
   else
     SERIAL_EM(STR_SD_NOT_PRINTING);
@@ -464,6 +475,10 @@ bool SDCard::selectFile(const char * const path, const bool silent/*=false*/) {
       parsejson(gcode_file);
     #endif
 
+    #if ENABLED(SD_READ_AHEAD)
+      stream_reset();
+    #endif
+
     return true;
   }
   else {
@@ -472,6 +487,39 @@ bool SDCard::selectFile(const char * const path, const bool silent/*=false*/) {
   }
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Unparsed bytes of the printing file, up to the end of the front buffer.
+   * When it is used up the other buffer becomes the front, it is read now
+   * only if stream_prefetch() did not fill it already.
+   * Return nullptr at the end of file or on a read error.
+   */
+  const char* SDCard::stream_get(uint16_t &len) {
+    stream_new = false;
+    if (stream_index >= stream_length[stream_front]) {
+      stream_length[stream_front] = 0;
+      stream_front ^= 1;
+      stream_index = 0;
+      if (!stream_length[stream_front] && !stream_fill(stream_front)) return nullptr;
+    }
+    len = stream_length[stream_front] - stream_index;
+    return len ? &stream_buffer[stream_front][stream_index] : nullptr;
+  }
+
+  /**
+   * Read the next blocks into the back buffer, called when
+   * the command buffer is full so that the SPI transfer is
+   * not on the path of the next command.
+   */
+  void SDCard::stream_prefetch() {
+    const uint8_t back = stream_front ^ 1;
+    if (!stream_length[back] && stream_filepos < fileSize && stream_length[stream_front])
+      stream_fill(back);
+  }
+
+#endif
+
 int8_t SDCard::updir() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
@@ -841,6 +889,30 @@ uint16_t SDCard::get_num_Files() {
 #endif
 
 /** Private Function */
+#if ENABLED(SD_READ_AHEAD)
+
+  void SDCard::stream_reset() {
+    stream_length[0] = stream_length[1] = stream_index = 0;
+    stream_front = 0;
+    stream_filepos = sdpos;
+    stream_new = true;
+  }
+
+  /**
+   * Read up to the end of the next block boundary, after the first
+   * read all reads are whole aligned blocks that SdFat transfers
+   * straight into the buffer, with a multi-block read if more than one.
+   */
+  bool SDCard::stream_fill(const uint8_t b) {
+    const int16_t n = gcode_file.read(stream_buffer[b], SD_READ_AHEAD_SIZE - (stream_filepos & 0x1FF));
+    if (n < 0) return false;
+    stream_length[b] = n;
+    stream_filepos += n;
+    return true;
+  }
+
+#endif
+
 void SDCard::openFailed(const char * const path) {
   SERIAL_LMT(ER, STR_SD_OPEN_FILE_FAIL, path);
 }
@@ -65,6 +65,10 @@ class SDCard {
     static uint32_t fileSize,
                     sdpos;
 
+    #if ENABLED(SD_READ_AHEAD)
+      #define SD_READ_AHEAD_SIZE (SD_READ_AHEAD_BLOCKS * 512U)
+    #endif
+
     static float  objectHeight,
                   firstlayerHeight,
                   layerHeight,
@@ -78,6 +82,16 @@ class SDCard {
 
     static uint16_t nrFile_index;
 
+    // Printing file read in whole blocks, one buffer is parsed while the other is filled
+    #if ENABLED(SD_READ_AHEAD)
+      static char     stream_buffer[2][SD_READ_AHEAD_SIZE];
+      static uint16_t stream_length[2],   // Bytes in the buffer, 0 is empty
+                      stream_index;       // Next byte to parse in the front buffer
+      static uint8_t  stream_front;       // Buffer being parsed
+      static uint32_t stream_filepos;     // File position of the next block read
+      static bool     stream_new;         // Nothing read since stream_reset(), a partial line is stale
+    #endif
+
     #if HAS_EEPROM_SD
       #define EEPROM_FILE_NAME "eeprom.bin"
       static SdFile eeprom_file;
@@ -199,6 +213,13 @@ class SDCard {
 
     static bool selectFile(const char * const path, const bool silent=false);
 
+    #if ENABLED(SD_READ_AHEAD)
+      static const char* stream_get(uint16_t &len);
+      static void stream_prefetch();
+      static inline void stream_consume(const uint16_t len) { stream_index += len; sdpos += len; }
+      static inline bool stream_is_new() { return stream_new; }
+    #endif
+
     static int8_t updir();
     static uint16_t getnrfilenames();
     static uint16_t get_num_Files();
@@ -257,7 +278,13 @@ class SDCard {
     static inline void pauseSDPrint() { setPrinting(false); }
     static inline bool isFileOpen()   { return isMounted() && gcode_file.isOpen(); }
     static inline bool isPaused()     { return isFileOpen() && !isPrinting(); }
-    static inline void setIndex(uint32_t newpos) { sdpos = newpos; gcode_file.seekSet(sdpos); }
+    static inline void setIndex(uint32_t newpos) {
+      sdpos = newpos;
+      gcode_file.seekSet(sdpos);
+      #if ENABLED(SD_READ_AHEAD)
+        stream_reset();
+      #endif
+    }
     static inline uint32_t getIndex() { return sdpos; }
     static inline bool eof() { return sdpos >= fileSize; }
     static inline int16_t get() { sdpos = gcode_file.curPosition(); return (int16_t)gcode_file.read(); }
@@ -285,6 +312,11 @@ class SDCard {
     static bool findFilamentNeed(char* buf, float &filament);
     static bool findTotalHeight(char* buf, float &objectHeight);
 
+    #if ENABLED(SD_READ_AHEAD)
+      static void stream_reset();
+      static bool stream_fill(const uint8_t b);
+    #endif
+
     #if ENABLED(SDCARD_SORT_ALPHA)
       static void flush_presort();
     #endif
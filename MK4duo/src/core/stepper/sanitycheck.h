@@ -38,6 +38,41 @@
   #endif
 #endif
 
+#if ENABLED(STEP_SEGMENT_BUFFER)
+  #if DISABLED(STEP_SEGMENT_BUFFER_SIZE)
+    #error "DEPENDENCY ERROR: Missing setting STEP_SEGMENT_BUFFER_SIZE."
+  #elif STEP_SEGMENT_BUFFER_SIZE < 4 || STEP_SEGMENT_BUFFER_SIZE > 127
+    #error "DEPENDENCY ERROR: STEP_SEGMENT_BUFFER_SIZE must be between 4 and 127."
+  #endif
+  #if DISABLED(STEP_SEGMENT_FREQUENCY)
+    #error "DEPENDENCY ERROR: Missing setting STEP_SEGMENT_FREQUENCY."
+  #elif STEP_SEGMENT_FREQUENCY < 100 || STEP_SEGMENT_FREQUENCY > 10000
+    #error "DEPENDENCY ERROR: STEP_SEGMENT_FREQUENCY must be between 100 and 10000."
+  #endif
+#endif
+
+#if ENABLED(BEZIER_JERK_PLANNING)
+  #if DISABLED(BEZIER_JERK_CONTROL)
+    #error "DEPENDENCY ERROR: BEZIER_JERK_PLANNING requires BEZIER_JERK_CONTROL."
+  #elif ENABLED(FIXED_POINT_TRAPEZOID)
+    #error "DEPENDENCY ERROR: BEZIER_JERK_PLANNING is not compatible with FIXED_POINT_TRAPEZOID."
+  #elif DISABLED(BEZIER_MAX_JERK)
+    #error "DEPENDENCY ERROR: Missing setting BEZIER_MAX_JERK."
+  #endif
+#endif
+
+#if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+  #if DISABLED(ADAPTIVE_STEP_SMOOTHING)
+    #error "DEPENDENCY ERROR: MULTI_AXIS_STEP_SMOOTHING requires ADAPTIVE_STEP_SMOOTHING."
+  #elif DISABLED(STEP_SEGMENT_BUFFER)
+    #error "DEPENDENCY ERROR: MULTI_AXIS_STEP_SMOOTHING requires STEP_SEGMENT_BUFFER."
+  #elif DISABLED(MULTI_AXIS_STEP_SMOOTHING_LEVELS)
+    #error "DEPENDENCY ERROR: Missing setting MULTI_AXIS_STEP_SMOOTHING_LEVELS."
+  #elif MULTI_AXIS_STEP_SMOOTHING_LEVELS < 1 || MULTI_AXIS_STEP_SMOOTHING_LEVELS > 4
+    #error "DEPENDENCY ERROR: MULTI_AXIS_STEP_SMOOTHING_LEVELS must be between 1 and 4."
+  #endif
+#endif
+
 #if ENABLED(DIGIPOT_I2C)
   #if DISABLED(DIGIPOT_I2C_NUM_CHANNELS)
     #error "DEPENDENCY ERROR: Missing setting DIGIPOT_I2C_NUM_CHANNELS."
@@ -145,7 +145,7 @@ uint8_t       Stepper::active_extruder        = 0,
   bool Stepper::bezier_2nd_half = false;  // =false If Bézier curve has been initialized or not
 #endif
 
-#if ENABLED(LIN_ADVANCE)
+#if HAS_LIN_ADVANCE_ISR
   uint32_t  Stepper::nextAdvanceISR       = LA_ADV_NEVER,
             Stepper::LA_isr_rate          = LA_ADV_NEVER;
   uint16_t  Stepper::LA_current_adv_steps = 0,
@@ -160,6 +160,46 @@ int32_t Stepper::ticks_nominal = -1;
   uint32_t Stepper::acc_step_rate = 0; // needed for deceleration start point
 #endif
 
+#if ENABLED(STEP_SEGMENT_BUFFER)
+  SPSC_Queue<segment_t, STEP_SEGMENT_BUFFER_SIZE> Stepper::segment_buffer;
+  block_t* volatile Stepper::prep_block     = nullptr;
+  volatile bool Stepper::segment_abort      = false;
+  volatile uint16_t Stepper::segment_underruns = 0;
+  bool          Stepper::segment_underrun   = false;
+  uint32_t      Stepper::prep_events_completed  = 0,
+                Stepper::prep_event_count       = 0;
+  uint8_t       Stepper::prep_steps_per_isr = 1,
+                Stepper::prep_phase         = PHASE_ACCELERATE,
+                Stepper::prep_flag          = 0,
+                Stepper::segment_phase      = PHASE_ACCELERATE;
+  hal_timer_t   Stepper::segment_interval   = 0;
+  uint16_t      Stepper::segment_events     = 0;
+  bool          Stepper::segment_decel_start = false;
+  #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+    uint8_t     Stepper::segment_shift      = 0;
+  #endif
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
+    uint32_t    Stepper::prep_e_nominal     = 0,
+                Stepper::segment_e_divisor  = 0;
+    int32_t     Stepper::prep_e_advance     = 0,
+                Stepper::prep_e_carry       = 0;
+    float       Stepper::prep_e_smoothed    = 0;
+    uint8_t     Stepper::prep_e_extruder    = 0;
+    bool        Stepper::prep_e_stop        = false;
+  #endif
+  #if ENABLED(DELTA_SEGMENT_FREE)
+    abc_long_t  Stepper::prep_tower_start{0},
+                Stepper::prep_tower_done{0},
+                Stepper::prep_tower_carry{0};
+    uint32_t    Stepper::segment_tower_divisor = 0;
+  #endif
+  #if ENABLED(MESH_SEGMENT_FREE)
+    int32_t     Stepper::prep_z_done        = 0,
+                Stepper::prep_z_carry       = 0;
+    uint32_t    Stepper::segment_z_divisor  = 0;
+  #endif
+#endif
+
 xyz_long_t  Stepper::endstops_trigsteps;
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
@@ -184,7 +224,7 @@ void Stepper::create_driver() {
 
 void Stepper::create_xyz_driver() {
 
-  constexpr char* drv_xyz_label[] = { "X", "Y", "Z" };
+  constexpr const char* drv_xyz_label[] = { "X", "Y", "Z" };
 
   LOOP_DRV_XYZ() {
     if (!driver.drv[d]) {
@@ -243,7 +283,7 @@ void Stepper::create_xyz_driver() {
 
 void Stepper::create_ext_driver() {
 
-  constexpr char* drv_e_label[] = { "T0", "T1", "T2", "T3", "T4", "T5" };
+  constexpr const char* drv_e_label[] = { "T0", "T1", "T2", "T3", "T4", "T5" };
 
   LOOP_DRV_EXT() {
     if (!driver.e[d]) {
@@ -332,6 +372,10 @@ void Stepper::Step() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
+  #if ENABLED(INPUT_SHAPING)
+    static uint32_t nextShapingISR = SHAPING_NEVER; // Interval until the next delayed impulse of the shaped axes
+  #endif
+
   #if DISABLED(__AVR__)
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -360,19 +404,33 @@ void Stepper::Step() {
     // Run main stepping pulse phase ISR if we have to
     if (!nextMainISR) pulse_phase_step();                       // 0 = Do coordinated axes Stepper pulses
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_LIN_ADVANCE_ISR
       // Run linear advance stepper ISR
       if (!nextAdvanceISR) nextAdvanceISR = lin_advance_step(); // 0 = Do Linear Advance E Stepper pulses
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // Run the delayed impulses of the shaped axes
+      if (!nextShapingISR) shaping_step();
+    #endif
+
     if (!nextMainISR) nextMainISR = block_phase_step();         // Manage acc/deceleration, get next block
 
-    #if ENABLED(LIN_ADVANCE)
+    #if ENABLED(INPUT_SHAPING)
+      // New raw steps could have an impulse before the pending ones
+      nextShapingISR = inputshaping.next_echo();
+    #endif
+
+    #if HAS_LIN_ADVANCE_ISR
       uint32_t interval = MIN(nextAdvanceISR, nextMainISR);     // Nearest time interval
     #else
       uint32_t interval = nextMainISR;                          // Remaining stepper ISR time
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      NOMORE(interval, nextShapingISR);
+    #endif
+
     // Limit the value to the maximum possible value of the timer
     NOMORE(interval, uint32_t(HAL_TIMER_TYPE_MAX));
 
@@ -384,11 +442,17 @@ void Stepper::Step() {
     //
     nextMainISR -= interval;
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_LIN_ADVANCE_ISR
       // Compute the time remaining for the advance isr
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // Compute the time remaining for the delayed impulses
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      inputshaping.clock += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -452,6 +516,21 @@ void Stepper::Step() {
 
 }
 
+#if ENABLED(STEP_SEGMENT_BUFFER)
+
+/**
+ * Check if the given block is busy or not
+ * All the blocks handed to the segment preparation are busy, up to the one
+ * being executed. The ISR only moves the tail, so a stale read is harmless.
+ */
+bool Stepper::is_block_busy(const block_t* const block) {
+  const uint8_t tail  = planner.block_buffer_tail,
+                index = block - planner.block_buffer;
+  return BLOCK_MOD(index - tail) < BLOCK_MOD(planner.block_buffer_nonbusy - tail);
+}
+
+#else
+
 /**
  * Check if the given block is busy or not - Must not be called from ISR contexts
  * The current_block could change in the middle of the read by an Stepper ISR, so
@@ -485,6 +564,8 @@ bool Stepper::is_block_busy(const block_t* const block) {
 
 }
 
+#endif // ENABLED(STEP_SEGMENT_BUFFER)
+
 /**
  * Get a stepper's position in steps.
  */
@@ -636,6 +717,12 @@ void Stepper::set_directions(const bool init/*=false*/) {
     toolManager.encLastDir[active_extruder] = count_direction.e;
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    // The shaped motors start from the direction just written
+    inputshaping.axis[X_AXIS].direction = count_direction.x;
+    inputshaping.axis[Y_AXIS].direction = count_direction.y;
+  #endif
+
   #if HAS_L64XX
     uint8_t L64XX_buf[MAX_DRIVER];
     if (init) {
@@ -845,16 +932,25 @@ void Stepper::endstop_triggered(const AxisEnum axis) {
   // Disable stepper ISR
   const bool isr_enabled = suspend();
 
+  #if ENABLED(INPUT_SHAPING)
+    // Where the shaped motors are, the delayed impulses will be dropped
+    xyze_long_t motor_position = count_position;
+    motor_position.x -= inputshaping.axis[X_AXIS].pending;
+    motor_position.y -= inputshaping.axis[Y_AXIS].pending;
+  #else
+    const xyze_long_t &motor_position = count_position;
+  #endif
+
   #if IS_CORE
 
     endstops_trigsteps[axis] = 0.5f * (
-      axis == CORE_AXIS_2 ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-                          : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+      axis == CORE_AXIS_2 ? CORESIGN(motor_position[CORE_AXIS_1] - motor_position[CORE_AXIS_2])
+                          : motor_position[CORE_AXIS_1] + motor_position[CORE_AXIS_2]
     );
 
   #else // !COREXY && !COREXZ && !COREYZ
 
-    endstops_trigsteps[axis] = count_position[axis];
+    endstops_trigsteps[axis] = motor_position[axis];
 
   #endif // !COREXY && !COREXZ && !COREYZ
 
@@ -1416,20 +1512,45 @@ void Stepper::pulse_phase_step() {
     abort_current_block = false;
     if (current_block) {
       axis_did_move = 0;
-      current_block = NULL;
-      planner.discard_current_block();
+      #if ENABLED(STEP_SEGMENT_BUFFER)
+        // The block is released by the next block phase, when the preparation has left it
+        segment_events = 0;
+        segment_abort = true;
+      #else
+        #if ENABLED(LASER) && ENABLED(LASER_RASTER)
+          laser.raster_release(current_block);
+        #endif
+        current_block = NULL;
+        planner.discard_current_block();
+      #endif
     }
+    #if ENABLED(INPUT_SHAPING)
+      // The shaped motors stop where they are
+      count_position.x -= inputshaping.axis[X_AXIS].flush();
+      count_position.y -= inputshaping.axis[Y_AXIS].flush();
+    #endif
   }
 
   // If there is no current block, do nothing
   if (!current_block) return;
 
-  // Compute the count of pending loops
-  const uint32_t pending_events = step_event_count - step_events_completed;
-  uint8_t events_to_do = MIN(pending_events, steps_per_isr);
+  #if ENABLED(STEP_SEGMENT_BUFFER)
+    // Compute the count of pending loops in the segment
+    uint8_t events_to_do = MIN(segment_events, steps_per_isr);
+    if (!events_to_do) return;
+    segment_events -= events_to_do;
+  #else
+    // Compute the count of pending loops
+    const uint32_t pending_events = step_event_count - step_events_completed;
+    uint8_t events_to_do = MIN(pending_events, steps_per_isr);
+  #endif
 
   // Just update the value we will get at the end of the loop
-  step_events_completed += events_to_do;
+  #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+    step_events_completed += uint32_t(events_to_do) << segment_shift;
+  #else
+    step_events_completed += events_to_do;
+  #endif
 
   bool first_step = true;
   hal_timer_t pulse_tick_end = 0;
@@ -1463,7 +1584,7 @@ void Stepper::pulse_phase_step() {
           if (current_block->laser_mode == RASTER && current_block->laser_status == LASER_ON) { // Raster Firing Mode
             // For some reason, when comparing raster power to ppm line burns the rasters were around 2% more powerful
             // going from darkened paper to burning through paper.
-            laser.fire(current_block->laser_raster_data[counter_raster]);
+            laser.fire(laser.raster_pool[current_block->raster_line][counter_raster]);
             counter_raster++;
           }
         #endif // LASER_RASTER
@@ -1488,350 +1609,975 @@ uint32_t Stepper::block_phase_step() {
   // If no queued movements, just wait 1ms for the next block
   uint32_t interval = (STEPPER_TIMER_RATE) / 1000UL;
 
-  // If there is a current block
-  if (current_block) {
+  #if ENABLED(STEP_SEGMENT_BUFFER)
 
-    // If current block is finished, reset pointer
-    if (step_events_completed >= step_event_count) {
-      #if ENABLED(EXTRUDER_ENCODER_CONTROL) && FILAMENT_RUNOUT_DISTANCE_MM > 0
-        filamentrunout.block_completed(current_block);
+    // Aborted block: drop its segments and release it once the preparation has left it
+    if (segment_abort) {
+      while (!segment_buffer.isEmpty() && segment_buffer.front().block == current_block)
+        segment_buffer.pop();
+      if (prep_block == current_block) return interval;
+      #if ENABLED(LASER) && ENABLED(LASER_RASTER)
+        laser.raster_release(current_block);
       #endif
-      axis_did_move = 0;
       current_block = nullptr;
       planner.discard_current_block();
-
-      #if ENABLED(LASER)
-        laser.extinguish();
-      #endif
+      segment_abort = false;
     }
-    else {
-      // Step events not completed yet...
-
-      // Are we in acceleration phase ?
-      if (step_events_completed <= accelerate_until) {
 
-        #if ENABLED(BEZIER_JERK_CONTROL)
-          // Get the next speed to use (Jerk limited!)
-          uint32_t acc_step_rate =
-            acceleration_time < current_block->acceleration_time
-              ? _eval_bezier_curve(acceleration_time)
-              : current_block->cruise_rate;
-        #else
-          acc_step_rate = HAL_MULTI_ACC(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
-          NOMORE(acc_step_rate, current_block->nominal_rate);
-        #endif
+    // If current block is finished, reset pointer. The release of the advance may still follow its step events
+    if (current_block && !segment_events && step_events_completed >= step_event_count && prep_block != current_block
+      && (segment_buffer.isEmpty() || segment_buffer.front().block != current_block)
+    ) end_block();
 
-        // acc_step_rate is in steps/second
+    // Segment played, get the next one
+    if (!segment_events) {
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
-        acceleration_time += interval;
+      while (!segment_buffer.isEmpty()) {
+        const segment_t &segment = segment_buffer.front();
 
-        #if ENABLED(LIN_ADVANCE)
-          // Fire ISR if final adv_rate is reached
-          if (LA_steps && (!LA_use_advance_lead || LA_isr_rate != current_block->advance_speed))
-            initiateLA();
-        #endif
+        if (segment.block != current_block) {
 
-      }
-      // Are we in deceleration phase
-      else if (step_events_completed > decelerate_after) {
-        uint32_t step_rate;
-
-        #if ENABLED(BEZIER_JERK_CONTROL)
-          // If this is the 1st time we process the 2nd half of the trapezoid...
-          if (!bezier_2nd_half) {
-            // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
-            bezier_2nd_half = true;
-            // The first point starts at cruise rate. Just save evaluation of the Bézier curve
-            step_rate = current_block->cruise_rate;
+          // A new block must be the oldest one in the planner, any other segment is a leftover of a quick stop
+          if (current_block || !TEST(segment.flag, SEGMENT_BIT_BLOCK_START)
+            || !planner.has_blocks_queued() || segment.block != &planner.block_buffer[planner.block_buffer_tail]
+          ) {
+            segment_buffer.pop();
+            continue;
           }
-          else {
-            // Calculate the next speed to use
-            step_rate = deceleration_time < current_block->deceleration_time
-              ? _eval_bezier_curve(deceleration_time)
-              : current_block->final_rate;
+
+          // Sync block? Sync the stepper counts and go on
+          if (TEST(segment.flag, SEGMENT_BIT_SYNC_POSITION)) {
+            _set_position(segment.block->position);
+            planner.discard_current_block();
+            segment_buffer.pop();
+            continue;
           }
-        #else
 
-          // Using the old trapezoidal control
-          step_rate = HAL_MULTI_ACC(deceleration_time, current_block->acceleration_rate);
+          current_block = segment.block;
+          setup_block(
+            #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+              MULTI_AXIS_STEP_SMOOTHING_LEVELS
+            #elif ENABLED(ADAPTIVE_STEP_SMOOTHING)
+              segment.oversampling
+            #else
+              0
+            #endif
+          );
+        }
 
-          if (step_rate < acc_step_rate) { // Still decelerating?
-            step_rate = acc_step_rate - step_rate;
-            NOLESS(step_rate, current_block->final_rate);
-          }
-          else
-            step_rate = current_block->final_rate;
+        #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+          // Scale the Bresenham dividends to the oversampling of the segment
+          segment_shift = MULTI_AXIS_STEP_SMOOTHING_LEVELS - segment.oversampling;
+          advance_dividend = current_block->steps << (segment_shift + 1);
         #endif
 
-        // step_rate is in steps/second
+        #if ENABLED(DELTA_SEGMENT_FREE)
+          set_segment_towers(segment);
+        #endif
+        #if ENABLED(MESH_SEGMENT_FREE)
+          set_segment_z(segment);
+        #endif
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          set_segment_e(segment);
+          // The other axes are done
+          if (TEST(segment.flag, SEGMENT_BIT_E_ONLY)) advance_dividend.x = advance_dividend.y = advance_dividend.z = 0;
+        #endif
 
-        // step_rate to timer interval
-        interval = calc_timer_interval(step_rate, &steps_per_isr);
-        deceleration_time += interval;
+        segment_interval    = segment.interval;
+        segment_events      = segment.events;
+        segment_phase       = segment.phase;
+        segment_decel_start = TEST(segment.flag, SEGMENT_BIT_DECEL_START);
+        steps_per_isr       = segment.steps_per_isr;
+        segment_underrun    = false;
+        segment_buffer.pop();
+        break;
+      }
+    }
 
-        #if ENABLED(LIN_ADVANCE)
-          if (LA_use_advance_lead) {
-            // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
-            if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
-              initiateLA();
-              LA_isr_rate = current_block->advance_speed;
-            }
-          }
-          else if (LA_steps) initiateLA();
-        #endif // LIN_ADVANCE
+    if (segment_events) {
+      interval = segment_interval;
+      #if HAS_LIN_ADVANCE_ISR
+        advance_isr_trigger(segment_phase, segment_decel_start);
+      #endif
+      segment_decel_start = false;
+    }
+    else if (current_block || prep_block) {
+      // The main loop is late with the segments, count the underrun and retry soon
+      if (!segment_underrun) {
+        segment_underrun = true;
+        segment_underruns++;
       }
-      // We must be in cruise phase otherwise
+      interval = (STEPPER_TIMER_RATE) / 20000UL;
+    }
+    else if (planner.delay_before_delivering) {
+      // Count down the delivery delay of the first block, 1ms at a time
+      planner.delay_before_delivering--;
+    }
+
+  #else // !STEP_SEGMENT_BUFFER
+
+    // If there is a current block
+    if (current_block) {
+
+      // If current block is finished, reset pointer
+      if (step_events_completed >= step_event_count)
+        end_block();
       else {
+        // Step events not completed yet...
+        uint8_t phase;
+        interval = trapezoid_interval(current_block, step_events_completed, phase, steps_per_isr);
+        trapezoid_advance(phase, interval);
 
-        #if ENABLED(LIN_ADVANCE)
-          // If there are any esteps, fire the next advance_isr "now"
-          if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
+        #if HAS_LIN_ADVANCE_ISR
+          advance_isr_trigger(phase, step_events_completed <= decelerate_after + steps_per_isr);
         #endif
+      }
+    }
 
-        // Calculate the ticks_nominal for this nominal speed, if not done yet
-        if (ticks_nominal < 0) {
-          // step_rate to timer interval and loops for the nominal speed
-          ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
+    // If there is no current block at this point, attempt to pop one from the buffer
+    // and prepare its movement. The blocks of a print time estimate are not for us.
+    if (!current_block && !planner.flag.timing_only) {
+
+      // Anything in the buffer?
+      if ((current_block = planner.get_current_block())) {
+
+        // Sync block? Sync the stepper counts and return
+        while (TEST(current_block->flag, BLOCK_BIT_SYNC_POSITION)) {
+          _set_position(current_block->position);
+          planner.discard_current_block();
+
+          // Try to get a new block
+          if (!(current_block = planner.get_current_block()))
+            return interval; // No more queued movements!
         }
 
-        // The timer interval is just the nominal value for the nominal speed
-        interval = ticks_nominal;
+        // Initialize the trapezoid generator from the current block.
+        trapezoid_start(current_block);
+
+        setup_block(oversampling_factor);
+
+        // Calculate the initial timer interval
+        interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
       }
     }
+
+  #endif // !STEP_SEGMENT_BUFFER
+
+  #if ENABLED(STEP_TIMELINE)
+    steptimeline.sample(!!current_block, step_events_completed, interval, steps_per_isr);
+  #endif
+
+  // Continuous firing of the laser during a move happens here, PPM and raster happen further down
+  #if ENABLED(LASER)
+    if (current_block->laser_mode == CONTINUOUS && current_block->laser_status == LASER_ON)
+      laser.fire(current_block->laser_intensity);
+
+    if (current_block->laser_status == LASER_OFF)
+      laser.extinguish();
+  #endif
+
+  // Return the interval to wait
+  return interval;
+}
+
+FORCE_INLINE void Stepper::setup_block(const uint8_t oversampling) {
+
+  #if HAS_SD_RESTART
+    restart.job_info.sdpos = current_block->sdpos;
+  #endif
+
+  // Flag all moving axes for proper endstop handling
+
+  #if IS_CORE
+    // Define conditions for checking endstops
+    #define S_(N) current_block->steps[CORE_AXIS_##N]
+    #define D_(N) TEST(current_block->direction_bits, CORE_AXIS_##N)
+  #endif
+
+  #if CORE_IS_XY || CORE_IS_XZ
+    /**
+     * Head direction in -X axis for CoreXY and CoreXZ bots.
+     *
+     * If steps differ, both axes are moving.
+     * If DeltaA == -DeltaB, the movement is only in the 2nd axis (Y or Z, handled below)
+     * If DeltaA ==  DeltaB, the movement is only in the 1st axis (X)
+     */
+    #if MECH(COREXY) || MECH(COREXZ)
+      #define X_CMP ==
+    #else
+      #define X_CMP !=
+    #endif
+    #define X_MOVE_TEST ( S_(1) != S_(2) || (S_(1) > 0 && D_(1) X_CMP D_(2)) )
+  #else
+    #define X_MOVE_TEST !!current_block->steps.a
+  #endif
+
+  #if CORE_IS_XY || CORE_IS_YZ
+    /**
+     * Head direction in -Y axis for CoreXY / CoreYZ bots.
+     *
+     * If steps differ, both axes are moving
+     * If DeltaA ==  DeltaB, the movement is only in the 1st axis (X or Y)
+     * If DeltaA == -DeltaB, the movement is only in the 2nd axis (Y or Z)
+     */
+    #if MECH(COREYX) || MECH(COREYZ)
+      #define Y_CMP ==
+    #else
+      #define Y_CMP !=
+    #endif
+    #define Y_MOVE_TEST ( S_(1) != S_(2) || (S_(1) > 0 && D_(1) Y_CMP D_(2)) )
+  #else
+    #define Y_MOVE_TEST !!current_block->steps.b
+  #endif
+
+  #if CORE_IS_XZ || CORE_IS_YZ
+    /**
+     * Head direction in -Z axis for CoreXZ or CoreYZ bots.
+     *
+     * If steps differ, both axes are moving
+     * If DeltaA ==  DeltaB, the movement is only in the 1st axis (X or Y, already handled above)
+     * If DeltaA == -DeltaB, the movement is only in the 2nd axis (Z)
+     */
+    #if MECH(COREZX) || MECH(COREZY)
+      #define Z_CMP ==
+    #else
+      #define Z_CMP !=
+    #endif
+    #define Z_MOVE_TEST ( S_(1) != S_(2) || (S_(1) > 0 && D_(1) Z_CMP D_(2)) )
+  #else
+    #define Z_MOVE_TEST !!current_block->steps.c
+  #endif
+
+  uint8_t axis_bits = 0;
+  if (X_MOVE_TEST) SBI(axis_bits, A_AXIS);
+  if (Y_MOVE_TEST) SBI(axis_bits, B_AXIS);
+  if (Z_MOVE_TEST) SBI(axis_bits, C_AXIS);
+  #if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(DELTA_SEGMENT_FREE)
+    // Along a line a carriage moves even with no steps from end to end
+    if (TEST(current_block->flag, BLOCK_BIT_DELTA_LINE)) axis_bits |= _BV(A_AXIS) | _BV(B_AXIS) | _BV(C_AXIS);
+  #endif
+  #if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(MESH_SEGMENT_FREE)
+    // Over the mesh Z moves even with no steps from end to end
+    if (TEST(current_block->flag, BLOCK_BIT_LEVEL_LINE)) SBI(axis_bits, C_AXIS);
+  #endif
+  //if (!!current_block->steps.e) SBI(axis_bits, E_AXIS);
+  //if (!!current_block->steps[A_AXIS]) SBI(axis_bits, X_HEAD);
+  //if (!!current_block->steps[B_AXIS]) SBI(axis_bits, Y_HEAD);
+  //if (!!current_block->steps[C_AXIS]) SBI(axis_bits, Z_HEAD);
+  axis_did_move = axis_bits;
+
+  // Based on the oversampling factor, do the calculations
+  step_event_count = current_block->step_event_count << oversampling;
+
+  // Initialize Bresenham delta errors to 1/2
+  delta_error = -int32_t(step_event_count);
+
+  #if ENABLED(LASER)
+    delta_error_laser = delta_error.x;
+    laser.dur = current_block->laser_duration;
+  #endif
+
+  // Calculate Bresenham dividends
+  advance_dividend = current_block->steps << 1;
+
+  // Calculate Bresenham divisor
+  advance_divisor = step_event_count << 1;
+
+  // No step events completed so far
+  step_events_completed = 0;
+
+  #if ENABLED(COLOR_MIXING_EXTRUDER)
+    mixer.stepper_setup(current_block->b_color);
+  #endif
+
+  #if MAX_EXTRUDER > 1
+    active_extruder = current_block->active_extruder;
+    active_extruder_driver = get_active_extruder_driver();
+  #endif
+
+  #if HAS_LIN_ADVANCE_ISR
+    #if DISABLED(COLOR_MIXING_EXTRUDER) && MAX_DRIVER_E > 1
+      // If the now active extruder wasn't in use during the last move, its pressure is most likely gone.
+      if (active_extruder != last_moved_extruder) LA_current_adv_steps = 0;
+    #endif
+
+    if ((LA_use_advance_lead = current_block->use_advance_lead)) {
+      LA_final_adv_steps = current_block->final_adv_steps;
+      LA_max_adv_steps = current_block->max_adv_steps;
+      initiateLA(); // Start the ISR
+      LA_isr_rate = current_block->advance_speed;
+    }
+    else LA_isr_rate = LA_ADV_NEVER;
+  #endif
+
+  #if HAS_L64XX
+    // Always set direction for L64xx (This also enables the chips)
+    last_direction_bits = current_block->direction_bits;
+    #if MAX_EXTRUDER > 1
+      last_moved_extruder = active_extruder;
+    #endif
+    set_directions(true);
+  #else
+    if (current_block->direction_bits != last_direction_bits
+      #if DISABLED(COLOR_MIXING_EXTRUDER)
+        || active_extruder != last_moved_extruder
+      #endif
+    ) {
+      last_direction_bits = current_block->direction_bits;
+      #if MAX_EXTRUDER > 1
+        last_moved_extruder = active_extruder;
+      #endif
+      set_directions();
+    }
+  #endif
+
+  // At this point, we must ensure the movement about to execute isn't
+  // trying to force the head against a limit switch. If using interrupt-
+  // driven change detection, and already against a limit then no call to
+  // the endstop_triggered method will be done and the movement will be
+  // done against the endstop. So, check the limits here: If the movement
+  // is against the limits, the block will be marked as to be killed, and
+  // on the next call to this ISR, will be discarded.
+  endstops.update();
+
+  #if ENABLED(Z_LATE_ENABLE)
+    // If delayed Z enable, enable it now. This option will severely interfere with
+    // timing between pulses when chaining motion between blocks, and it could lead
+    // to lost steps in both X and Y axis, so avoid using it unless strictly necessary!!
+    if (current_block->steps.z) enable_Z();
+  #endif
+
+  #if ENABLED(LASER) && ENABLED(LASER_RASTER)
+     if (current_block->laser_mode == RASTER) counter_raster = 0;
+  #endif
+
+  #if ENABLED(STEP_TIMELINE)
+    steptimeline.block_start(current_block, step_event_count, current_block->accelerate_until << oversampling, current_block->decelerate_after << oversampling, oversampling);
+  #endif
+
+}
+
+FORCE_INLINE void Stepper::end_block() {
+  #if ENABLED(EXTRUDER_ENCODER_CONTROL) && FILAMENT_RUNOUT_DISTANCE_MM > 0
+    filamentrunout.block_completed(current_block);
+  #endif
+  axis_did_move = 0;
+  #if ENABLED(LASER) && ENABLED(LASER_RASTER)
+    laser.raster_release(current_block);
+  #endif
+  current_block = nullptr;
+  planner.discard_current_block();
+
+  #if ENABLED(LASER)
+    laser.extinguish();
+  #endif
+}
+
+void Stepper::trapezoid_start(const block_t * const block) {
+
+  // No acceleration / deceleration time elapsed so far
+  acceleration_time = deceleration_time = 0;
+
+  uint8_t oversampling = 0;                         // Assume we won't use it
+
+  #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+    // The points stay in block events, each segment is oversampled by the level of its own rate
+  #elif ENABLED(ADAPTIVE_STEP_SMOOTHING)
+    // Decide if axis smoothing is possible
+    uint32_t max_rate = block->nominal_rate;        // Get the maximum rate (maximum event speed)
+    while (max_rate < HAL_frequency_limit[0]) {
+      max_rate <<= 1;
+      if (max_rate >= HAL_frequency_limit[0]) break;
+      ++oversampling;
+    }
+    oversampling_factor = oversampling;
+  #endif
+
+  // Compute the acceleration and deceleration points
+  accelerate_until = block->accelerate_until << oversampling;
+  decelerate_after = block->decelerate_after << oversampling;
+
+  // Mark the time_nominal as not calculated yet
+  ticks_nominal = -1;
+
+  #if DISABLED(BEZIER_JERK_CONTROL)
+    // Set as deceleration point the initial rate of the block
+    acc_step_rate = block->initial_rate;
+  #else
+    // Initialize the Bézier speed curve
+    _calc_bezier_curve_coeffs(block->initial_rate, block->cruise_rate, block->acceleration_time_inverse);
+    // We haven't started the 2nd half of the trapezoid
+    bezier_2nd_half = false;
+  #endif
+
+}
+
+FORCE_INLINE uint32_t Stepper::trapezoid_interval(const block_t * const block, const uint32_t completed, uint8_t &phase, uint8_t &loops) {
+
+  uint32_t interval;
+
+  // Are we in acceleration phase ?
+  if (completed <= accelerate_until) {
+
+    phase = PHASE_ACCELERATE;
+
+    #if ENABLED(BEZIER_JERK_CONTROL)
+      // Get the next speed to use (Jerk limited!)
+      uint32_t acc_step_rate =
+        acceleration_time < block->acceleration_time
+          ? _eval_bezier_curve(acceleration_time)
+          : block->cruise_rate;
+    #else
+      acc_step_rate = HAL_MULTI_ACC(acceleration_time, block->acceleration_rate) + block->initial_rate;
+      NOMORE(acc_step_rate, block->nominal_rate);
+    #endif
+
+    // acc_step_rate is in steps/second
+
+    // step_rate to timer interval and steps per stepper isr
+    interval = calc_timer_interval(acc_step_rate, &loops);
+
   }
+  // Are we in deceleration phase
+  else if (completed > decelerate_after) {
 
-  // If there is no current block at this point, attempt to pop one from the buffer
-  // and prepare its movement
-  if (!current_block) {
+    phase = PHASE_DECELERATE;
 
-    // Anything in the buffer?
-    if ((current_block = planner.get_current_block())) {
+    uint32_t step_rate;
 
-      // Sync block? Sync the stepper counts and return
-      while (TEST(current_block->flag, BLOCK_BIT_SYNC_POSITION)) {
-        _set_position(current_block->position);
-        planner.discard_current_block();
+    #if ENABLED(BEZIER_JERK_CONTROL)
+      // If this is the 1st time we process the 2nd half of the trapezoid...
+      if (!bezier_2nd_half) {
+        // Initialize the Bézier speed curve
+        _calc_bezier_curve_coeffs(block->cruise_rate, block->final_rate, block->deceleration_time_inverse);
+        bezier_2nd_half = true;
+        // The first point starts at cruise rate. Just save evaluation of the Bézier curve
+        step_rate = block->cruise_rate;
+      }
+      else {
+        // Calculate the next speed to use
+        step_rate = deceleration_time < block->deceleration_time
+          ? _eval_bezier_curve(deceleration_time)
+          : block->final_rate;
+      }
+    #else
+
+      // Using the old trapezoidal control
+      step_rate = HAL_MULTI_ACC(deceleration_time, block->acceleration_rate);
 
-        // Try to get a new block
-        if (!(current_block = planner.get_current_block()))
-          return interval; // No more queued movements!
+      if (step_rate < acc_step_rate) { // Still decelerating?
+        step_rate = acc_step_rate - step_rate;
+        NOLESS(step_rate, block->final_rate);
       }
+      else
+        step_rate = block->final_rate;
+    #endif
 
-      #if HAS_SD_RESTART
-        restart.job_info.sdpos = current_block->sdpos;
-      #endif
+    // step_rate is in steps/second
 
-      // Flag all moving axes for proper endstop handling
+    // step_rate to timer interval
+    interval = calc_timer_interval(step_rate, &loops);
 
-      #if IS_CORE
-        // Define conditions for checking endstops
-        #define S_(N) current_block->steps[CORE_AXIS_##N]
-        #define D_(N) TEST(current_block->direction_bits, CORE_AXIS_##N)
-      #endif
+  }
+  // We must be in cruise phase otherwise
+  else {
 
-      #if CORE_IS_XY || CORE_IS_XZ
-        /**
-         * Head direction in -X axis for CoreXY and CoreXZ bots.
-         *
-         * If steps differ, both axes are moving.
-         * If DeltaA == -DeltaB, the movement is only in the 2nd axis (Y or Z, handled below)
-         * If DeltaA ==  DeltaB, the movement is only in the 1st axis (X)
-         */
-        #if MECH(COREXY) || MECH(COREXZ)
-          #define X_CMP ==
-        #else
-          #define X_CMP !=
+    phase = PHASE_CRUISE;
+
+    // Calculate the ticks_nominal for this nominal speed, if not done yet
+    if (ticks_nominal < 0) {
+      // step_rate to timer interval and loops for the nominal speed
+      ticks_nominal = calc_timer_interval(block->nominal_rate, &loops);
+    }
+
+    // The timer interval is just the nominal value for the nominal speed
+    interval = ticks_nominal;
+  }
+
+  return interval;
+}
+
+#if ENABLED(STEP_SEGMENT_BUFFER)
+
+  void Stepper::prepare_segments() {
+
+    // The print time estimate has the blocks?
+    if (planner.flag.timing_only) return;
+
+    while (!segment_buffer.isFull()) {
+
+      // Leave a block aborted by the ISR or dropped by a quick stop
+      if (prep_block && ((segment_abort && prep_block == current_block) || !is_block_busy(prep_block))) {
+        prep_block = nullptr;
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          reset_e_advance();
         #endif
-        #define X_MOVE_TEST ( S_(1) != S_(2) || (S_(1) > 0 && D_(1) X_CMP D_(2)) )
-      #else
-        #define X_MOVE_TEST !!current_block->steps.a
-      #endif
+        #if ENABLED(DELTA_SEGMENT_FREE)
+          prep_tower_carry.reset();
+        #endif
+        #if ENABLED(MESH_SEGMENT_FREE)
+          prep_z_carry = 0;
+        #endif
+      }
 
-      #if CORE_IS_XY || CORE_IS_YZ
-        /**
-         * Head direction in -Y axis for CoreXY / CoreYZ bots.
-         *
-         * If steps differ, both axes are moving
-         * If DeltaA ==  DeltaB, the movement is only in the 1st axis (X or Y)
-         * If DeltaA == -DeltaB, the movement is only in the 2nd axis (Y or Z)
-         */
-        #if MECH(COREYX) || MECH(COREYZ)
-          #define Y_CMP ==
+      if (!prep_block) {
+
+        // Keep the newest block open to the planner look-ahead while the ISR has work to do
+        if (segment_buffer.count() > 2 && planner.nonbusy_moves_planned() < 2) break;
+
+        block_t * const block = planner.get_next_block();
+        if (!block) break;
+
+        if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) || !block->step_event_count) {
+          // Nothing to step, a single segment starts and ends the block
+          segment_t * const segment = segment_buffer.reserve();
+          segment->block  = block;
+          segment->events = 0;
+          segment->phase  = PHASE_CRUISE;
+          segment->flag   = _BV(SEGMENT_BIT_BLOCK_START) | (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) ? _BV(SEGMENT_BIT_SYNC_POSITION) : 0);
+          segment->interval = 0;
+          segment->steps_per_isr = 1;
+          #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+            segment->oversampling = 0;
+          #endif
+          #if ENABLED(LIN_ADVANCE_SMOOTHING)
+            segment->e_steps = segment->e_nominal = 0;
+          #endif
+          #if ENABLED(DELTA_SEGMENT_FREE)
+            segment->tower_steps.reset();
+          #endif
+          #if ENABLED(MESH_SEGMENT_FREE)
+            segment->z_steps = 0;
+          #endif
+          segment_buffer.commit();
+          continue;
+        }
+
+        trapezoid_start(block);
+        #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+          prep_event_count = block->step_event_count;
         #else
-          #define Y_CMP !=
+          prep_event_count = block->step_event_count << oversampling_factor;
+        #endif
+        prep_events_completed = 0;
+        prep_phase = PHASE_ACCELERATE;
+        prep_flag = _BV(SEGMENT_BIT_BLOCK_START);
+        prep_block = block;
+
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          prep_e_nominal = 0;
+          // Another extruder, the pressure of the last one is not for this
+          if (block->active_extruder != prep_e_extruder) {
+            reset_e_advance();
+            prep_e_extruder = block->active_extruder;
+          }
+        #endif
+
+        #if ENABLED(DELTA_SEGMENT_FREE)
+          prep_tower_done.reset();
+          if (TEST(block->flag, BLOCK_BIT_DELTA_LINE)) {
+            abc_pos_t carriages;
+            mechanics.carriage_positions(block->line_start, carriages);
+            LOOP_ABC(axis) prep_tower_start[axis] = LROUND(carriages[axis] * mechanics.data.axis_steps_per_mm[axis]);
+          }
+        #endif
+
+        #if ENABLED(MESH_SEGMENT_FREE)
+          prep_z_done = 0;
         #endif
-        #define Y_MOVE_TEST ( S_(1) != S_(2) || (S_(1) > 0 && D_(1) Y_CMP D_(2)) )
+      }
+
+      // The rate for the next step event
+      uint8_t phase;
+      const uint32_t interval = trapezoid_interval(prep_block, prep_events_completed, phase, prep_steps_per_isr);
+
+      #if ENABLED(LIN_ADVANCE_SMOOTHING)
+        // All the step events sliced, the advance left over goes out before the stop
+        if (prep_events_completed >= prep_event_count) {
+          prepare_e_release(interval);
+          continue;
+        }
+      #endif
+
+      #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+        // Sliced in whole block events, the ISR plays them oversampled
+        const uint8_t level = oversampling_factor;
       #else
-        #define Y_MOVE_TEST !!current_block->steps.b
+        constexpr uint8_t level = 0;
       #endif
 
-      #if CORE_IS_XZ || CORE_IS_YZ
-        /**
-         * Head direction in -Z axis for CoreXZ or CoreYZ bots.
-         *
-         * If steps differ, both axes are moving
-         * If DeltaA ==  DeltaB, the movement is only in the 1st axis (X or Y, already handled above)
-         * If DeltaA == -DeltaB, the movement is only in the 2nd axis (Z)
-         */
-        #if MECH(COREZX) || MECH(COREZY)
-          #define Z_CMP ==
-        #else
-          #define Z_CMP !=
+      // Keep it up to the end of the phase, for one segment time while the speed changes
+      // or the delta carriages or Z follow a line
+      uint32_t events = (phase == PHASE_ACCELERATE ? accelerate_until + 1 : phase == PHASE_CRUISE ? decelerate_after + 1 : prep_event_count);
+      NOMORE(events, prep_event_count);
+      events -= prep_events_completed;
+      if (phase != PHASE_CRUISE
+        #if ENABLED(DELTA_SEGMENT_FREE)
+          || TEST(prep_block->flag, BLOCK_BIT_DELTA_LINE)
         #endif
-        #define Z_MOVE_TEST ( S_(1) != S_(2) || (S_(1) > 0 && D_(1) Z_CMP D_(2)) )
-      #else
-        #define Z_MOVE_TEST !!current_block->steps.c
+        #if ENABLED(MESH_SEGMENT_FREE)
+          || TEST(prep_block->flag, BLOCK_BIT_LEVEL_LINE)
+        #endif
+      ) {
+        constexpr uint32_t segment_ticks = (STEPPER_TIMER_RATE) / (STEP_SEGMENT_FREQUENCY);
+        NOMORE(events, MAX(1UL, ((interval < segment_ticks ? segment_ticks / interval : 1UL) * prep_steps_per_isr) >> level));
+      }
+      NOMORE(events, 0xFFFFUL >> level);
+
+      const uint32_t  isr_events = events << level,
+                      ticks = ((isr_events + prep_steps_per_isr - 1) / prep_steps_per_isr) * interval;
+      trapezoid_advance(phase, ticks);
+
+      if (phase == PHASE_DECELERATE && prep_phase != PHASE_DECELERATE) SBI(prep_flag, SEGMENT_BIT_DECEL_START);
+      prep_phase = phase;
+
+      segment_t * const segment = segment_buffer.reserve();
+      segment->block          = prep_block;
+      segment->interval       = interval;
+      segment->events         = isr_events;
+      segment->steps_per_isr  = prep_steps_per_isr;
+      segment->phase          = phase;
+      segment->flag           = prep_flag;
+      #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+        segment->oversampling = oversampling_factor;
       #endif
+      #if ENABLED(DELTA_SEGMENT_FREE)
+        prepare_tower_steps(segment, events);
+      #endif
+      #if ENABLED(MESH_SEGMENT_FREE)
+        prepare_z_steps(segment, events);
+      #endif
+      #if ENABLED(LIN_ADVANCE_SMOOTHING)
+        prepare_e_steps(segment, events, ticks);
+      #endif
+      segment_buffer.commit();
+      prep_flag = 0;
+
+      // All the block sliced?
+      prep_events_completed += events;
+      if (prep_events_completed >= prep_event_count
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          && !(prep_e_stop && prep_e_carry)
+        #endif
+      ) prep_block = nullptr;
+    }
 
-      uint8_t axis_bits = 0;
-      if (X_MOVE_TEST) SBI(axis_bits, A_AXIS);
-      if (Y_MOVE_TEST) SBI(axis_bits, B_AXIS);
-      if (Z_MOVE_TEST) SBI(axis_bits, C_AXIS);
-      //if (!!current_block->steps.e) SBI(axis_bits, E_AXIS);
-      //if (!!current_block->steps[A_AXIS]) SBI(axis_bits, X_HEAD);
-      //if (!!current_block->steps[B_AXIS]) SBI(axis_bits, Y_HEAD);
-      //if (!!current_block->steps[C_AXIS]) SBI(axis_bits, Z_HEAD);
-      axis_did_move = axis_bits;
+  }
 
-      // No data.acceleration / deceleration time elapsed so far
-      acceleration_time = deceleration_time = 0;
+  void Stepper::report_underruns() {
+    static uint16_t reported = 0;
+    const uint16_t underruns = segment_underruns;
+    if (underruns == reported) return;
+    reported = underruns;
+    SERIAL_LMV(ECHO, "Step segment underruns: ", underruns);
+  }
 
-      uint8_t oversampling = 0;                           // Assume we won't use it
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
 
+    /**
+     * The E steps of the next segment of the prepared block: the nominal steps of
+     * its step events plus the change of the advance. The advance target is K times
+     * the E speed of the segment, smoothed with the time constant LIN_ADVANCE_SMOOTH_TIME.
+     * The last move before a stop, a position sync or another extruder releases all
+     * the advance, what its step events can't take goes in E only segments after them.
+     * Only the nominal steps are counted in the stepper position, as with the E ISR.
+     */
+    void Stepper::prepare_e_steps(segment_t * const segment, const uint32_t events, const uint32_t ticks) {
+
+      const block_t * const block = prep_block;
+      const uint32_t events_done = prep_events_completed + events;
+
+      // Nominal steps, rounded as the Bresenham of the block
+      const uint32_t e_nominal = (uint64_t(block->steps.e) * events_done + (prep_event_count >> 1)) / prep_event_count;
+      int32_t e_steps = e_nominal - prep_e_nominal;
+      prep_e_nominal = e_nominal;
+      if (TEST(block->direction_bits, E_AXIS)) e_steps = -e_steps;
+      segment->e_nominal = e_steps;
+
+      const float dt = float(ticks) / (STEPPER_TIMER_RATE);
+      float target = 0;
+      if (block->use_advance_lead && ticks)
+        target = extruders[prep_e_extruder]->data.advance_K * float(block->steps.e) * events / prep_event_count / dt;
+      prep_e_smoothed += (target - prep_e_smoothed) * dt / ((LIN_ADVANCE_SMOOTH_TIME) + dt);
+
+      prep_e_stop = false;
+      if (events_done >= prep_event_count) {
+        const block_t * const next = planner.nonbusy_moves_planned() ? &planner.block_buffer[planner.block_buffer_nonbusy] : nullptr;
+        prep_e_stop = !next || !next->step_event_count || TEST(next->flag, BLOCK_BIT_SYNC_POSITION)
+                      || next->active_extruder != prep_e_extruder;
+        if (prep_e_stop) prep_e_smoothed = 0;
+      }
+
+      const int32_t advance = LROUND(prep_e_smoothed);
+      e_steps += advance - prep_e_advance + prep_e_carry;
+      prep_e_advance = advance;
+
+      // One E step for each step event at most, the rest goes to the next segments
+      const int32_t limit = MIN(int32_t(segment->events), int32_t(0x7FFF));
+      prep_e_carry = e_steps - constrain(e_steps, -limit, limit);
+      segment->e_steps = e_steps - prep_e_carry;
+    }
+
+    void Stepper::prepare_e_release(const uint32_t interval) {
+
+      const int32_t e_steps = constrain(prep_e_carry, -0x7FFF, 0x7FFF);
+      prep_e_carry -= e_steps;
+
+      // One E step for each event, at the E jerk speed or at the rate the block ended if faster
+      uint8_t loops = prep_steps_per_isr;
+      uint32_t e_interval = interval;
+      const uint32_t e_rate = extruders[prep_e_extruder]->data.max_jerk * extruders[prep_e_extruder]->data.axis_steps_per_mm;
+      uint8_t e_loops;
+      const uint32_t jerk_interval = calc_multistep_interval(MAX(e_rate, 1UL), &e_loops);
+      if (jerk_interval * loops < e_interval * e_loops) {
+        e_interval = jerk_interval;
+        loops = e_loops;
+      }
+
+      segment_t * const segment = segment_buffer.reserve();
+      segment->block          = prep_block;
+      segment->interval       = e_interval;
+      segment->events         = ABS(e_steps);
+      segment->steps_per_isr  = loops;
+      segment->phase          = prep_phase;
+      segment->flag           = _BV(SEGMENT_BIT_E_ONLY);
+      segment->e_steps        = e_steps;
+      segment->e_nominal      = 0;
       #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
-        // Decide if axis smoothing is possible
-        uint32_t max_rate = current_block->nominal_rate;  // Get the maximum rate (maximum event speed)
-        while (max_rate < HAL_frequency_limit[0]) {
-          max_rate <<= 1;
-          if (max_rate >= HAL_frequency_limit[0]) break;
-          ++oversampling;
-        }
-        oversampling_factor = oversampling;
+        segment->oversampling = oversampling_factor;
       #endif
+      #if ENABLED(DELTA_SEGMENT_FREE)
+        segment->tower_steps.reset();
+      #endif
+      #if ENABLED(MESH_SEGMENT_FREE)
+        segment->z_steps = 0;
+      #endif
+      segment_buffer.commit();
 
-      // Based on the oversampling factor, do the calculations
-      step_event_count = current_block->step_event_count << oversampling;
+      if (!prep_e_carry) prep_block = nullptr;
+    }
 
-      // Initialize Bresenham delta errors to 1/2
-      delta_error = -int32_t(step_event_count);
+    FORCE_INLINE void Stepper::set_segment_e(const segment_t &segment) {
 
-      #if ENABLED(LASER)
-        delta_error_laser = delta_error.x;
-        laser.dur = current_block->laser_duration;
-      #endif
+      const int16_t e_steps = segment.e_steps;
+      const uint16_t events = segment.events;
 
-      // Calculate Bresenham dividends
-      advance_dividend = current_block->steps << 1;
+      // Releasing the advance can turn the extruder back
+      const int8_t dir = e_steps < 0 ? -1 : 1;
+      if (e_steps && dir != count_direction.e) {
+        #if ENABLED(COLOR_MIXING_EXTRUDER)
+          if (dir > 0) set_nor_E_dir(); else set_rev_E_dir();
+        #else
+          if (dir > 0) set_nor_E_dir(active_extruder_driver); else set_rev_E_dir(active_extruder_driver);
+        #endif
+        count_direction.e = dir;
+        direction_delay();
+      }
 
-      // Calculate Bresenham divisor
-      advance_divisor = step_event_count << 1;
+      count_position.e += segment.e_nominal;
 
-      // No step events completed so far
-      step_events_completed = 0;
+      // The E Bresenham runs on the events of the segment
+      advance_dividend.e = uint32_t(ABS(e_steps)) << 1;
+      segment_e_divisor = uint32_t(events) << 1;
+      delta_error.e = -int32_t(events);
+    }
 
-      // Compute the data.acceleration and deceleration points
-      accelerate_until = current_block->accelerate_until << oversampling;
-      decelerate_after = current_block->decelerate_after << oversampling;
+  #endif // ENABLED(LIN_ADVANCE_SMOOTHING)
 
-      #if ENABLED(COLOR_MIXING_EXTRUDER)
-        mixer.stepper_setup(current_block->b_color);
-      #endif
+  #if ENABLED(DELTA_SEGMENT_FREE)
 
-      #if MAX_EXTRUDER > 1
-        active_extruder = current_block->active_extruder;
-        active_extruder_driver = get_active_extruder_driver();
-      #endif
+    /**
+     * The carriage steps of the next segment of the prepared block. The step events
+     * of a line run evenly along it, so the events done give the point reached and
+     * the carriage positions there are exact. The other blocks share out their steps
+     * as the Bresenham does, and the last segment ends on the steps of the block.
+     */
+    void Stepper::prepare_tower_steps(segment_t * const segment, const uint32_t events) {
 
-      // Initialize the trapezoid generator from the current block.
-      #if ENABLED(LIN_ADVANCE)
-        #if DISABLED(COLOR_MIXING_EXTRUDER) && MAX_DRIVER_E > 1
-          // If the now active extruder wasn't in use during the last move, its pressure is most likely gone.
-          if (active_extruder != last_moved_extruder) LA_current_adv_steps = 0;
-        #endif
+      const block_t * const block = prep_block;
+      const uint32_t events_done = prep_events_completed + events;
 
-        if ((LA_use_advance_lead = current_block->use_advance_lead)) {
-          LA_final_adv_steps = current_block->final_adv_steps;
-          LA_max_adv_steps = current_block->max_adv_steps;
-          initiateLA(); // Start the ISR
-          LA_isr_rate = current_block->advance_speed;
+      abc_long_t done;
+      if (events_done >= prep_event_count) {
+        LOOP_ABC(axis) done[axis] = TEST(block->direction_bits, axis) ? -int32_t(block->steps[axis]) : int32_t(block->steps[axis]);
+      }
+      else if (TEST(block->flag, BLOCK_BIT_DELTA_LINE)) {
+        const float fraction = float(events_done) / float(prep_event_count);
+        const xyz_pos_t pos = block->line_start + block->line_dist * fraction;
+        abc_pos_t carriages;
+        mechanics.carriage_positions(pos, carriages);
+        LOOP_ABC(axis) done[axis] = LROUND(carriages[axis] * mechanics.data.axis_steps_per_mm[axis]) - prep_tower_start[axis];
+      }
+      else {
+        LOOP_ABC(axis) {
+          done[axis] = (uint64_t(block->steps[axis]) * events_done + (prep_event_count >> 1)) / prep_event_count;
+          if (TEST(block->direction_bits, axis)) done[axis] = -done[axis];
         }
-        else LA_isr_rate = LA_ADV_NEVER;
-      #endif
+      }
 
-      #if HAS_L64XX
-        // Always set direction for L64xx (This also enables the chips)
-        last_direction_bits = current_block->direction_bits;
-        #if MAX_EXTRUDER > 1
-          last_moved_extruder = active_extruder;
-        #endif
-        set_directions(true);
-      #else
-        if (current_block->direction_bits != last_direction_bits
-          #if DISABLED(COLOR_MIXING_EXTRUDER)
-            || active_extruder != last_moved_extruder
-          #endif
-        ) {
-          last_direction_bits = current_block->direction_bits;
-          #if MAX_EXTRUDER > 1
-            last_moved_extruder = active_extruder;
-          #endif
-          set_directions();
-        }
-      #endif
+      // One step for each step event at most, the rest goes to the next segments
+      const int32_t limit = MIN(int32_t(segment->events), int32_t(0x7FFF));
+      LOOP_ABC(axis) {
+        const int32_t steps = done[axis] - prep_tower_done[axis] + prep_tower_carry[axis];
+        prep_tower_done[axis] = done[axis];
+        prep_tower_carry[axis] = steps - constrain(steps, -limit, limit);
+        segment->tower_steps[axis] = steps - prep_tower_carry[axis];
+      }
+    }
 
-      // At this point, we must ensure the movement about to execute isn't
-      // trying to force the head against a limit switch. If using interrupt-
-      // driven change detection, and already against a limit then no call to
-      // the endstop_triggered method will be done and the movement will be
-      // done against the endstop. So, check the limits here: If the movement
-      // is against the limits, the block will be marked as to be killed, and
-      // on the next call to this ISR, will be discarded.
-      endstops.update();
-
-      #if ENABLED(Z_LATE_ENABLE)
-        // If delayed Z enable, enable it now. This option will severely interfere with
-        // timing between pulses when chaining motion between blocks, and it could lead
-        // to lost steps in both X and Y axis, so avoid using it unless strictly necessary!!
-        if (current_block->steps.z) enable_Z();
-      #endif
+    FORCE_INLINE void Stepper::set_segment_towers(const segment_t &segment) {
 
-      // Mark the time_nominal as not calculated yet
-      ticks_nominal = -1;
+      // Along a line a carriage can turn back
+      uint8_t dirb = last_direction_bits;
+      LOOP_ABC(axis) {
+        if (segment.tower_steps[axis] < 0) SBI(dirb, axis);
+        else if (segment.tower_steps[axis] > 0) CBI(dirb, axis);
+      }
+      if (dirb != last_direction_bits) {
+        last_direction_bits = dirb;
+        set_directions();
+      }
 
-      #if DISABLED(BEZIER_JERK_CONTROL)
-        // Set as deceleration point the initial rate of the block
-        acc_step_rate = current_block->initial_rate;
-      #else
-        // Initialize the Bézier speed curve
-        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
-        // We haven't started the 2nd half of the trapezoid
-        bezier_2nd_half = false;
-      #endif
+      // The carriage Bresenham runs on the events of the segment
+      LOOP_ABC(axis) advance_dividend[axis] = uint32_t(ABS(segment.tower_steps[axis])) << 1;
+      segment_tower_divisor = uint32_t(segment.events) << 1;
+      delta_error.x = delta_error.y = delta_error.z = -int32_t(segment.events);
+    }
 
-      #if ENABLED(LASER) && ENABLED(LASER_RASTER)
-         if (current_block->laser_mode == RASTER) counter_raster = 0;
-      #endif
+  #endif // ENABLED(DELTA_SEGMENT_FREE)
+
+  #if ENABLED(MESH_SEGMENT_FREE)
+
+    /**
+     * The Z steps of the next segment of the prepared block. The block goes straight
+     * between its leveled ends, over the mesh the Z of the mesh less that straight line
+     * is added at the point the step events reached, so the last segment ends on the
+     * steps of the block.
+     */
+    void Stepper::prepare_z_steps(segment_t * const segment, const uint32_t events) {
 
-      // Calculate the initial timer interval
-      interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+      const block_t * const block = prep_block;
+      const uint32_t events_done = prep_events_completed + events;
+
+      int32_t done = (uint64_t(block->steps.z) * events_done + (prep_event_count >> 1)) / prep_event_count;
+      if (TEST(block->direction_bits, Z_AXIS)) done = -done;
+
+      if (TEST(block->flag, BLOCK_BIT_LEVEL_LINE) && events_done < prep_event_count) {
+        const float fraction = float(events_done) / float(prep_event_count),
+                    mesh_z = bedlevel.get_z_offset(block->line_start + block->line_dist * fraction);
+        done += LROUND((mesh_z - (block->level_start + (block->level_end - block->level_start) * fraction)) * mechanics.data.axis_steps_per_mm.z);
+      }
+
+      // One step for each step event at most, the rest goes to the next segments
+      const int32_t limit = MIN(int32_t(segment->events), int32_t(0x7FFF)),
+                    steps = done - prep_z_done + prep_z_carry;
+      prep_z_done = done;
+      prep_z_carry = steps - constrain(steps, -limit, limit);
+      segment->z_steps = steps - prep_z_carry;
     }
-  }
 
-  // Continuous firing of the laser during a move happens here, PPM and raster happen further down
-  #if ENABLED(LASER)
-    if (current_block->laser_mode == CONTINUOUS && current_block->laser_status == LASER_ON)
-      laser.fire(current_block->laser_intensity);
+    FORCE_INLINE void Stepper::set_segment_z(const segment_t &segment) {
 
-    if (current_block->laser_status == LASER_OFF)
-      laser.extinguish();
-  #endif
+      // Over the mesh Z can turn back
+      uint8_t dirb = last_direction_bits;
+      if (segment.z_steps < 0) SBI(dirb, Z_AXIS);
+      else if (segment.z_steps > 0) CBI(dirb, Z_AXIS);
+      if (dirb != last_direction_bits) {
+        last_direction_bits = dirb;
+        set_directions();
+      }
 
-  // Return the interval to wait
-  return interval;
-}
+      // The Z Bresenham runs on the events of the segment
+      advance_dividend.z = uint32_t(ABS(segment.z_steps)) << 1;
+      segment_z_divisor = uint32_t(segment.events) << 1;
+      delta_error.z = -int32_t(segment.events);
+    }
+
+  #endif // ENABLED(MESH_SEGMENT_FREE)
+
+#endif // ENABLED(STEP_SEGMENT_BUFFER)
+
+#if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+
+  void Stepper::smoothing_benchmark(const xyze_ulong_t &steps, const uint32_t rate) {
+
+    uint32_t event_count = steps.x;
+    NOLESS(event_count, steps.y);
+    NOLESS(event_count, steps.z);
+    NOLESS(event_count, steps.e);
+    if (!event_count || !rate) return;
+
+    // The oversampling used for this rate: per segment it has a limit, per block it has not
+    #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+      const uint8_t max_level = smoothing_level(rate, MULTI_AXIS_STEP_SMOOTHING_LEVELS);
+    #else
+      const uint8_t max_level = smoothing_level(rate, 31);
+    #endif
+
+    // Pulses in the same ISR go back to back
+    const uint32_t pulse_ticks = HAL_pulse_high_tick + HAL_pulse_low_tick;
+
+    for (uint8_t level = 0; level <= max_level; level++) {
+
+      uint8_t loops;
+      const uint32_t interval = calc_multistep_interval(rate << level, &loops);
+
+      // Model the first 65536 events at most, the pattern of the steps repeats anyway
+      const uint32_t  events  = event_count << level,
+                      divisor = events << 1,
+                      todo    = MIN(events, 0x10000UL);
+
+      xyze_long_t delta;
+      delta = -int32_t(events);
+      xyze_ulong_t last_pulse{0};
+      xyze_float_t deviation{0};
+      xyze_ulong_t pulses{0};
+
+      // The period of even steps for each axis, over the whole block
+      const float block_ticks = float(interval) * events / loops;
+
+      for (uint32_t e = 0; e < todo; e++) {
+        const uint32_t tick = (e / loops) * interval + (e % loops) * pulse_ticks;
+        LOOP_XYZE(i) {
+          delta[i] += steps[i] << 1;
+          if (delta[i] >= 0) {
+            delta[i] -= divisor;
+            if (pulses[i]++) {
+              const float error = ABS(float(tick - last_pulse[i]) - block_ticks / steps[i]);
+              NOLESS(deviation[i], error);
+            }
+            last_pulse[i] = tick;
+          }
+        }
+      }
+
+      SERIAL_MV("Level:", int(level));
+      SERIAL_MV(" Rate:", rate << level);
+      SERIAL_MV(" Loops:", int(loops));
+      SERIAL_MSG(" Deviation(us)");
+      LOOP_XYZE(i) {
+        if (!steps[i]) continue;
+        SERIAL_CHR(' ');
+        SERIAL_CHR(axis_codes[i]);
+        SERIAL_MV(":", deviation[i] / (STEPPER_TIMER_TICKS_PER_US), 2);
+      }
+      SERIAL_EOL();
+    }
+
+  }
+
+#endif // ENABLED(ADAPTIVE_STEP_SMOOTHING)
+
+#if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(DELTA_SEGMENT_FREE)
+  #define AXIS_DIVISOR segment_tower_divisor  // The carriages run on the events of the segment
+#else
+  #define AXIS_DIVISOR advance_divisor
+#endif
+#if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(MESH_SEGMENT_FREE)
+  #define Z_AXIS_DIVISOR segment_z_divisor    // Z runs on the events of the segment
+#else
+  #define Z_AXIS_DIVISOR AXIS_DIVISOR
+#endif
 
 FORCE_INLINE void Stepper::pulse_tick_prepare() {
 
@@ -1840,7 +2586,11 @@ FORCE_INLINE void Stepper::pulse_tick_prepare() {
     step_needed.x = (delta_error.x >= 0);
     if (step_needed.x) {
       count_position.x += count_direction.x;
-      delta_error.x -= advance_divisor;
+      delta_error.x -= AXIS_DIVISOR;
+      #if ENABLED(INPUT_SHAPING)
+        if (inputshaping.axis[X_AXIS].enabled())
+          step_needed.x = set_X_shaped_dir(inputshaping.axis[X_AXIS].push(count_direction.x, inputshaping.clock));
+      #endif
     }
   #endif
 
@@ -1849,7 +2599,11 @@ FORCE_INLINE void Stepper::pulse_tick_prepare() {
     step_needed.y = (delta_error.y >= 0);
     if (step_needed.y) {
       count_position.y += count_direction.y;
-      delta_error.y -= advance_divisor;
+      delta_error.y -= AXIS_DIVISOR;
+      #if ENABLED(INPUT_SHAPING)
+        if (inputshaping.axis[Y_AXIS].enabled())
+          step_needed.y = set_Y_shaped_dir(inputshaping.axis[Y_AXIS].push(count_direction.y, inputshaping.clock));
+      #endif
     }
   #endif
 
@@ -1858,12 +2612,17 @@ FORCE_INLINE void Stepper::pulse_tick_prepare() {
     step_needed.z = (delta_error.z >= 0);
     if (step_needed.z) {
       count_position.z += count_direction.z;
-      delta_error.z -= advance_divisor;
+      delta_error.z -= Z_AXIS_DIVISOR;
     }
   #endif
 
   // Pulse Extruders
-  #if ENABLED(LIN_ADVANCE) || ENABLED(COLOR_MIXING_EXTRUDER)
+  #if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(LIN_ADVANCE_SMOOTHING)
+    // The segment counted the nominal steps
+    delta_error.e += advance_dividend.e;
+    step_needed.e = (delta_error.e >= 0);
+    if (step_needed.e) delta_error.e -= segment_e_divisor;
+  #elif ENABLED(LIN_ADVANCE) || ENABLED(COLOR_MIXING_EXTRUDER)
     delta_error.e += advance_dividend.e;
     if (delta_error.e >= 0) {
       count_position.e += count_direction.e;
@@ -1900,7 +2659,7 @@ FORCE_INLINE void Stepper::pulse_tick_start() {
     if (step_needed.z) start_Z_step();
   #endif
 
-  #if DISABLED(LIN_ADVANCE)
+  #if !HAS_LIN_ADVANCE_ISR
     #if ENABLED(COLOR_MIXING_EXTRUDER)
       if (step_needed.e) e_step_write(mixer.get_next_stepper(), !driver.e[0]->isStep());
     #else
@@ -1924,7 +2683,7 @@ FORCE_INLINE void Stepper::pulse_tick_stop() {
     if (step_needed.z) stop_Z_step();
   #endif
 
-  #if DISABLED(LIN_ADVANCE)
+  #if !HAS_LIN_ADVANCE_ISR
     #if ENABLED(COLOR_MIXING_EXTRUDER)
       if (step_needed.e) e_step_write(mixer.get_stepper(), driver.e[0]->isStep());
     #else
@@ -2173,6 +2932,66 @@ FORCE_INLINE void Stepper::set_rev_E_dir(const uint8_t e/*=0*/) {
   #endif
 }
 
+#if ENABLED(INPUT_SHAPING)
+
+  /**
+   * Set direction of the shaped X Y motors
+   */
+  FORCE_INLINE bool Stepper::set_X_shaped_dir(const int8_t s) {
+    if (!s) return false;
+    if (s != inputshaping.axis[X_AXIS].direction) {
+      inputshaping.axis[X_AXIS].direction = s;
+      set_X_dir(s > 0 ? !driver.x->isDir() : driver.x->isDir());
+      direction_delay();
+    }
+    return true;
+  }
+  FORCE_INLINE bool Stepper::set_Y_shaped_dir(const int8_t s) {
+    if (!s) return false;
+    if (s != inputshaping.axis[Y_AXIS].direction) {
+      inputshaping.axis[Y_AXIS].direction = s;
+      set_Y_dir(s > 0 ? !driver.y->isDir() : driver.y->isDir());
+      direction_delay();
+    }
+    return true;
+  }
+
+  /**
+   * Do the delayed impulses that are due, one pulse for each motor step.
+   * The low time is respected against the main phase pulses on both sides.
+   */
+  void Stepper::shaping_step() {
+
+    // The main phase could have just pulsed
+    hal_timer_t pulse_tick_end = HAL_timer_get_current_count(STEPPER_TIMER_NUM) + HAL_pulse_low_tick;
+
+    for (;;) {
+      const bool  step_x = set_X_shaped_dir(inputshaping.axis[X_AXIS].echo(inputshaping.clock)),
+                  step_y = set_Y_shaped_dir(inputshaping.axis[Y_AXIS].echo(inputshaping.clock));
+
+      if (!step_x && !step_y) break;
+
+      while (HAL_timer_get_current_count(STEPPER_TIMER_NUM) < pulse_tick_end) { /* nada */ }
+
+      if (step_x) start_X_step();
+      if (step_y) start_Y_step();
+
+      pulse_tick_end = HAL_timer_get_current_count(STEPPER_TIMER_NUM) + HAL_pulse_high_tick;
+      while (HAL_timer_get_current_count(STEPPER_TIMER_NUM) < pulse_tick_end) { /* nada */ }
+
+      if (step_x) stop_X_step();
+      if (step_y) stop_Y_step();
+
+      pulse_tick_end = HAL_timer_get_current_count(STEPPER_TIMER_NUM) + HAL_pulse_low_tick;
+    }
+
+    // And it could pulse as soon as we return
+    while (HAL_timer_get_current_count(STEPPER_TIMER_NUM) < pulse_tick_end) { /* nada */ }
+
+  }
+
+#endif // ENABLED(INPUT_SHAPING)
+
 /**
  * Set the stepper positions directly in steps
  *
@@ -2236,19 +3055,50 @@ void Stepper::_set_position(const int32_t &a, const int32_t &b, const int32_t &c
  * properly schedules blocks from the planner. This is executed after creating
  * the step pulses, so it is not time critical, as pulses are already done.
  */
-#if ENABLED(LIN_ADVANCE)
+#if HAS_LIN_ADVANCE_ISR
+
+  // Wake up the advance ISR for the trapezoid phase of the step events about to go
+  FORCE_INLINE void Stepper::advance_isr_trigger(const uint8_t phase, const bool decel_start) {
+    if (phase == PHASE_ACCELERATE) {
+      // Fire ISR if final adv_rate is reached
+      if (LA_steps && (!LA_use_advance_lead || LA_isr_rate != current_block->advance_speed))
+        initiateLA();
+    }
+    else if (phase == PHASE_DECELERATE) {
+      if (LA_use_advance_lead) {
+        // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
+        if (decel_start || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
+          initiateLA();
+          LA_isr_rate = current_block->advance_speed;
+        }
+      }
+      else if (LA_steps) initiateLA();
+    }
+    else {
+      // If there are any esteps, fire the next advance_isr "now"
+      if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
+    }
+  }
 
   // Timer interrupt for E. LA_steps is set in the main routine
   uint32_t Stepper::lin_advance_step() {
     uint32_t interval;
 
     if (LA_use_advance_lead) {
-      if (step_events_completed > decelerate_after && LA_current_adv_steps > LA_final_adv_steps) {
+      #if ENABLED(STEP_SEGMENT_BUFFER)
+        // The trapezoid points belong to the preparation, follow the phase of the segment
+        const bool decelerating = segment_phase == PHASE_DECELERATE,
+                   before_decel = !decelerating;
+      #else
+        const bool decelerating = step_events_completed > decelerate_after,
+                   before_decel = step_events_completed < decelerate_after;
+      #endif
+      if (decelerating && LA_current_adv_steps > LA_final_adv_steps) {
         LA_steps--;
         LA_current_adv_steps--;
         interval = LA_isr_rate;
       }
-      else if (step_events_completed < decelerate_after && LA_current_adv_steps < LA_max_adv_steps) {
+      else if (before_decel && LA_current_adv_steps < LA_max_adv_steps) {
              //step_events_completed <= (uint32_t)accelerate_until) {
         LA_steps++;
         LA_current_adv_steps++;
@@ -2313,7 +3163,7 @@ void Stepper::_set_position(const int32_t &a, const int32_t &b, const int32_t &c
     return interval;
   }
 
-#endif // ENABLED(LIN_ADVANCE)
+#endif // HAS_LIN_ADVANCE_ISR
 
 #if ENABLED(BEZIER_JERK_CONTROL)
 
@@ -53,6 +53,31 @@ struct stepper_data_t {
             drivers_e       :  3;
   bool      quad_stepping   :  1;
 };
+
+#if ENABLED(STEP_SEGMENT_BUFFER)
+  // Struct Step segment, a run of step events at constant rate prepared out of the ISR
+  struct segment_t {
+    block_t     *block;         // The planner block the step events belong to
+    hal_timer_t interval;       // Stepper timer ticks between the ISRs
+    uint16_t    events;         // Step events in the segment
+    uint8_t     steps_per_isr,  // Step events for each ISR
+                phase,          // Trapezoid phase (See TrapezoidPhaseEnum)
+                flag;           // Segment flags (See SegmentFlagBitEnum)
+    #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+      uint8_t   oversampling;   // Oversampling factor of the block
+    #endif
+    #if ENABLED(LIN_ADVANCE_SMOOTHING)
+      int16_t   e_steps,        // Extruder steps of the segment, advance included
+                e_nominal;      // Extruder steps of the segment without the advance
+    #endif
+    #if ENABLED(DELTA_SEGMENT_FREE)
+      xyz_int_t tower_steps;    // Carriage steps of the segment, signed
+    #endif
+    #if ENABLED(MESH_SEGMENT_FREE)
+      int16_t   z_steps;        // Z steps of the segment, mesh included, signed
+    #endif
+  };
+#endif
   
 class Stepper {
 
@@ -125,7 +150,7 @@ class Stepper {
       static bool bezier_2nd_half;  // If Bzier curve has been initialized or not
     #endif
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_LIN_ADVANCE_ISR
       static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
       static uint32_t nextAdvanceISR, LA_isr_rate;
       static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps;
@@ -138,6 +163,56 @@ class Stepper {
       static uint32_t acc_step_rate; // needed for deceleration start point
     #endif
 
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      static SPSC_Queue<segment_t, STEP_SEGMENT_BUFFER_SIZE> segment_buffer;
+
+      // Segment preparation, out of the ISR
+      static block_t* volatile  prep_block;             // The block being sliced into segments
+      static uint32_t           prep_events_completed,  // The step events sliced so far from the block
+                                prep_event_count;       // The total event count for the block
+      static uint8_t            prep_steps_per_isr,     // Steps per ISR kept by the cruise
+                                prep_phase,             // Phase of the last segment
+                                prep_flag;              // Flags for the next segment
+
+      // Segment playback, in the ISR
+      static volatile bool      segment_abort;          // The current block was aborted, drop its segments
+      static volatile uint16_t  segment_underruns;      // Times the buffer ran dry while playing a block
+      static bool               segment_underrun;       // The buffer is dry, counted once
+      static hal_timer_t        segment_interval;       // The interval of the segment being played
+      static uint16_t           segment_events;         // The step events left in the segment
+      static uint8_t            segment_phase;          // The trapezoid phase of the segment
+      static bool               segment_decel_start;    // The first ISR of the deceleration
+      #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+        static uint8_t          segment_shift;          // Block events are counted oversampled by the max level, less the segment level
+      #endif
+
+      #if ENABLED(LIN_ADVANCE_SMOOTHING)
+        // Extruder advance, prepared with the segments
+        static uint32_t         prep_e_nominal;         // Nominal E steps sliced so far from the block
+        static int32_t          prep_e_advance,         // Advance steps given to the segments so far
+                                prep_e_carry;           // E steps over one per step event, left for the next segments
+        static float            prep_e_smoothed;        // Smoothed advance target, in steps
+        static uint8_t          prep_e_extruder;        // The extruder holding the advance
+        static bool             prep_e_stop;            // The block ends with a stop, the carry is released with it
+        static uint32_t         segment_e_divisor;      // Bresenham divisor for the E steps of the segment
+      #endif
+
+      #if ENABLED(DELTA_SEGMENT_FREE)
+        // Delta carriage steps, prepared with the segments
+        static abc_long_t       prep_tower_start,       // Carriage steps at the start of the line
+                                prep_tower_done,        // Carriage steps sliced so far from the block
+                                prep_tower_carry;       // Carriage steps over one per step event, left for the next segments
+        static uint32_t         segment_tower_divisor;  // Bresenham divisor for the carriage steps of the segment
+      #endif
+
+      #if ENABLED(MESH_SEGMENT_FREE)
+        // Z over the mesh, prepared with the segments
+        static int32_t          prep_z_done,            // Z steps sliced so far from the block
+                                prep_z_carry;           // Z steps over one per step event, left for the next segments
+        static uint32_t         segment_z_divisor;      // Bresenham divisor for the Z steps of the segment
+      #endif
+    #endif
+
     static xyz_long_t endstops_trigsteps;
 
     /**
@@ -206,6 +281,25 @@ class Stepper {
      */
     static bool is_block_busy(const block_t* const block);
 
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      /**
+       * Slice the planner blocks into step segments until the buffer is full.
+       * Called from Printer::idle() only, the ISR waits when the buffer runs dry.
+       */
+      static void prepare_segments();
+
+      // Print the underrun count when it changed
+      static void report_underruns();
+    #endif
+
+    #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+      /**
+       * Model the pulses of a block at a constant step rate for every oversampling level
+       * up to the one in use, and report the worst step interval deviation for each axis
+       */
+      static void smoothing_benchmark(const xyze_ulong_t &steps, const uint32_t rate);
+    #endif
+
     /**
      * Get the position of a stepper, in steps
      */
@@ -370,6 +464,25 @@ class Stepper {
      */
     static uint32_t block_phase_step();
 
+    /**
+     * Set up the current block for stepping, and release it when done
+     */
+    FORCE_INLINE static void setup_block(const uint8_t oversampling);
+    FORCE_INLINE static void end_block();
+
+    /**
+     * Trapezoid generator: start a block, get the interval and steps per ISR
+     * for a step event and advance the time of the phase
+     */
+    static void trapezoid_start(const block_t * const block);
+    FORCE_INLINE static uint32_t trapezoid_interval(const block_t * const block, const uint32_t completed, uint8_t &phase, uint8_t &loops);
+    FORCE_INLINE static void trapezoid_advance(const uint8_t phase, const uint32_t ticks) {
+      if (phase == PHASE_ACCELERATE)
+        acceleration_time += ticks;
+      else if (phase == PHASE_DECELERATE)
+        deceleration_time += ticks;
+    }
+
     /**
      * Direction delay
      */
@@ -438,10 +551,45 @@ class Stepper {
       static uint8_t get_active_extruder_driver();
     #endif
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_LIN_ADVANCE_ISR
       // The Linear advance stepper Step
       static uint32_t lin_advance_step();
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
+      // Fire the Linear advance ISR as required by the trapezoid phase
+      FORCE_INLINE static void advance_isr_trigger(const uint8_t phase, const bool decel_start);
+    #endif
+
+    #if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(DELTA_SEGMENT_FREE)
+      // The carriage steps of the next segment, on the line of the block or shared out evenly
+      static void prepare_tower_steps(segment_t * const segment, const uint32_t events);
+      // Set the carriage directions and Bresenham for the segment about to play
+      FORCE_INLINE static void set_segment_towers(const segment_t &segment);
+    #endif
+
+    #if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(MESH_SEGMENT_FREE)
+      // The Z steps of the next segment, the mesh added on the lines over it
+      static void prepare_z_steps(segment_t * const segment, const uint32_t events);
+      // Set the Z direction and Bresenham for the segment about to play
+      FORCE_INLINE static void set_segment_z(const segment_t &segment);
+    #endif
+
+    #if ENABLED(STEP_SEGMENT_BUFFER) && ENABLED(LIN_ADVANCE_SMOOTHING)
+      // The E steps of the next segment, nominal and advance
+      static void prepare_e_steps(segment_t * const segment, const uint32_t events, const uint32_t ticks);
+      // A segment of the E steps left over at the end of the block
+      static void prepare_e_release(const uint32_t interval);
+      // Set the E direction and Bresenham for the segment about to play
+      FORCE_INLINE static void set_segment_e(const segment_t &segment);
+      // Forget the advance, the extruder starts with no pressure
+      FORCE_INLINE static void reset_e_advance() { prep_e_smoothed = 0; prep_e_advance = prep_e_carry = 0; }
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      // The delayed impulses of the shaped X Y motors
+      static void shaping_step();
+      // Set the direction of a shaped motor for the step s (1 or -1), false for no step
+      FORCE_INLINE static bool set_X_shaped_dir(const int8_t s);
+      FORCE_INLINE static bool set_Y_shaped_dir(const int8_t s);
     #endif
 
     #if ENABLED(BEZIER_JERK_CONTROL)
@@ -469,12 +617,29 @@ class Stepper {
       }
     #endif
 
+    #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+      // The highest oversampling that keeps one step event for each ISR
+      FORCE_INLINE static uint8_t smoothing_level(const uint32_t step_rate, const uint8_t max_level) {
+        uint8_t level = 0;
+        while (level < max_level && (step_rate << (level + 1)) < HAL_frequency_limit[0]) ++level;
+        return level;
+      }
+    #endif
+
     FORCE_INLINE static hal_timer_t calc_timer_interval(uint32_t step_rate, uint8_t* loops) {
 
-      uint8_t multistep = 1;
+      #if ENABLED(MULTI_AXIS_STEP_SMOOTHING)
+        // The oversampling goes with the rate, the segment takes it along
+        oversampling_factor = smoothing_level(step_rate, MULTI_AXIS_STEP_SMOOTHING_LEVELS);
+      #endif
 
       // Scale the frequency, as requested by the caller
-      step_rate <<= oversampling_factor;
+      return calc_multistep_interval(step_rate << oversampling_factor, loops);
+    }
+
+    FORCE_INLINE static hal_timer_t calc_multistep_interval(uint32_t step_rate, uint8_t* loops) {
+
+      uint8_t multistep = 1;
 
       if (data.quad_stepping) {
         // Select the proper multistepping
@@ -65,7 +65,7 @@ void Heater::init() {
 
   thermal_runaway_state = TRInactive;
 
-  data.sensor.CalcDerivedParameters();
+  update_sensor_parameters();
 
   if (printer.isRunning()) return; // All running not reinitialize
 
@@ -217,30 +217,30 @@ void Heater::get_output() {
 
     #if HAS_COOLERS
       if (type == IS_COOLER) {
-        if (isUsePid()) {
-          pwm_value = data.pid.compute(current_temperature, targetTemperature
-            #if ENABLED(PID_ADD_EXTRUSION_RATE)
-              , 0xFF
-            #endif
-          );
-        }
+        if (isUsePid())
+          pwm_value = data.pid.compute(current_temperature, targetTemperature);
         else if (next_check_timer.expired(temp_check_interval))
           pwm_value = current_temperature >= targetTemperature ? data.pid.drive.max : 0;
       }
       else
     #endif
       {
-        if (current_temperature >= targetTemperature + temp_hysteresis)
+        if (current_temperature >= targetTemperature + temp_hysteresis) {
           pwm_value = 0;
-        else if (current_temperature <= targetTemperature - temp_hysteresis)
+          data.pid.suspend();
+        }
+        else if (current_temperature <= targetTemperature - temp_hysteresis) {
           pwm_value = data.pid.Max;
+          data.pid.suspend();
+        }
         else if (isUsePid()) {
           #if ENABLED(PID_ADD_EXTRUSION_RATE)
-            const uint8_t id = (type == IS_HOTEND) ? data.ID : 0xFF;
+            // Planned extrusion speed of the extruder on this hotend
+            const float flow = (type == IS_HOTEND && data.ID == toolManager.active_hotend()) ? planner.extrusion_rate : 0.0f;
           #endif
           pwm_value = data.pid.compute(targetTemperature, current_temperature
             #if ENABLED(PID_ADD_EXTRUSION_RATE)
-              , id, tempManager.heater.lpq_len
+              , flow
             #endif
           );
         }
@@ -262,6 +262,8 @@ void Heater::get_output() {
     */
 
   }
+  else
+    data.pid.suspend();
 
 }
 
@@ -583,8 +585,9 @@ void Heater::print_M301() {
     if (heater_id < 0) SERIAL_MSG(" T<tools>");
     SERIAL_MSG(" P<Proportional> I<Integral> D<Derivative>");
     #if ENABLED(PID_ADD_EXTRUSION_RATE)
-      if (type == IS_HOTEND) SERIAL_MSG(" C<Kc term> L<LPQ length>");
+      if (type == IS_HOTEND) SERIAL_MSG(" C<Kc term>");
     #endif
+    SERIAL_MSG(" S<Sample ms>");
     SERIAL_CHR(':');
     SERIAL_EOL();
     SERIAL_SMV(CFG, "  M301 H", int(heater_id));
@@ -593,11 +596,9 @@ void Heater::print_M301() {
     SERIAL_MV(" I", data.pid.Ki);
     SERIAL_MV(" D", data.pid.Kd);
     #if ENABLED(PID_ADD_EXTRUSION_RATE)
-      if (type == IS_HOTEND) {
-        SERIAL_MV(" C", data.pid.Kc);
-        SERIAL_MV(" L", (int)tempManager.heater.lpq_len);
-      }
+      if (type == IS_HOTEND) SERIAL_MV(" C", data.pid.Kc);
     #endif
+    SERIAL_MV(" S", data.pid.sample_period);
     SERIAL_EOL();
   }
 }
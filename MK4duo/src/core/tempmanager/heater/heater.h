@@ -101,6 +101,10 @@ class Heater {
 
     bool            Pidtuning;
 
+    #if ENABLED(THERMISTOR_LUT)
+      thermistor_lut_t sensor_lut;
+    #endif
+
   public: /** Public Function */
 
     void init();
@@ -129,7 +133,19 @@ class Heater {
     void thermal_runaway_protection();
     void start_watching();
 
-    FORCE_INLINE void update_current_temperature() { this->current_temperature = this->data.sensor.getTemperature(); }
+    #if ENABLED(THERMISTOR_LUT)
+      FORCE_INLINE void update_current_temperature() { this->current_temperature = this->data.sensor.getTemperature(this->sensor_lut); }
+    #else
+      FORCE_INLINE void update_current_temperature() { this->current_temperature = this->data.sensor.getTemperature(); }
+    #endif
+
+    // Recalculate the sensor coefficients after a change of its parameters
+    FORCE_INLINE void update_sensor_parameters() {
+      this->data.sensor.CalcDerivedParameters();
+      #if ENABLED(THERMISTOR_LUT)
+        this->data.sensor.CalcLut(this->sensor_lut);
+      #endif
+    }
     FORCE_INLINE int16_t deg_current()  { return this->current_temperature + 0.5f; }
     FORCE_INLINE int16_t deg_target()   { return this->target_temperature;  }
     FORCE_INLINE int16_t deg_idle()     { return this->idle_temperature;    }
@@ -23,75 +23,96 @@
 
 /**
  * pid.h - pid object
+ *
+ * Ki and Kd are per second, the computation runs every sample_period ms
+ * with the measured time between samples:
+ *
+ *  - Proportional and derivative on the temperature, not on the error,
+ *    so a change of target does not kick the output.
+ *  - Derivative through a first order filter with time constant
+ *    Kd / (Kp * PID_DERIVATIVE_FILTER_N).
+ *  - Anti-windup by back-calculation: the integral is unwound by the part of
+ *    the output cut by the limits, with tracking time sqrt(Kd / Ki).
+ *  - With PID_ADD_EXTRUSION_RATE, Kc times the planned extrusion speed in mm/s.
  */
 
-#if ENABLED(PID_ADD_EXTRUSION_RATE)
-  static long last_e_position   = 0,
-              lpq[LPQ_MAX_LEN]  = { 0 };
-  static int  lpq_ptr           = 0;
-#endif
-
 struct pid_data_t {
 
   public: /** Public Parameters */
 
     float           Kp, Ki, Kd, Kc;
+    uint16_t        sample_period;
     uint8_t         Max;
     limit_uchar_t   drive;
 
   private: /** Private Parameters */
 
     float iState_sum  = 0.0,
+          dState      = 0.0,
           pid_output  = 0.0,
           last_temp   = 0.0;
 
-    short_timer_t next_sample_ms;
+    millis_s  last_sample_ms  = 0;
+    bool      sampling        = false;
 
   public: /** Public Function */
 
-    void init() { next_sample_ms.start(); }
+    void init() { reset(); }
+
+    void reset() { iState_sum = dState = pid_output = 0.0; sampling = false; }
 
-    void reset() { iState_sum = pid_output = 0.0; }
+    // Stop sampling while the heater is not under PID control, the next compute restarts from the current temperature
+    void suspend() { sampling = false; }
 
     float compute(const float target_temp, const float current_temp
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
-        , const uint8_t tid, const int16_t lpq_len=0
+        , const float flow=0.0f
       #endif
     ) {
 
-      if (next_sample_ms.expired(1000UL)) {
+      const millis_s now = millis();
 
-        const float pid_error = target_temp - current_temp,
-                    dInput    = current_temp - last_temp,
-                    dTerm     = Kd * dInput;
+      if (!sampling) {
+        sampling        = true;
+        last_temp       = current_temp;
+        dState          = 0.0;
+        last_sample_ms  = now - sample_period;
+      }
 
-        // Compute PID output
-        iState_sum += Ki * pid_error;
-        iState_sum -= Kp * dInput;
-        LIMIT(iState_sum, drive.min, drive.max);
-        pid_output = iState_sum - dTerm;
-
-        #if ENABLED(PID_ADD_EXTRUSION_RATE)
-          if (tid == toolManager.active_hotend()) {
-            const long e_position = stepper.position(E_AXIS);
-            if (e_position > last_e_position) {
-              lpq[lpq_ptr] = e_position - last_e_position;
-              last_e_position = e_position;
-            }
-            else {
-              lpq[lpq_ptr] = 0;
-            }
-            if (++lpq_ptr >= lpq_len) lpq_ptr = 0;
-            pid_output += (lpq[lpq_ptr] * extruders[toolManager.extruder.active]->steps_to_mm) * Kc;
-          }
-        #endif // PID_ADD_EXTRUSION_RATE
-
-        LIMIT(pid_output, 0, Max);
-
-        last_temp = current_temp;
+      const millis_s elapsed = now - last_sample_ms;
+      if (elapsed < sample_period) return pid_output;
+      last_sample_ms = now;
+
+      const float dt        = elapsed * 0.001f,
+                  pid_error = target_temp - current_temp,
+                  dInput    = current_temp - last_temp,
+                  Tf        = Kp > 0.0f ? Kd / (Kp * (PID_DERIVATIVE_FILTER_N)) : 0.0f;
+
+      // Filtered derivative in °C/s
+      dState += (dInput / dt - dState) * dt / (Tf + dt);
 
+      // Compute PID output
+      iState_sum += Ki * dt * pid_error;
+      iState_sum -= Kp * dInput;
+      LIMIT(iState_sum, drive.min, drive.max);
+
+      float output = iState_sum - Kd * dState;
+
+      #if ENABLED(PID_ADD_EXTRUSION_RATE)
+        output += Kc * flow;
+      #endif
+
+      pid_output = constrain(output, 0, Max);
+
+      // Back-calculation anti-windup
+      if (Ki > 0.0f && pid_output != output) {
+        const float Tt = SQRT(Kd / Ki);
+        iState_sum += (pid_output - output) * (Tt > dt ? dt / Tt : 1.0f);
+        LIMIT(iState_sum, drive.min, drive.max);
       }
 
+      last_temp = current_temp;
+
       return pid_output;
     }
 
@@ -28,6 +28,15 @@
  */
 
 // Temperature defines
+#if HOTEND_ADC_SAMPLES < 1 || HOTEND_ADC_SAMPLES > 64 || BED_ADC_SAMPLES < 1 || BED_ADC_SAMPLES > 64
+  #error "DEPENDENCY ERROR: HOTEND_ADC_SAMPLES and BED_ADC_SAMPLES must be between 1 and 64."
+#endif
+#if CHAMBER_ADC_SAMPLES < 1 || CHAMBER_ADC_SAMPLES > 64 || COOLER_ADC_SAMPLES < 1 || COOLER_ADC_SAMPLES > 64
+  #error "DEPENDENCY ERROR: CHAMBER_ADC_SAMPLES and COOLER_ADC_SAMPLES must be between 1 and 64."
+#endif
+#if ENABLED(THERMISTOR_LUT) && HAS_VREF_MONITOR
+  #error "DEPENDENCY ERROR: THERMISTOR_LUT is not compatible with HAVE_VREF_MONITOR."
+#endif
 #if ENABLED(TEMP_RESIDENCY_TIME)
   #if DISABLED(HOTEND_HYSTERESIS)
     #error "DEPENDENCY ERROR: Missing setting HOTEND_HYSTERESIS."
@@ -145,6 +154,12 @@
 #if DISABLED(HOTEND_Kd)
   #error "DEPENDENCY ERROR: Missing setting HOTEND_Kd."
 #endif
+#if DISABLED(HOTEND_PID_SAMPLE_MS)
+  #error "DEPENDENCY ERROR: Missing setting HOTEND_PID_SAMPLE_MS."
+#endif
+#if DISABLED(PID_DERIVATIVE_FILTER_N)
+  #error "DEPENDENCY ERROR: Missing setting PID_DERIVATIVE_FILTER_N."
+#endif
 
 #if HAS_TEMP_BED0
   #if DISABLED(BED_POWER_MAX)
@@ -162,6 +177,9 @@
   #if DISABLED(BED_CHECK_INTERVAL)
     #error "DEPENDENCY ERROR: Missing setting BED_CHECK_INTERVAL."
   #endif
+  #if DISABLED(BED_PID_SAMPLE_MS)
+    #error "DEPENDENCY ERROR: Missing setting BED_PID_SAMPLE_MS."
+  #endif
 #endif
 #if (PIDTEMPBED)
   #if !HAS_TEMP_BED0
@@ -194,6 +212,9 @@
   #if DISABLED(CHAMBER_CHECK_INTERVAL)
     #error "DEPENDENCY ERROR: Missing setting CHAMBER_CHECK_INTERVAL."
   #endif
+  #if DISABLED(CHAMBER_PID_SAMPLE_MS)
+    #error "DEPENDENCY ERROR: Missing setting CHAMBER_PID_SAMPLE_MS."
+  #endif
 #endif
 #if (PIDTEMPCHAMBER)
   #if !HAS_TEMP_CHAMBER0
@@ -227,6 +248,9 @@
   #if DISABLED(COOLER_CHECK_INTERVAL)
     #error "DEPENDENCY ERROR: Missing setting COOLER_CHECK_INTERVAL."
   #endif
+  #if DISABLED(COOLER_PID_SAMPLE_MS)
+    #error "DEPENDENCY ERROR: Missing setting COOLER_PID_SAMPLE_MS."
+  #endif
 #endif
 #if (PIDTEMPCOOLER)
   #if !HAS_TEMP_COOLER
@@ -28,6 +28,30 @@
 #include "thermistor.h"
 #include "pt100.h"
 
+#if ENABLED(THERMISTOR_LUT)
+
+  #define THERMISTOR_LUT_TEMP_MIN   -20
+  #define THERMISTOR_LUT_TEMP_STEP   10
+  #define THERMISTOR_LUT_SIZE        51   // -20°C to 480°C
+
+  // Fraction bits of the ADC values in the table
+  #if AD_RANGE <= 8192
+    #define THERMISTOR_LUT_SHIFT 3
+  #elif AD_RANGE <= 16384
+    #define THERMISTOR_LUT_SHIFT 2
+  #elif AD_RANGE <= 32768
+    #define THERMISTOR_LUT_SHIFT 1
+  #else
+    #define THERMISTOR_LUT_SHIFT 0
+  #endif
+
+  // ADC value of every THERMISTOR_LUT_TEMP_STEP from THERMISTOR_LUT_TEMP_MIN, falling with the temperature
+  struct thermistor_lut_t {
+    uint16_t adc[THERMISTOR_LUT_SIZE];
+  };
+
+#endif
+
 typedef struct {
 
   public: /** Public Parameters */
@@ -57,6 +81,53 @@ typedef struct {
       shA = 1.0 / (25.0 - ABS_ZERO) - shB * lnR25 - shC * lnR25 * lnR25 * lnR25;
     }
 
+    #if ENABLED(THERMISTOR_LUT)
+
+      /**
+       * Fill the table with the ADC value of each temperature step,
+       * solving Steinhart-Hart for the resistance and the divider for the ADC.
+       * Call after CalcDerivedParameters().
+       */
+      void CalcLut(thermistor_lut_t &lut) {
+        const float adc_low = 2 * adc_low_offset,
+                    adc_max = AD_RANGE + (2 * adc_high_offset);
+        for (uint8_t i = 0; i < THERMISTOR_LUT_SIZE; i++) {
+          const float recipT = 1.0f / (THERMISTOR_LUT_TEMP_MIN + i * THERMISTOR_LUT_TEMP_STEP - (ABS_ZERO));
+          // Newton on shC * x^3 + shB * x + shA = 1/T, exact at the first step if shC is 0
+          float logResistance = (recipT - shA) / shB;
+          for (uint8_t n = 0; n < 4; n++)
+            logResistance -= (shA + shB * logResistance + shC * logResistance * logResistance * logResistance - recipT)
+                           / (shB + 3.0f * shC * logResistance * logResistance);
+          const float resistance  = EXP(logResistance),
+                      adc         = (resistance * (adc_max - 0.5f) + pullup_res * (adc_low - 0.5f)) / (resistance + pullup_res);
+          lut.adc[i] = constrain(LROUND(adc * (1 << THERMISTOR_LUT_SHIFT)), 0, 65535);
+        }
+      }
+
+      /**
+       * Thermistor temperature by interpolation between the two table
+       * values around the reading, in fixed point 1/16°C.
+       * Readings out of the table use the Steinhart-Hart equation.
+       */
+      float getTemperature(const thermistor_lut_t &lut) {
+        if (WITHIN(type, 1, 9)) {
+          const uint16_t adc = uint16_t(adc_raw) << THERMISTOR_LUT_SHIFT;
+          if (adc <= lut.adc[0] && adc > lut.adc[THERMISTOR_LUT_SIZE - 1]) {
+            uint8_t lo = 0, hi = THERMISTOR_LUT_SIZE - 1;
+            while (hi - lo > 1) {
+              const uint8_t mid = (lo + hi) >> 1;
+              if (lut.adc[mid] >= adc) lo = mid; else hi = mid;
+            }
+            const int32_t temp16 = int32_t(THERMISTOR_LUT_TEMP_MIN + lo * THERMISTOR_LUT_TEMP_STEP) * 16
+                                 + int32_t(THERMISTOR_LUT_TEMP_STEP * 16) * (lut.adc[lo] - adc) / (lut.adc[lo] - lut.adc[hi]);
+            return temp16 * 0.0625f;
+          }
+        }
+        return getTemperature();
+      }
+
+    #endif
+
     float getTemperature() {
 
       #if HAS_MAX6675 || HAS_MAX31855
@@ -161,10 +161,6 @@ void TempManager::factory_parameters() {
     LOOP_COOLER()   if (coolers[h])   coolers_factory_parameters(h);
   #endif
 
-  #if ENABLED(PID_ADD_EXTRUSION_RATE)
-    heater.lpq_len = 20;  // default last-position-queue size
-  #endif
-
 }
 
 void TempManager::change_number_heater(const HeatertypeEnum type, const uint8_t h) {
@@ -679,6 +675,7 @@ void TempManager::report_temperatures(const bool showRaw/*=false*/) {
     pid->Ki               = HEKi[ALIM(h, HEKi)];
     pid->Kd               = HEKd[ALIM(h, HEKd)];
     pid->Kc               = HEKc[ALIM(h, HEKc)];
+    pid->sample_period    = HOTEND_PID_SAMPLE_MS;
     pid->drive.min        = POWER_DRIVE_MIN;
     pid->drive.max        = POWER_DRIVE_MAX;
     pid->Max              = POWER_MAX;
@@ -735,6 +732,7 @@ void TempManager::report_temperatures(const bool showRaw/*=false*/) {
     pid->Kp               = BEDKp[ALIM(h, BEDKp)];
     pid->Ki               = BEDKi[ALIM(h, BEDKi)];
     pid->Kd               = BEDKd[ALIM(h, BEDKd)];
+    pid->sample_period    = BED_PID_SAMPLE_MS;
     pid->drive.min        = BED_POWER_DRIVE_MIN;
     pid->drive.max        = BED_POWER_DRIVE_MAX;
     pid->Max              = BED_POWER_MAX;
@@ -791,6 +789,7 @@ void TempManager::report_temperatures(const bool showRaw/*=false*/) {
     pid->Kp               = CHAMBERKp[ALIM(h, CHAMBERKp)];
     pid->Ki               = CHAMBERKi[ALIM(h, CHAMBERKi)];
     pid->Kd               = CHAMBERKd[ALIM(h, CHAMBERKd)];
+    pid->sample_period    = CHAMBER_PID_SAMPLE_MS;
     pid->drive.min        = CHAMBER_POWER_DRIVE_MIN;
     pid->drive.max        = CHAMBER_POWER_DRIVE_MAX;
     pid->Max              = CHAMBER_POWER_MAX;
@@ -840,6 +839,7 @@ void TempManager::report_temperatures(const bool showRaw/*=false*/) {
     pid->Kp               = COOLER_Kp;
     pid->Ki               = COOLER_Ki;
     pid->Kd               = COOLER_Kd;
+    pid->sample_period    = COOLER_PID_SAMPLE_MS;
     pid->drive.min        = COOLER_POWER_DRIVE_MIN;
     pid->drive.max        = COOLER_POWER_DRIVE_MAX;
     pid->Max              = COOLER_POWER_MAX;
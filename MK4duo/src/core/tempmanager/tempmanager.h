@@ -31,9 +31,6 @@ struct temp_data_t {
   uint8_t beds      : 4;
   uint8_t chambers  : 4;
   uint8_t coolers   : 4;
-  #if ENABLED(PID_ADD_EXTRUSION_RATE)
-    int16_t lpq_len : 16;
-  #endif
 };
 
 /**
@@ -74,13 +74,22 @@ void Bedlevel::apply_leveling(xyz_pos_t &raw) {
 
   #elif HAS_MESH
 
+    raw.z += get_z_offset(raw);
+
+  #endif
+}
+
+#if HAS_MESH
+
+  float Bedlevel::get_z_offset(const xyz_pos_t &raw) {
+
     #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
       const float fade_scaling_factor = fade_scaling_factor_for_z(raw.z);
     #else
       constexpr float fade_scaling_factor = 1.0;
     #endif
 
-    raw.z += (
+    return (
       #if ENABLED(MESH_BED_LEVELING)
         mbl.get_z(raw
           #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
@@ -93,9 +102,9 @@ void Bedlevel::apply_leveling(xyz_pos_t &raw) {
         fade_scaling_factor ? fade_scaling_factor * abl.bilinear_z_offset(raw) : 0.0
       #endif
     );
+  }
 
-  #endif
-}
+#endif
 
 void Bedlevel::unapply_leveling(xyz_pos_t &raw) {
 
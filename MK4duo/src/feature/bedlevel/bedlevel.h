@@ -127,6 +127,14 @@ class Bedlevel {
      */
     static void apply_leveling(xyz_pos_t &raw);
     static void unapply_leveling(xyz_pos_t &raw);
+
+    #if HAS_MESH
+      /**
+       * The Z the mesh adds at a cartesian position, faded by its Z.
+       * The caches of the mesh lookup are not for the stepper ISR.
+       */
+      static float get_z_offset(const xyz_pos_t &raw);
+    #endif
     FORCE_INLINE static void force_unapply_leveling(xyz_pos_t &raw) {
       flag.leveling_active = true;
       unapply_leveling(raw);
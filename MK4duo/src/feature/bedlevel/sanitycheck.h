@@ -96,3 +96,23 @@ static_assert(1 >= 0
 #if ENABLED(MESH_EDIT_GFX_OVERLAY) && (DISABLED(AUTO_BED_LEVELING_UBL) || DISABLED(DOGLCD))
   #error "DEPENDENCY ERROR: MESH_EDIT_GFX_OVERLAY requires AUTO_BED_LEVELING_UBL and a Graphical LCD."
 #endif
+
+#if ENABLED(ABL_FAST_PROBING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "DEPENDENCY ERROR: ABL_FAST_PROBING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "DEPENDENCY ERROR: ABL_FAST_PROBING is not compatible with PROBE_MANUALLY."
+  #elif DISABLED(Z_PROBE_MESH_CLEARANCE)
+    #error "DEPENDENCY ERROR: Missing setting Z_PROBE_MESH_CLEARANCE."
+  #endif
+#endif
+
+#if ENABLED(MESH_SEGMENT_FREE)
+  #if !HAS_MESH
+    #error "DEPENDENCY ERROR: MESH_SEGMENT_FREE requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+  #elif DISABLED(STEP_SEGMENT_BUFFER)
+    #error "DEPENDENCY ERROR: MESH_SEGMENT_FREE requires STEP_SEGMENT_BUFFER."
+  #elif IS_KINEMATIC || CORE_IS_XZ || CORE_IS_YZ
+    #error "DEPENDENCY ERROR: MESH_SEGMENT_FREE requires a Z motor of its own (Cartesian, COREXY or COREYX)."
+  #endif
+#endif
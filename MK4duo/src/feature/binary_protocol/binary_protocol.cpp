@@ -0,0 +1,224 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * binary_protocol.cpp - Binary framing for G-code streamed from the host
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#include "../../../MK4duo.h"
+#include "sanitycheck.h"
+
+#if ENABLED(BINARY_PROTOCOL)
+
+BinaryProtocol binary_protocol;
+
+/** Public Parameters */
+bool    BinaryProtocol::enabled = false;
+char    BinaryProtocol::line[MAX_CMD_SIZE];
+uint8_t BinaryProtocol::tokens[sizeof(uint32_t) + BINARY_LETTERS * sizeof(float)],
+        BinaryProtocol::tokens_size = 0;
+
+/** Private Parameters */
+BinaryProtocol::frame_t BinaryProtocol::frame[NUM_SERIAL];
+
+// Parameter letters of the mask bits, in letter order as the tokens
+const char binary_letters[BINARY_LETTERS] PROGMEM = { 'E', 'F', 'I', 'J', 'P', 'R', 'S', 'X', 'Y', 'Z' };
+
+/** Public Function */
+void BinaryProtocol::set_enabled(const bool onoff) {
+  enabled = onoff;
+  for (uint8_t i = 0; i < NUM_SERIAL; i++) {
+    frame[i].active = frame[i].resend = false;
+    frame[i].expected = 0;
+  }
+}
+
+BinaryResultEnum BinaryProtocol::process_char(const uint8_t port, const uint8_t c, const bool line_idle) {
+
+  frame_t &f = frame[port];
+
+  if (!f.active) {
+    if (!enabled || !line_idle) return BINARY_NONE;
+    if (c == BINARY_SYNC) {
+      f.active = true;
+      f.count = 0;
+      f.time = millis();
+      return BINARY_BUSY;
+    }
+    // Waiting for the resend, the rest of a broken frame is not an ASCII line
+    return f.resend ? BINARY_BUSY : BINARY_NONE;
+  }
+
+  f.time = millis();
+
+  f.data[f.count++] = c;
+
+  // Header: sequence, type, payload length
+  if (f.count < 3) return BINARY_BUSY;
+  if (f.data[2] > BINARY_PAYLOAD_MAX) {
+    f.active = false;
+    request_resend(port);
+    return BINARY_BUSY;
+  }
+
+  // Wait for payload and CRC
+  if (f.count < 3 + f.data[2] + 2) return BINARY_BUSY;
+
+  f.active = false;
+  return frame_done(port);
+}
+
+void BinaryProtocol::reject_frame(const uint8_t port) {
+  frame[port].expected--;
+  request_resend(port);
+}
+
+void BinaryProtocol::check_timeout() {
+  for (uint8_t i = 0; i < NUM_SERIAL; i++) {
+    frame_t &f = frame[i];
+    if (!f.active) continue;
+    // Data waiting to be read is not a lost byte, the loop may have been busy
+    if (Com::serialDataAvailable(i))
+      f.time = millis();
+    else if (millis_s(millis() - f.time) > BINARY_FRAME_TIMEOUT) {
+      f.active = false;
+      request_resend(i);
+    }
+  }
+}
+
+char* BinaryProtocol::line_text(const char * const cmd, const uint8_t * const tokens) {
+
+  static char text[MAX_CMD_SIZE];
+
+  uint32_t bits;
+  memcpy(&bits, tokens, sizeof(bits));
+  const uint8_t *value = tokens + sizeof(bits);
+
+  char *p = text;
+  for (const char *s = cmd; *s && p < text + MAX_CMD_SIZE - 1; s++) {
+    *p++ = *s;
+    // A parameter letter of the frame without value in the line
+    if (s > cmd && s[-1] == ' ' && WITHIN(*s, 'A', 'Z') && (s[1] == ' ' || s[1] == '\0') && TEST32(bits, LETTER_BIT(*s))) {
+      float v;
+      memcpy(&v, value + sizeof(float) * __builtin_popcountl(bits & (_BV32(LETTER_BIT(*s)) - 1)), sizeof(v));
+
+      // Value with 5 decimals, trailing zeros removed
+      char str[16];
+      dtostrf(v, 1, 5, str);
+      uint8_t n = strlen(str);
+      while (str[n - 1] == '0') n--;
+      if (str[n - 1] == '.') n--;
+
+      if (p + n > text + MAX_CMD_SIZE - 1) { p -= 2; break; }
+      memcpy(p, str, n);
+      p += n;
+    }
+  }
+  *p = '\0';
+
+  return text;
+}
+
+/** Private Function */
+BinaryResultEnum BinaryProtocol::frame_done(const uint8_t port) {
+
+  frame_t &f = frame[port];
+
+  const uint8_t len = f.data[2];
+  uint16_t crc = 0xFFFF;
+  crc16(&crc, f.data, 3 + len);
+
+  if (crc != (f.data[3 + len] | (uint16_t(f.data[4 + len]) << 8)) || f.data[0] != f.expected) {
+    request_resend(port);
+    return BINARY_BUSY;
+  }
+
+  const uint8_t type = f.data[1], * const payload = &f.data[3];
+
+  if (type == BINARY_TYPE_ASCII) {
+    memcpy(line, payload, len);
+    line[len] = '\0';
+    tokens_size = 0;
+  }
+  else if (type > 3 || !decode_motion(type, payload, len)) {
+    request_resend(port);
+    return BINARY_BUSY;
+  }
+
+  f.expected++;
+  f.resend = false;
+  printer.max_inactivity_timer.start();
+  return BINARY_LINE;
+}
+
+/**
+ * Build a "G1 X Y E" line for seen() and the token record
+ * with the values as they are in the payload.
+ */
+bool BinaryProtocol::decode_motion(const uint8_t type, const uint8_t *payload, const uint8_t len) {
+
+  if (len < 2) return false;
+  const uint16_t mask = payload[0] | (uint16_t(payload[1]) << 8);
+  if (mask >= _BV(BINARY_LETTERS)) return false;
+
+  uint8_t count = 0;
+  for (uint8_t b = 0; b < BINARY_LETTERS; b++) if (TEST(mask, b)) count++;
+  if (len != 2 + count * sizeof(float)) return false;
+
+  uint32_t bits = 0;
+  const uint8_t *value = payload + 2;
+  char *p = line;
+  *p++ = 'G';
+  *p++ = '0' + type;
+  for (uint8_t b = 0; b < BINARY_LETTERS; b++) {
+    if (TEST(mask, b)) {
+      const char letter = pgm_read_byte(&binary_letters[b]);
+      float v;
+      memcpy(&v, value, sizeof(v));
+      value += sizeof(v);
+      if (!(ABS(v) < 1e7f)) return false;   // Printable by line_text()
+      *p++ = ' ';
+      *p++ = letter;
+      SBI32(bits, LETTER_BIT(letter));
+    }
+  }
+  *p = '\0';
+
+  memcpy(tokens, &bits, sizeof(bits));
+  memcpy(tokens + sizeof(bits), payload + 2, count * sizeof(float));
+  tokens_size = sizeof(bits) + count * sizeof(float);
+  return true;
+}
+
+void BinaryProtocol::request_resend(const uint8_t port) {
+  frame_t &f = frame[port];
+  if (f.resend) return;
+  f.resend = true;
+  SERIAL_PORT(port);
+  SERIAL_EMV("rs ", int(f.expected));
+  SERIAL_PORT(-1);
+}
+
+#endif // ENABLED(BINARY_PROTOCOL)
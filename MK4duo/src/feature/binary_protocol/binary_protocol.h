@@ -0,0 +1,132 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_protocol.h - Binary framing for G-code streamed from the host
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * Enabled with M880 S1 and reported by M115 as Cap:BINARY_PROTOCOL.
+ * A frame may be sent instead of any ASCII line, ASCII lines keep working.
+ *
+ *  byte 0      0xB5 sync, never the first byte of an ASCII line
+ *  byte 1      Sequence number, one more than the previous frame (0 after M880 S1)
+ *  byte 2      Type: 0-3 G0-G3 record, 0x7F ASCII line
+ *  byte 3      Payload length
+ *  payload     G0-G3: uint16 parameter mask, bit 0-9 = E F I J P R S X Y Z,
+ *                     then one float per set bit in the same order
+ *              ASCII: the command line without end of line
+ *  2 bytes     CRC16 CCITT (crc16() of utility.h) of bytes 1 to the end of payload
+ *
+ * G0-G3 records are queued as a line with the parameter letters only, like
+ * "G1 X Y E", and their values. The values are written in the line only for
+ * echo and M28.
+ *
+ * All numbers are little endian. Every frame is answered with "ok" like an
+ * ASCII line. A bad CRC, an unexpected sequence number or a frame that finds
+ * the command buffer full is answered once with "rs <expected sequence>" and
+ * the frames are dropped until it arrives. Until then the bytes out of a
+ * frame are dropped too, they are the rest of a broken frame and not an
+ * ASCII line. A frame still incomplete after BINARY_FRAME_TIMEOUT ms without
+ * serial data is dropped and asked again.
+ */
+
+#if ENABLED(BINARY_PROTOCOL)
+
+#define BINARY_SYNC         0xB5
+#define BINARY_TYPE_ASCII   0x7F
+#define BINARY_PAYLOAD_MAX  (MAX_CMD_SIZE - 1)
+#define BINARY_LETTERS      10
+#define BINARY_FRAME_TIMEOUT 100
+
+enum BinaryResultEnum : uint8_t { BINARY_NONE, BINARY_BUSY, BINARY_LINE };
+
+class BinaryProtocol {
+
+  public: /** Constructor */
+
+    BinaryProtocol() {}
+
+  public: /** Public Parameters */
+
+    static bool enabled;
+
+    // Last decoded frame, valid after BINARY_LINE until the next call
+    static char     line[MAX_CMD_SIZE];
+    static uint8_t  tokens[sizeof(uint32_t) + BINARY_LETTERS * sizeof(float)],
+                    tokens_size;
+
+  private: /** Private Parameters */
+
+    struct frame_t {
+      bool    active,                                 // Sync received, collecting the frame
+              resend;                                 // Resend requested, waiting for the expected frame
+      millis_s time;                                  // Last time the frame got a byte
+      uint8_t count,                                  // Bytes after sync
+              expected,                               // Expected sequence number
+              data[3 + BINARY_PAYLOAD_MAX + 2];       // seq, type, len, payload, crc
+    };
+
+    static frame_t frame[NUM_SERIAL];
+
+  public: /** Public Function */
+
+    /**
+     * Enable or disable the framing, sequence numbers restart from 0
+     */
+    static void set_enabled(const bool onoff);
+
+    /**
+     * Feed one serial byte. line_idle is true at the start of an ASCII line.
+     * Return BINARY_NONE if the byte is not for the binary protocol,
+     * BINARY_LINE when line and tokens hold a command to enqueue.
+     */
+    static BinaryResultEnum process_char(const uint8_t port, const uint8_t c, const bool line_idle);
+
+    /**
+     * The last BINARY_LINE could not be enqueued, ask for it again
+     */
+    static void reject_frame(const uint8_t port);
+
+    /**
+     * Drop the frames that got no byte for BINARY_FRAME_TIMEOUT, called before reading
+     */
+    static void check_timeout();
+
+    /**
+     * The line with the values of its G0-G3 frame, "G1 X Y" becomes "G1 X10 Y20".
+     * For echo and M28, the parameters that do not fit in MAX_CMD_SIZE are left out.
+     */
+    static char* line_text(const char * const cmd, const uint8_t * const tokens);
+
+  private: /** Private Function */
+
+    static BinaryResultEnum frame_done(const uint8_t port);
+    static bool decode_motion(const uint8_t type, const uint8_t *payload, const uint8_t len);
+    static void request_resend(const uint8_t port);
+
+};
+
+extern BinaryProtocol binary_protocol;
+
+#endif // ENABLED(BINARY_PROTOCOL)
@@ -0,0 +1,249 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * coalescer.cpp
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#include "../../../MK4duo.h"
+#include "sanitycheck.h"
+
+#if ENABLED(MOVE_COALESCING)
+
+#if ENABLED(COALESCE_ARCS)
+  void plan_arc(const xyze_pos_t &cart, const ab_float_t &offset, const uint8_t clockwise);
+#endif
+
+Coalescer coalescer;
+
+/** Private Parameters */
+bool        Coalescer::pending  = false,
+            Coalescer::flushing = false;
+uint8_t     Coalescer::joints   = 0,
+            Coalescer::extruder = 0;
+feedrate_t  Coalescer::feedrate = 0;
+xyze_pos_t  Coalescer::start,
+            Coalescer::joint[COALESCE_MAX_SEGMENTS - 1];
+float       Coalescer::length[COALESCE_MAX_SEGMENTS];
+
+#if ENABLED(COALESCE_ARCS)
+  bool      Coalescer::arc        = false,
+            Coalescer::clockwise  = false;
+  xy_pos_t  Coalescer::center;
+#endif
+
+/** Public Function */
+void Coalescer::prepare_move_to_destination() {
+
+  if (pending && join(mechanics.destination)) {
+    mechanics.position = mechanics.destination;
+    return;
+  }
+
+  flush();
+
+  const float move_mm = SQRT(sq(mechanics.destination.x - mechanics.position.x)
+                           + sq(mechanics.destination.y - mechanics.position.y)
+                           + sq(mechanics.destination.z - mechanics.position.z));
+
+  // Hold the move as the start of a run. E only moves and other modes go straight on.
+  if (printer.mode == PRINTER_MODE_FFF && move_mm > (COALESCE_TOLERANCE)) {
+    pending   = true;
+    joints    = 0;
+    start     = mechanics.position;
+    length[0] = move_mm;
+    feedrate  = mechanics.feedrate_mm_s;
+    extruder  = toolManager.extruder.active;
+    #if ENABLED(COALESCE_ARCS)
+      arc = false;
+    #endif
+    mechanics.position = mechanics.destination;
+  }
+  else
+    mechanics.prepare_move_to_destination();
+
+}
+
+void Coalescer::flush() {
+
+  if (!pending || flushing) return;
+
+  pending = false;
+  flushing = true;
+
+  // Plan from the start of the run to its end, the current position
+  const xyze_pos_t  old_destination = mechanics.destination;
+  const feedrate_t  old_feedrate    = mechanics.feedrate_mm_s;
+
+  mechanics.destination   = mechanics.position;
+  mechanics.position      = start;
+  mechanics.feedrate_mm_s = feedrate;
+
+  #if ENABLED(COALESCE_ARCS)
+    if (arc) {
+      const ab_float_t offset = { center.x - start.x, center.y - start.y };
+      plan_arc(mechanics.destination, offset, clockwise);
+    }
+    else
+  #endif
+      mechanics.prepare_move_to_destination();
+
+  mechanics.destination   = old_destination;
+  mechanics.feedrate_mm_s = old_feedrate;
+
+  flushing = false;
+
+}
+
+void Coalescer::idle() {
+  // Hold the run while the planner has work, the next moves may join it
+  if (pending && planner.moves_planned() < (BLOCK_BUFFER_SIZE) / 4) flush();
+}
+
+/** Private Function */
+bool Coalescer::join(const xyze_pos_t &target) {
+
+  if (joints >= COALESCE_MAX_SEGMENTS - 1
+    || mechanics.feedrate_mm_s != feedrate
+    || toolManager.extruder.active != extruder
+  ) return false;
+
+  const float move_mm = SQRT(sq(target.x - mechanics.position.x)
+                           + sq(target.y - mechanics.position.y)
+                           + sq(target.z - mechanics.position.z));
+  if (move_mm <= (COALESCE_TOLERANCE)) return false;
+
+  // The end of the run becomes a joint
+  joint[joints] = mechanics.position;
+  length[joints + 1] = length[joints] + move_mm;
+  joints++;
+
+  // E must be proportional to the path, as the planner spreads it over the joined move
+  const float e_per_mm  = (target.e - start.e) / length[joints],
+              e_error   = (COALESCE_TOLERANCE) * ABS(e_per_mm);
+  bool fit = true;
+  for (uint8_t i = 0; i < joints && fit; i++)
+    fit = ABS(start.e + e_per_mm * length[i] - joint[i].e) <= e_error;
+
+  if (fit) {
+    if (fit_line(target)) {
+      #if ENABLED(COALESCE_ARCS)
+        arc = false;
+      #endif
+      return true;
+    }
+    #if ENABLED(COALESCE_ARCS)
+      if (fit_arc(target)) return true;
+    #endif
+  }
+
+  joints--;
+  return false;
+
+}
+
+/**
+ * Every joint within COALESCE_TOLERANCE of the line from the start to the target,
+ * and no going back: the path is as long as the line
+ */
+bool Coalescer::fit_line(const xyze_pos_t &target) {
+
+  const xyz_pos_t d = { target.x - start.x, target.y - start.y, target.z - start.z };
+  const float line_sq = sq(d.x) + sq(d.y) + sq(d.z),
+              line_mm = SQRT(line_sq);
+
+  if (length[joints] - line_mm > (COALESCE_TOLERANCE)) return false;
+
+  // |v x d| / |d| is the distance of the joint from the line
+  const float max_cross_sq = sq(COALESCE_TOLERANCE) * line_sq;
+  for (uint8_t i = 0; i < joints; i++) {
+    const xyz_pos_t v = { joint[i].x - start.x, joint[i].y - start.y, joint[i].z - start.z };
+    const float cx = v.y * d.z - v.z * d.y,
+                cy = v.z * d.x - v.x * d.z,
+                cz = v.x * d.y - v.y * d.x;
+    if (sq(cx) + sq(cy) + sq(cz) > max_cross_sq) return false;
+  }
+
+  return true;
+
+}
+
+#if ENABLED(COALESCE_ARCS)
+
+  /**
+   * Short chords in XY on the circle through the start, the middle joint and
+   * the target, all going the same way around: the path is as long as the arc
+   */
+  bool Coalescer::fit_arc(const xyze_pos_t &target) {
+
+    // Two moves always fit a circle, and arc segments must be shorter than the chords
+    if (joints < 2 || length[joints] > (joints + 1) * float(MM_PER_ARC_SEGMENT)) return false;
+
+    #if ENABLED(CNC_WORKSPACE_PLANES)
+      if (mechanics.workspace_plane != mechanics.PLANE_XY) return false;
+    #endif
+
+    if (ABS(target.z - start.z) > (COALESCE_TOLERANCE)) return false;
+    for (uint8_t i = 0; i < joints; i++)
+      if (ABS(joint[i].z - start.z) > (COALESCE_TOLERANCE)) return false;
+
+    // Circumcenter, relative to the start
+    const xy_pos_t  a = { joint[joints >> 1].x - start.x, joint[joints >> 1].y - start.y },
+                    b = { target.x - start.x, target.y - start.y };
+    const float     den = 2.0f * (a.x * b.y - a.y * b.x);
+    if (ABS(den) < 0.000001f) return false;
+
+    const float     a_sq = sq(a.x) + sq(a.y),
+                    b_sq = sq(b.x) + sq(b.y);
+    const xy_pos_t  c = { (b.y * a_sq - a.y * b_sq) / den, (a.x * b_sq - b.x * a_sq) / den };
+    const float     r_sq = sq(c.x) + sq(c.y),
+                    r = SQRT(r_sq),
+                    max_error = 2.0f * r * (COALESCE_TOLERANCE);
+
+    for (uint8_t i = 0; i < joints; i++) {
+      const xy_pos_t p = { joint[i].x - start.x - c.x, joint[i].y - start.y - c.y };
+      if (ABS(sq(p.x) + sq(p.y) - r_sq) > max_error) return false;
+    }
+
+    // Angle from the start to the target around the center, the way the path goes
+    const bool cw = den < 0;
+    const xy_pos_t s = -c, e = b - c;
+    float angle = ATAN2(s.x * e.y - s.y * e.x, s.x * e.x + s.y * e.y);
+    if (cw) angle = -angle;
+    if (angle < 0) angle += RADIANS(360);
+
+    // The chords are a bit shorter than the arc
+    const float arc_mm = r * angle;
+    if (ABS(length[joints] - arc_mm) > (COALESCE_TOLERANCE) + arc_mm * 0.02f) return false;
+
+    arc = true;
+    clockwise = cw;
+    center.set(start.x + c.x, start.y + c.y);
+    return true;
+
+  }
+
+#endif // ENABLED(COALESCE_ARCS)
+
+#endif // ENABLED(MOVE_COALESCING)
@@ -0,0 +1,90 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * coalescer.h
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(MOVE_COALESCING)
+
+class Coalescer {
+
+  public: /** Constructor */
+
+    Coalescer() {}
+
+  private: /** Private Parameters */
+
+    static bool       pending,                        // A run of moves waits to be planned
+                      flushing;
+    static uint8_t    joints,                         // Moves in the run - 1
+                      extruder;
+    static feedrate_t feedrate;
+    static xyze_pos_t start,                          // Where the run starts, it ends at mechanics.position
+                      joint[COALESCE_MAX_SEGMENTS - 1];
+    static float      length[COALESCE_MAX_SEGMENTS];  // Path length from start to each joint and to the end
+
+    #if ENABLED(COALESCE_ARCS)
+      static bool     arc, clockwise;
+      static xy_pos_t center;
+    #endif
+
+  public: /** Public Function */
+
+    /**
+     * G0/G1: join the move to mechanics.destination with the pending run
+     * or plan the run and start a new one
+     */
+    static void prepare_move_to_destination();
+
+    /**
+     * Plan the pending run, before anything that is not a G0/G1
+     */
+    static void flush();
+
+    /**
+     * Called by the main loop with no command to run: plan the run
+     * before the planner runs dry
+     */
+    static void idle();
+
+    /**
+     * Forget the run, the planner was emptied by a quick stop
+     */
+    FORCE_INLINE static void discard() { pending = false; }
+
+  private: /** Private Function */
+
+    static bool join(const xyze_pos_t &target);
+    static bool fit_line(const xyze_pos_t &target);
+    #if ENABLED(COALESCE_ARCS)
+      static bool fit_arc(const xyze_pos_t &target);
+    #endif
+
+};
+
+extern Coalescer coalescer;
+
+#endif // ENABLED(MOVE_COALESCING)
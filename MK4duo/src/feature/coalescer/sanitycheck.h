@@ -0,0 +1,39 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sanitycheck.h
+ *
+ * Test configuration values for errors at compile-time.
+ */
+
+#if ENABLED(MOVE_COALESCING)
+  #if DISABLED(COALESCE_TOLERANCE) || DISABLED(COALESCE_MAX_SEGMENTS)
+    #error "DEPENDENCY ERROR: Missing setting COALESCE_TOLERANCE or COALESCE_MAX_SEGMENTS."
+  #elif COALESCE_MAX_SEGMENTS < 2 || COALESCE_MAX_SEGMENTS > 16
+    #error "DEPENDENCY ERROR: COALESCE_MAX_SEGMENTS must be from 2 to 16."
+  #endif
+  #if ENABLED(COALESCE_ARCS) && DISABLED(ARC_SUPPORT)
+    #error "DEPENDENCY ERROR: COALESCE_ARCS requires ARC_SUPPORT."
+  #endif
+#endif
@@ -0,0 +1,143 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * input_shaping.cpp
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#include "../../../MK4duo.h"
+#include "sanitycheck.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+InputShaping inputshaping;
+
+/** Public Parameters */
+shaper_data_t InputShaping::data[XY];
+shaped_axis_t InputShaping::axis[XY];
+uint32_t      InputShaping::clock = 0;
+
+/** Public Function */
+void InputShaping::factory_parameters() {
+  data[X_AXIS].type       = (ShaperEnum)SHAPING_X_TYPE;
+  data[X_AXIS].frequency  = SHAPING_X_FREQUENCY;
+  data[X_AXIS].zeta       = SHAPING_X_ZETA;
+  data[Y_AXIS].type       = (ShaperEnum)SHAPING_Y_TYPE;
+  data[Y_AXIS].frequency  = SHAPING_Y_FREQUENCY;
+  data[Y_AXIS].zeta       = SHAPING_Y_ZETA;
+}
+
+/**
+ * Impulses of the shapers, with K = e^(-zeta*PI/sqrt(1-zeta^2)) and Td = 1/(F*sqrt(1-zeta^2))
+ *
+ *  ZV:   1, K                            at 0, Td/2
+ *  ZVD:  1, 2K, K^2                      at 0, Td/2, Td
+ *  MZV:  1-1/sqrt2, (sqrt2-1)K', K'^2..  at 0, 3Td/8, 3Td/4  with K' = K^(3/4)
+ *  EI:   (1+V)/4, (1-V)K/2, (1+V)K^2/4   at 0, Td/2, Td      with 5% vibration tolerance V
+ */
+void InputShaping::update() {
+
+  const bool isr_enabled = stepper.suspend();
+
+  LOOP_XY(i) {
+    shaper_data_t &d = data[i];
+    shaped_axis_t &ax = axis[i];
+    float a[SHAPING_MAX_IMPULSES] = { 1.0f }, t[SHAPING_MAX_IMPULSES] = { 0.0f };
+    uint8_t n = 1;
+
+    if (d.frequency > 0.0f && WITHIN(d.zeta, 0.0f, 0.9f)) {
+      const float df = SQRT(1.0f - sq(d.zeta)),
+                  K  = EXP(-d.zeta * M_PI / df),
+                  td = 1.0f / (d.frequency * df);
+      switch (d.type) {
+        case SHAPER_ZV:
+          n = 2;
+          a[1] = K;                             t[1] = 0.5f * td;
+          break;
+        case SHAPER_ZVD:
+          n = 3;
+          a[1] = 2.0f * K;                      t[1] = 0.5f * td;
+          a[2] = sq(K);                         t[2] = td;
+          break;
+        case SHAPER_MZV: {
+          const float K3 = EXP(-0.75f * d.zeta * M_PI / df);
+          n = 3;
+          a[0] = 1.0f - M_SQRT1_2;
+          a[1] = (M_SQRT2 - 1.0f) * K3;         t[1] = 0.375f * td;
+          a[2] = a[0] * sq(K3);                 t[2] = 0.75f * td;
+        } break;
+        case SHAPER_EI: {
+          constexpr float v_tol = 0.05f;
+          n = 3;
+          a[0] = 0.25f * (1.0f + v_tol);
+          a[1] = 0.5f * (1.0f - v_tol) * K;     t[1] = 0.5f * td;
+          a[2] = a[0] * sq(K);                  t[2] = td;
+        } break;
+        default: break;
+      }
+    }
+
+    if (n == 1) d.type = SHAPER_NONE;
+
+    float sum = 0.0f;
+    for (uint8_t k = 0; k < n; k++) sum += a[k];
+
+    // The rounding goes in the first impulse so the amplitudes sum to one step
+    int16_t rest = SHAPING_UNIT;
+    for (uint8_t k = n - 1; k > 0; k--) {
+      ax.amplitude[k] = LROUND(a[k] * float(SHAPING_UNIT) / sum);
+      ax.delay[k]     = uint32_t(t[k] * float(STEPPER_TIMER_RATE));
+      rest -= ax.amplitude[k];
+    }
+    ax.amplitude[0] = rest;
+    ax.delay[0]     = 0;
+
+    ax.impulses   = n;
+    ax.error      = 0;
+    ax.direction  = 0;
+    ax.pending    = 0;
+    ax.head       = 0;
+    for (uint8_t k = 0; k < SHAPING_MAX_IMPULSES; k++) ax.cursor[k] = 0;
+  }
+
+  if (isr_enabled) stepper.wake_up();
+
+}
+
+bool InputShaping::busy() {
+  return axis[X_AXIS].busy() || axis[Y_AXIS].busy();
+}
+
+void InputShaping::print_M593() {
+  SERIAL_LM(CFG, "Input Shaping S<Type 0-None 1-ZV 2-ZVD 3-MZV 4-EI> F<Frequency> D<Damping>");
+  LOOP_XY(i) {
+    SERIAL_SM(CFG, "  M593 ");
+    SERIAL_CHR(axis_codes[i]);
+    SERIAL_MV(" S", (int)data[i].type);
+    SERIAL_MV(" F", data[i].frequency);
+    SERIAL_EMV(" D", data[i].zeta, 3);
+  }
+}
+
+#endif // ENABLED(INPUT_SHAPING)
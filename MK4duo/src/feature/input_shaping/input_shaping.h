@@ -0,0 +1,191 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * input_shaping.h
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(INPUT_SHAPING)
+
+#define SHAPING_MAX_IMPULSES  3
+#define SHAPING_UNIT          1024  // Amplitude of a whole step
+#define SHAPING_HALF          (SHAPING_UNIT / 2)
+#define SHAPING_NEVER         0xFFFFFFFF
+
+enum ShaperEnum : uint8_t { SHAPER_NONE, SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, SHAPER_EI, SHAPER_COUNT };
+
+// Struct Shaper data
+struct shaper_data_t {
+  ShaperEnum  type;
+  float       frequency,  // Hz
+              zeta;       // Damping ratio
+};
+
+/**
+ * A shaped motor
+ *
+ * Every raw step of the Bresenham is queued with its time and direction.
+ * Each impulse k adds amplitude[k] to the error when the step is delay[k] old,
+ * the motor makes a real step when the error is half a step or more.
+ * The amplitudes sum to SHAPING_UNIT, so every raw step ends in one real step.
+ */
+struct shaped_axis_t {
+
+  uint8_t   impulses;                         // 1 = Not shaped
+  int16_t   amplitude[SHAPING_MAX_IMPULSES];  // Fraction of SHAPING_UNIT
+  uint32_t  delay[SHAPING_MAX_IMPULSES];      // Stepper timer ticks
+  int16_t   error;                            // Shaped position - motor position in SHAPING_UNIT
+  int8_t    direction;                        // Current motor direction, 0 = unknown
+  int32_t   pending;                          // Raw steps not yet done by the motor
+
+  uint32_t  queue[SHAPING_BUFFER_SIZE];       // Raw step time with direction in bit 0
+  uint16_t  head,
+            cursor[SHAPING_MAX_IMPULSES];     // Next raw step for each impulse, the last one is the tail
+
+  FORCE_INLINE bool enabled() const { return impulses > 1; }
+  FORCE_INLINE bool busy()    const { return head != cursor[impulses - 1]; }
+
+  FORCE_INLINE int8_t add(const int16_t a, const int8_t dir) {
+    error += dir > 0 ? a : -a;
+    if (error >= SHAPING_HALF) {
+      error -= SHAPING_UNIT;
+      pending--;
+      return 1;
+    }
+    if (error < -SHAPING_HALF) {
+      error += SHAPING_UNIT;
+      pending++;
+      return -1;
+    }
+    return 0;
+  }
+
+  /**
+   * A raw step of the Bresenham: queue it and apply the first impulse.
+   * With the queue full the whole step is applied now.
+   * Return the motor step to do: 1, -1 or 0
+   */
+  FORCE_INLINE int8_t push(const int8_t dir, const uint32_t now) {
+    int16_t a = SHAPING_UNIT;
+    if (uint16_t(head - cursor[impulses - 1]) < SHAPING_BUFFER_SIZE) {
+      queue[head & (SHAPING_BUFFER_SIZE - 1)] = (now & ~1UL) | (dir > 0 ? 1 : 0);
+      head++;
+      a = amplitude[0];
+    }
+    pending += dir;
+    return add(a, dir);
+  }
+
+  /**
+   * Apply the delayed impulses due at time now, oldest first,
+   * until one of them makes a motor step.
+   * Return the motor step to do: 1, -1 or 0
+   */
+  FORCE_INLINE int8_t echo(const uint32_t now) {
+    for (;;) {
+      uint8_t best = 0;
+      int32_t best_late = -1;
+      for (uint8_t k = 1; k < impulses; k++) {
+        if (cursor[k] == head) continue;
+        const int32_t late = int32_t(now - (queue[cursor[k] & (SHAPING_BUFFER_SIZE - 1)] & ~1UL) - delay[k]);
+        if (late > best_late) { best_late = late; best = k; }
+      }
+      if (!best) return 0;
+      const uint32_t entry = queue[cursor[best]++ & (SHAPING_BUFFER_SIZE - 1)];
+      const int8_t s = add(amplitude[best], (entry & 1) ? 1 : -1);
+      if (s) return s;
+    }
+  }
+
+  /**
+   * Ticks until the next delayed impulse, SHAPING_NEVER if none
+   */
+  FORCE_INLINE uint32_t next_echo(const uint32_t now) const {
+    uint32_t next = SHAPING_NEVER;
+    for (uint8_t k = 1; k < impulses; k++) {
+      if (cursor[k] == head) continue;
+      const int32_t wait = int32_t((queue[cursor[k] & (SHAPING_BUFFER_SIZE - 1)] & ~1UL) + delay[k] - now);
+      if (wait <= 0) return 0;
+      NOMORE(next, uint32_t(wait));
+    }
+    return next;
+  }
+
+  /**
+   * Drop the delayed impulses, return the raw steps the motor didn't do
+   */
+  FORCE_INLINE int32_t flush() {
+    const int32_t lost = pending;
+    for (uint8_t k = 1; k < impulses; k++) cursor[k] = head;
+    error = 0;
+    pending = 0;
+    return lost;
+  }
+
+};
+
+class InputShaping {
+
+  public: /** Constructor */
+
+    InputShaping() {}
+
+  public: /** Public Parameters */
+
+    static shaper_data_t  data[XY];
+    static shaped_axis_t  axis[XY];
+    static uint32_t       clock;    // Stepper timer ticks, updated by the Stepper ISR only
+
+  public: /** Public Function */
+
+    /**
+     * Initialize Factory parameters
+     */
+    static void factory_parameters();
+
+    /**
+     * Compute amplitudes and delays from data, only with the motors stopped
+     */
+    static void update();
+
+    /**
+     * Print the M593 settings
+     */
+    static void print_M593();
+
+    /**
+     * Delayed impulses still to do
+     */
+    static bool busy();
+
+    FORCE_INLINE static uint32_t next_echo() {
+      return MIN(axis[X_AXIS].next_echo(clock), axis[Y_AXIS].next_echo(clock));
+    }
+
+};
+
+extern InputShaping inputshaping;
+
+#endif // ENABLED(INPUT_SHAPING)
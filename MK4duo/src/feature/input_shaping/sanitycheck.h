@@ -0,0 +1,46 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sanitycheck.h
+ *
+ * Test configuration values for errors at compile-time.
+ */
+
+#if ENABLED(INPUT_SHAPING)
+  #if ENABLED(__AVR__)
+    #error "DEPENDENCY ERROR: INPUT_SHAPING needs a 32 bit board."
+  #elif !(MECH(CARTESIAN) || CORE_IS_XY)
+    #error "DEPENDENCY ERROR: INPUT_SHAPING is only for Cartesian and CoreXY."
+  #elif DISABLED(SHAPING_X_TYPE) || DISABLED(SHAPING_X_FREQUENCY) || DISABLED(SHAPING_X_ZETA)
+    #error "DEPENDENCY ERROR: Missing setting SHAPING_X_TYPE, SHAPING_X_FREQUENCY or SHAPING_X_ZETA."
+  #elif DISABLED(SHAPING_Y_TYPE) || DISABLED(SHAPING_Y_FREQUENCY) || DISABLED(SHAPING_Y_ZETA)
+    #error "DEPENDENCY ERROR: Missing setting SHAPING_Y_TYPE, SHAPING_Y_FREQUENCY or SHAPING_Y_ZETA."
+  #elif DISABLED(SHAPING_BUFFER_SIZE)
+    #error "DEPENDENCY ERROR: Missing setting SHAPING_BUFFER_SIZE."
+  #elif SHAPING_BUFFER_SIZE < 64 || SHAPING_BUFFER_SIZE > 16384 || (SHAPING_BUFFER_SIZE & (SHAPING_BUFFER_SIZE - 1))
+    #error "DEPENDENCY ERROR: SHAPING_BUFFER_SIZE must be a power of 2 from 64 to 16384."
+  #elif SHAPING_X_TYPE < 0 || SHAPING_X_TYPE > 4 || SHAPING_Y_TYPE < 0 || SHAPING_Y_TYPE > 4
+    #error "DEPENDENCY ERROR: SHAPING_X_TYPE and SHAPING_Y_TYPE must be from 0 to 4."
+  #endif
+#endif
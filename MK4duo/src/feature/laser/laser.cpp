@@ -66,9 +66,16 @@ uint16_t  Laser::time         = 0,
 
 #if ENABLED(LASER_RASTER)
 
-  unsigned char Laser::raster_data[LASER_MAX_RASTER_LINE] = { 0 },
+  unsigned char Laser::raster_pool[LASER_RASTER_POOL_SIZE][LASER_MAX_RASTER_LINE] = { { 0 } },
                 Laser::rasterlaserpower                   = 0;
 
+  volatile uint8_t Laser::raster_refs[LASER_RASTER_POOL_SIZE] = { 0 };
+
+  // The empty line 0 is the current line until the first decode
+  uint8_t       Laser::raster_line          = 0,
+                Laser::raster_head          = 1,
+                Laser::raster_tail          = 0;
+
   float         Laser::raster_aspect_ratio  = 0.0,
                 Laser::raster_mm_per_pulse  = 0.0;
 
@@ -182,6 +189,77 @@ void Laser::set_mode(uint8_t pmode) {
   mode = pmode;
 }
 
+#if ENABLED(LASER_RASTER)
+
+  /**
+   * Decode a base64 raster line straight into a free pool line and
+   * scale it by the raster power, so the blocks only keep its index.
+   * Waits for the stepper to finish with the oldest line when the pool is full.
+   * The current line stays in the pool until this decode replaces it, so a
+   * G7 without D can always burn it again.
+   */
+  int Laser::raster_decode(char *input, const int length) {
+
+    constexpr uint8_t mask = LASER_RASTER_POOL_SIZE - 1;
+
+    for (;;) {
+      while (raster_head != raster_tail && !raster_refs[raster_tail & mask]) raster_tail++;
+      if (uint8_t(raster_head - raster_tail) < LASER_RASTER_POOL_SIZE) break;
+      printer.idle();
+    }
+
+    raster_line = raster_head++ & mask;
+    unsigned char * const line = raster_pool[raster_line];
+
+    const int num_pixels = MIN(base64_decode(line, input, length), LASER_MAX_RASTER_LINE);
+
+    // Scale the image intensity based on the raster power.
+    // 100% power on a pixel basis is 255, convert back to 255 = 100.
+    #if ENABLED(LASER_REMAP_INTENSITY)
+      const int NewRange = (rasterlaserpower * 255.0 / 100.0 - LASER_REMAP_INTENSITY);
+    #else
+      const int NewRange = (rasterlaserpower * 255.0 / 100.0);
+    #endif
+
+    for (int i = 0; i < num_pixels; i++) {
+      #if ENABLED(LASER_REMAP_INTENSITY)
+        float NewValue = (float)(((((float)line[i] - 0) * NewRange) / 255.0) + LASER_REMAP_INTENSITY);
+        // If less than 7%, turn off the laser tube.
+        if (NewValue <= LASER_REMAP_INTENSITY) NewValue = 0;
+      #else
+        const float NewValue = (float)(((((float)line[i] - 0) * NewRange) / 255.0));
+      #endif
+      line[i] = NewValue;
+    }
+
+    // Pulses past the decoded pixels keep the laser off
+    for (int i = num_pixels; i < LASER_MAX_RASTER_LINE; i++) line[i] = 0;
+
+    return num_pixels;
+  }
+
+  /**
+   * Reference the current pool line from a new block
+   */
+  uint8_t Laser::raster_hold() {
+    const bool isr_enabled = STEPPER_ISR_ENABLED();
+    if (isr_enabled) DISABLE_STEPPER_INTERRUPT();
+    raster_refs[raster_line]++;
+    if (isr_enabled) ENABLE_STEPPER_INTERRUPT();
+    return raster_line;
+  }
+
+  /**
+   * Drop every reference, the planner queue was flushed.
+   * The current line is kept for a G7 without D.
+   */
+  void Laser::raster_reset() {
+    LOOP_L_N(i, LASER_RASTER_POOL_SIZE) raster_refs[i] = 0;
+    raster_tail = raster_head - 1;
+  }
+
+#endif // LASER_RASTER
+
 #if ENABLED(LASER_PERIPHERALS)
 
   bool Laser::peripherals_ok() { return !HAL::digitalRead(LASER_PERIPHERALS_STATUS_PIN); }
@@ -64,9 +64,13 @@ class Laser {
 
     #if ENABLED(LASER_RASTER)
 
-      static unsigned char  raster_data[LASER_MAX_RASTER_LINE],
+      static unsigned char  raster_pool[LASER_RASTER_POOL_SIZE][LASER_MAX_RASTER_LINE],
                             rasterlaserpower;
 
+      static volatile uint8_t raster_refs[LASER_RASTER_POOL_SIZE];  // Queued blocks burning each pool line
+
+      static uint8_t        raster_line;  // Pool line used by the next raster blocks
+
       static float          raster_aspect_ratio,
                             raster_mm_per_pulse;
 
@@ -94,6 +98,28 @@ class Laser {
       static void wait_for_peripherals();
     #endif // LASER_PERIPHERALS
 
+    #if ENABLED(LASER_RASTER)
+
+      static int raster_decode(char *input, const int length);
+      static uint8_t raster_hold();
+      static void raster_reset();
+
+      /**
+       * Called by the stepper when it discards a block
+       */
+      FORCE_INLINE static void raster_release(const block_t * const block) {
+        if (block->laser_mode == RASTER && raster_refs[block->raster_line])
+          raster_refs[block->raster_line]--;
+      }
+
+    #endif
+
+  private: /** Private Parameters */
+
+    #if ENABLED(LASER_RASTER)
+      static uint8_t raster_head, raster_tail;  // Free-running pool ring counters, the current line is head - 1
+    #endif
+
 };
 
 extern Laser laser;
@@ -49,4 +49,11 @@
       #endif
     #endif
   #endif
+  #if ENABLED(LASER_RASTER)
+    #if DISABLED(LASER_RASTER_POOL_SIZE)
+      #error "DEPENDENCY ERROR: Missing setting LASER_RASTER_POOL_SIZE."
+    #elif LASER_RASTER_POOL_SIZE < 2 || LASER_RASTER_POOL_SIZE > 128 || (LASER_RASTER_POOL_SIZE & (LASER_RASTER_POOL_SIZE - 1))
+      #error "DEPENDENCY ERROR: LASER_RASTER_POOL_SIZE must be a power of 2 from 2 to 128."
+    #endif
+  #endif
 #endif
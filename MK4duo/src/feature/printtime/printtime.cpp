@@ -0,0 +1,462 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * printtime.cpp
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#include "../../../MK4duo.h"
+#include "sanitycheck.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+
+PrintTime printtime;
+
+/** Private Parameters */
+SdFile    PrintTime::file;
+
+bool      PrintTime::in_command         = false,
+          PrintTime::rising             = false;
+
+uint32_t  PrintTime::total_ms           = 0,
+          PrintTime::consumed           = 0,
+          PrintTime::layer_start_ms     = 0,
+          PrintTime::layer_sdpos        = 0,
+          PrintTime::rise_serial        = 0,
+          PrintTime::rise_sdpos         = 0,
+          PrintTime::rise_ms            = 0;
+uint16_t  PrintTime::total_us           = 0,
+          PrintTime::layers             = 0;
+
+float     PrintTime::layer_z            = 0.0f;
+
+PrintTime::mark_t PrintTime::mark[PRINT_TIME_MARKS];
+uint8_t   PrintTime::mark_head          = 0,
+          PrintTime::mark_tail          = 0;
+
+uint8_t   PrintTime::points             = 0;
+uint32_t  PrintTime::point_sdpos[PRINT_TIME_POINTS + 2],
+          PrintTime::point_ms[PRINT_TIME_POINTS + 2];
+
+#define MARK_MOD(n) ((n)&(PRINT_TIME_MARKS-1))
+
+/**
+ * The time the Stepper ISR takes for a block: accelerate from the initial
+ * rate up to accelerate_until, cruise, decelerate to the final rate
+ * from decelerate_after. The rates are reached at the step the trapezoid
+ * generator ends the phase, so a block that can't reach the nominal rate
+ * accelerates for less time than its rates suggest. The ISR stops at
+ * step_event_count whatever the phases say.
+ */
+static uint32_t block_time_us(const block_t * const block) {
+
+  const uint32_t steps = block->step_event_count;
+
+  if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) || !steps) return 0;
+
+  const float accel = planner.plan_of(block)->acceleration_steps_per_s2,
+              nominal_rate = block->nominal_rate;
+
+  if (!accel) return 1000000.0f * steps / nominal_rate;
+
+  const uint32_t  accel_until = MIN(block->accelerate_until, steps),
+                  decel_after = constrain(block->decelerate_after, accel_until, steps);
+
+  #if ENABLED(BEZIER_JERK_CONTROL)
+    // The speed curves are timed by the planner
+    float time_s = float(block->acceleration_time) / (STEPPER_TIMER_RATE) + (decel_after - accel_until) / float(block->cruise_rate);
+    if (decel_after < steps) time_s += float(block->deceleration_time) / (STEPPER_TIMER_RATE);
+  #else
+    const float initial_rate  = block->initial_rate,
+                final_rate    = block->final_rate,
+                cruise_rate   = MIN(nominal_rate, SQRT(sq(initial_rate) + 2.0f * accel * accel_until)),
+                decel_rate    = MIN(cruise_rate, SQRT(sq(final_rate) + 2.0f * accel * (steps - decel_after)));
+
+    float time_s = (cruise_rate - initial_rate) / accel + (decel_after - accel_until) / cruise_rate;
+    if (decel_after < steps && decel_rate > final_rate) time_s += (decel_rate - final_rate) / accel;
+  #endif
+
+  return time_s * 1000000.0f;
+}
+
+/**
+ * What the dry run executes: the moves and what changes them or their limits.
+ * No heating, no fans, no waits for the user.
+ */
+static bool dry_run_command() {
+  switch (parser.command_letter) {
+    case 'G': switch (parser.codenum) {
+      case 0: case 1:
+      #if ENABLED(ARC_SUPPORT)
+        case 2: case 3:
+      #endif
+      #if ENABLED(FWRETRACT)
+        case 10: case 11:
+      #endif
+      #if ENABLED(INCH_MODE_SUPPORT)
+        case 20: case 21:
+      #endif
+      case 28: case 90: case 91: case 92:
+        return true;
+    } break;
+    case 'M': switch (parser.codenum) {
+      case 82: case 83: case 201: case 203: case 204: case 205: case 220:
+        return true;
+    } break;
+  }
+  return false;
+}
+
+/** Public Function */
+void PrintTime::estimate(const char * const path) {
+
+  // A file selected by M23 and not started yet is not a paused print
+  if (IS_SD_PRINTING() || (card.isPaused() && card.getIndex())) {
+    SERIAL_LM(ER, "Print time estimate not available while printing");
+    return;
+  }
+
+  char name[sizeof(card.fileName) + sizeof(PRINT_TIME_EXTENSION)];
+  if (!path || !*path || !sidecar_name(name, path)) {
+    SERIAL_LM(ER, "Print time estimate needs a file name");
+    return;
+  }
+
+  // The file selected by M23, if any, is selected again at the end
+  char selected[sizeof(card.fileName)] = { '\0' };
+  if (card.isFileOpen()) strcpy(selected, card.fileName);
+  auto reselect = [&selected]() {
+    card.endFilePrint();
+    if (selected[0] && card.selectFile(selected, true)) load(selected);
+  };
+
+  // The stepper must be idle, from now on only the estimate takes the blocks
+  planner.synchronize();
+
+  if (!card.selectFile(path)) {
+    reselect();
+    return;
+  }
+
+  if (!file.open(&card.workDir, name, O_RDWR | O_CREAT | O_TRUNC)) {
+    SERIAL_LMT(ER, "Print time estimate can't write ", name);
+    reselect();
+    return;
+  }
+
+  char header[32];
+  sprintf_P(header, PSTR("TIME:%10lu LAYERS:%5u\n"), 0UL, 0U);
+  file.write(header, strlen(header));
+
+  // The file may change settings and positions, they are put back at the end
+  char * const saved_cmd              = parser.command_ptr;
+  const xyze_pos_t saved_position     = mechanics.position;
+  const feedrate_t saved_feedrate     = mechanics.feedrate_mm_s;
+  const int16_t saved_percentage      = mechanics.feedrate_percentage;
+  const uint8_t saved_relative_modes  = mechanics.axis_relative_modes;
+  const mechanics_data_t saved_data   = mechanics.data;
+  extruder_data_t saved_extruder[MAX_EXTRUDER];
+  LOOP_EXTRUDER() saved_extruder[e] = extruders[e]->data;
+  #if ENABLED(WORKSPACE_OFFSETS)
+    const xyz_pos_t saved_position_shift    = mechanics.position_shift,
+                    saved_workspace_offset  = mechanics.workspace_offset;
+  #endif
+  const bool saved_simulation         = printer.debug_flag.simulation;
+
+  // Simulation skips heating, fans and homing, the planner still gets the moves
+  printer.debug_flag.simulation = true;
+  planner.flag.timing_only = true;
+
+  total_ms = total_us = consumed = layers = 0;
+  layer_start_ms = layer_sdpos = rise_ms = 0;
+  mark_head = mark_tail = 0;
+  layer_z = -INFINITY;
+  rising = false;
+  points = 0;
+
+  const uint32_t point_step = card.fileSize / (PRINT_TIME_POINTS) + 1;
+  uint32_t  next_point  = 0,
+            sdpos       = 0,
+            line_sdpos  = 0;
+  millis_l  next_idle_ms = millis() + 200UL;
+  char      line[MAX_CMD_SIZE], chunk[64];
+  uint8_t   len = 0;
+  bool      comment = false;
+
+  for (;;) {
+    const int16_t count = card.read(chunk, sizeof(chunk));
+    if (count <= 0) break;
+    for (int16_t i = 0; i < count; i++, sdpos++) {
+      const char c = chunk[i];
+      if (c == '\n' || c == '\r') {
+        if (len) {
+          line[len] = '\0';
+          in_command = true;
+          if (line_sdpos >= next_point) {
+            #if ENABLED(MOVE_COALESCING)
+              coalescer.flush();
+            #endif
+            add_mark(line_sdpos, false, queued());
+            next_point = line_sdpos + point_step;
+          }
+          run_line(line, line_sdpos);
+          in_command = false;
+          printer.max_inactivity_timer.start();
+          if (ELAPSED(millis(), next_idle_ms)) {
+            next_idle_ms = millis() + 200UL;
+            printer.idle();
+          }
+        }
+        len = 0;
+        comment = false;
+        line_sdpos = sdpos + 1;
+      }
+      else if (c == ';')
+        comment = true;
+      else if (!comment && len < sizeof(line) - 1 && (len || c != ' '))
+        line[len++] = c;
+    }
+  }
+
+  if (len) {
+    line[len] = '\0';
+    in_command = true;
+    run_line(line, line_sdpos);
+    in_command = false;
+  }
+
+  // Time the blocks still in the planner
+  in_command = true;
+  planner.synchronize();
+  in_command = false;
+
+  if (layers) write_layer(total_ms);
+  const mark_t end_mark = { consumed, card.fileSize, false };
+  write_mark(end_mark, total_ms);
+
+  file.seekSet(0);
+  sprintf_P(header, PSTR("TIME:%10lu LAYERS:%5u\n"), (unsigned long)total_ms, layers);
+  file.write(header, strlen(header));
+  file.close();
+
+  planner.flag.timing_only = false;
+  printer.debug_flag.simulation = saved_simulation;
+
+  mechanics.data = saved_data;
+  LOOP_EXTRUDER() extruders[e]->data = saved_extruder[e];
+  planner.reset_acceleration_rates();
+  mechanics.feedrate_mm_s = saved_feedrate;
+  mechanics.feedrate_percentage = saved_percentage;
+  mechanics.axis_relative_modes = saved_relative_modes;
+  #if ENABLED(WORKSPACE_OFFSETS)
+    mechanics.position_shift = saved_position_shift;
+    mechanics.workspace_offset = saved_workspace_offset;
+  #endif
+  mechanics.destination = mechanics.position = saved_position;
+  mechanics.sync_plan_position();
+
+  reselect();
+  parser.parse(saved_cmd);
+
+  char buffer[21];
+  duration_t(total_ms / 1000UL).toString(buffer);
+  SERIAL_SMT(ECHO, "Print time estimate: ", buffer);
+  SERIAL_EMV(" Layers: ", layers);
+}
+
+void PrintTime::idle() {
+  if (planner.flag.timing_only && in_command) consume_block();
+}
+
+void PrintTime::load(const char * const path) {
+
+  points = 0;
+
+  char name[sizeof(card.fileName) + sizeof(PRINT_TIME_EXTENSION)];
+  if (!path || !sidecar_name(name, path) || !file.open(&card.workDir, name, O_READ)) return;
+
+  char line[48];
+  while (file.fgets(line, sizeof(line)) > 0 && points < COUNT(point_ms)) {
+    if (strncmp_P(line, PSTR("PROGRESS:"), 9) == 0) {
+      char *ms;
+      point_sdpos[points] = strtoul(&line[9], &ms, 10);
+      point_ms[points++] = strtoul(ms, nullptr, 10);
+    }
+  }
+  file.close();
+
+  if (points < 2 || !point_ms[points - 1]) points = 0;
+}
+
+uint8_t PrintTime::percentDone() {
+  if (!points) return card.percentDone();
+  return card.isFileOpen() ? elapsed_ms(card.sdpos) * 100.0f / point_ms[points - 1] : 0;
+}
+
+void PrintTime::print_status() {
+  if (!points) return;
+  char buffer[21];
+  duration_t((point_ms[points - 1] - elapsed_ms(card.sdpos)) / 1000UL).toString(buffer);
+  SERIAL_EMT("Estimated time left: ", buffer);
+}
+
+/** Private Function */
+
+/**
+ * path with its extension, if any, changed to PRINT_TIME_EXTENSION.
+ * name has room for the longest card.fileName, false if path is longer.
+ */
+bool PrintTime::sidecar_name(char * const name, const char * const path) {
+  if (strlen(path) >= sizeof(card.fileName)) return false;
+  strcpy(name, path);
+  char * const dot = strrchr(name, '.');
+  if (dot && !strchr(dot, '/')) *dot = '\0';
+  strcat(name, PRINT_TIME_EXTENSION);
+  return true;
+}
+
+/**
+ * Run a line of the file and look for the start of a layer.
+ * A dwell is not run, it is added to the time after the moves.
+ */
+void PrintTime::run_line(char * const line, const uint32_t sdpos) {
+
+  parser.parse(line);
+
+  if (parser.command_letter == 'G' && parser.codenum == 4) {
+    millis_l dwell_ms = 0;
+    if (parser.seenval('P')) dwell_ms = parser.value_millis();
+    if (parser.seenval('S')) dwell_ms = parser.value_millis_from_seconds();
+    planner.synchronize();
+    total_ms += dwell_ms;
+    return;
+  }
+
+  if (!dry_run_command()) return;
+
+  const bool move = parser.command_letter == 'G' && parser.codenum <= 3;
+
+  // The pending joined moves are queued before a Z change
+  #if ENABLED(MOVE_COALESCING)
+    if (move && parser.seen('Z')) coalescer.flush();
+  #endif
+
+  const uint32_t serial = queued();
+  const float z_before = mechanics.position.z,
+              e_before = mechanics.position.e;
+
+  commands.process_now(line);
+
+  // Homing in simulation only sets the position
+  if (parser.command_letter == 'G' && parser.codenum == 28) mechanics.sync_plan_position();
+
+  if (!move) return;
+
+  // A layer starts with the move up to a new highest Z where the nozzle extrudes.
+  // Z-hops go back down before any extrusion and don't count.
+  if (mechanics.position.z > layer_z + 0.01f) {
+    const bool extrudes = mechanics.position.e > e_before;
+    if (!rising && (extrudes || mechanics.position.z > z_before)) {
+      rising = true;
+      rise_serial = serial;
+      rise_sdpos = sdpos;
+      rise_ms = total_ms;
+    }
+    if (rising && extrudes) {
+      layer_z = mechanics.position.z;
+      rising = false;
+      add_mark(rise_sdpos, true, rise_serial);
+    }
+  }
+  else
+    rising = false;
+}
+
+/**
+ * Time the oldest block like the Stepper ISR would run it and drop it
+ */
+bool PrintTime::consume_block() {
+  block_t * const block = planner.get_current_block();
+  if (!block) return false;
+
+  const uint32_t time_us = block_time_us(block) + total_us;
+  total_ms += time_us / 1000UL;
+  total_us = time_us % 1000UL;
+
+  planner.discard_current_block();
+  consumed++;
+  if (rising && consumed == rise_serial) rise_ms = total_ms;
+
+  while (mark_tail != mark_head && mark[mark_tail].serial <= consumed) {
+    write_mark(mark[mark_tail], total_ms);
+    mark_tail = MARK_MOD(mark_tail + 1);
+  }
+  return true;
+}
+
+void PrintTime::add_mark(const uint32_t sdpos, const bool layer, const uint32_t serial) {
+  mark_t m = { serial, sdpos, layer };
+  // A layer found when its rise is already timed starts at the rise
+  if (serial <= consumed) {
+    write_mark(m, layer ? rise_ms : total_ms);
+    return;
+  }
+  // All the marks wait for blocks, time some now to make room
+  while (MARK_MOD(mark_head + 1) == mark_tail && planner.has_blocks_queued()) consume_block();
+  mark[mark_head] = m;
+  mark_head = MARK_MOD(mark_head + 1);
+}
+
+void PrintTime::write_mark(const mark_t &m, const uint32_t ms) {
+  if (m.layer) {
+    if (layers) write_layer(ms);
+    layers++;
+    layer_start_ms = ms;
+    layer_sdpos = m.sdpos;
+  }
+  else {
+    char line[32];
+    sprintf_P(line, PSTR("PROGRESS:%lu %lu\n"), (unsigned long)m.sdpos, (unsigned long)ms);
+    file.write(line, strlen(line));
+  }
+}
+
+void PrintTime::write_layer(const uint32_t ms) {
+  char line[64];
+  sprintf_P(line, PSTR("LAYER:%u START:%lu TIME:%lu POS:%lu\n"), layers, (unsigned long)layer_start_ms, (unsigned long)(ms - layer_start_ms), (unsigned long)layer_sdpos);
+  file.write(line, strlen(line));
+}
+
+/**
+ * Estimated time to reach a file position, between the progress points
+ */
+uint32_t PrintTime::elapsed_ms(const uint32_t sdpos) {
+  uint8_t i = 1;
+  while (i < points - 1 && sdpos >= point_sdpos[i]) i++;
+  if (sdpos >= point_sdpos[i]) return point_ms[i];
+  const uint32_t span = point_sdpos[i] - point_sdpos[i - 1];
+  return point_ms[i - 1] + float(sdpos - point_sdpos[i - 1]) * (point_ms[i] - point_ms[i - 1]) / span;
+}
+
+#endif // ENABLED(PRINT_TIME_ESTIMATE)
@@ -0,0 +1,120 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * printtime.h
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+
+#define PRINT_TIME_POINTS     20  // Progress points in the estimate, one every 5% of the file
+#define PRINT_TIME_MARKS       8  // Layer and progress marks waiting for their blocks to be timed
+#define PRINT_TIME_EXTENSION  ".tim"
+
+class PrintTime {
+
+  public: /** Constructor */
+
+    PrintTime() {}
+
+  private: /** Private Parameters */
+
+    // A file position or a layer start, timed when the planner delivers its first block
+    typedef struct {
+      uint32_t  serial,     // Blocks queued before the mark
+                sdpos;
+      bool      layer;
+    } mark_t;
+
+    static SdFile   file;
+
+    static bool     in_command,                 // The dry run waits for a command, the blocks can be timed
+                    rising;                     // Z went up, a layer starts if it extrudes there
+
+    static uint32_t total_ms,                   // Time of the blocks timed so far
+                    consumed,                   // Blocks timed so far
+                    layer_start_ms,
+                    layer_sdpos,
+                    rise_serial,
+                    rise_sdpos,
+                    rise_ms;                    // Time of the rise once its blocks are timed
+    static uint16_t total_us,                   // Below a millisecond
+                    layers;
+
+    static float    layer_z;
+
+    static mark_t   mark[PRINT_TIME_MARKS];
+    static uint8_t  mark_head, mark_tail;
+
+    // Estimate of the selected file, 0 points if there is none
+    static uint8_t  points;
+    static uint32_t point_sdpos[PRINT_TIME_POINTS + 2],
+                    point_ms[PRINT_TIME_POINTS + 2];
+
+  public: /** Public Function */
+
+    /**
+     * M37: run the file through the planner and write the sidecar file
+     */
+    static void estimate(const char * const path);
+
+    /**
+     * Called by printer.idle(), time a block while a command of the dry run waits
+     */
+    static void idle();
+
+    /**
+     * M23: read the sidecar file of the selected file, if any
+     */
+    static void load(const char * const path);
+
+    /**
+     * Print progress by the estimated time, by the bytes read without an estimate
+     */
+    static uint8_t percentDone();
+
+    /**
+     * M27: the estimated time left of the SD print
+     */
+    static void print_status();
+
+  private: /** Private Function */
+
+    static bool sidecar_name(char * const name, const char * const path);
+    static void run_line(char * const line, const uint32_t sdpos);
+    static bool consume_block();
+    static void add_mark(const uint32_t sdpos, const bool layer, const uint32_t serial);
+    static void write_mark(const mark_t &m, const uint32_t ms);
+    static void write_layer(const uint32_t ms);
+    static uint32_t elapsed_ms(const uint32_t sdpos);
+
+    // Blocks queued so far by the dry run
+    FORCE_INLINE static uint32_t queued() { return consumed + planner.moves_planned(); }
+
+};
+
+extern PrintTime printtime;
+
+#endif // ENABLED(PRINT_TIME_ESTIMATE)
@@ -536,6 +536,11 @@ float Probe::run_probing() {
       mechanics.do_blocking_move_to_z(mechanics.position.z + Z_PROBE_BETWEEN_HEIGHT, MMM_TO_MMS(data.speed_fast));
   }
 
+  #if ENABLED(Z_PROBE_REPETITIONS_TOLERANCE)
+    float last_z = NAN;
+  #endif
+
+  uint8_t samples = 0;
   for (uint8_t r = data.repetitions + 1; --r;) {
 
     // move down slowly to find bed
@@ -548,11 +553,19 @@ float Probe::run_probing() {
     }
 
     probe_z += mechanics.position.z;
+    samples++;
+
+    #if ENABLED(Z_PROBE_REPETITIONS_TOLERANCE)
+      // Two consecutive readings agree, the next ones would not change the mean much
+      if (ABS(mechanics.position.z - last_z) <= Z_PROBE_REPETITIONS_TOLERANCE) break;
+      last_z = mechanics.position.z;
+    #endif
+
     if (r > 1) mechanics.do_blocking_move_to_z(mechanics.position.z + Z_PROBE_BETWEEN_HEIGHT, MMM_TO_MMS(data.speed_fast));
 
   }
 
-  return probe_z / (float)data.repetitions;
+  return probe_z / (float)samples;
 }
 
 void Probe::print_error() {
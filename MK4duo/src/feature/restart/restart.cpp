@@ -35,7 +35,7 @@ restart_job_t Restart::job_info;
 bool  Restart::enabled;
 
 uint32_t  Restart::cmd_sdpos      = 0,
-          Restart::sdpos[BUFSIZE] = { 0 };  
+          Restart::sdpos[BUFSIZE_LINES] = { 0 };  
 
 /** Public Function */
 void Restart::enable(const bool onoff) {
@@ -109,7 +109,7 @@ class Restart {
     static bool enabled;
 
     static uint32_t cmd_sdpos,
-                    sdpos[BUFSIZE];
+                    sdpos[BUFSIZE_LINES];
 
   public: /** Public Function */
 
@@ -0,0 +1,157 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * steptimeline.cpp
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#include "../../../MK4duo.h"
+#include "sanitycheck.h"
+
+#if ENABLED(STEP_TIMELINE)
+
+StepTimeline steptimeline;
+
+/** Public Parameters */
+TimelineModeEnum StepTimeline::mode = TIMELINE_OFF;
+
+/** Private Parameters */
+timeline_record_t StepTimeline::buffer[STEP_TIMELINE_BUFFER_SIZE];
+volatile uint8_t  StepTimeline::head              = 0,
+                  StepTimeline::tail              = 0;
+volatile bool     StepTimeline::active            = false;
+uint32_t          StepTimeline::clock             = 0;
+volatile uint16_t StepTimeline::dropped           = 0;
+uint16_t          StepTimeline::dropped_reported  = 0;
+
+#if HAS_SD_SUPPORT
+  SdFile StepTimeline::file;
+  constexpr char timeline_file_name[] = "timeline.log";
+#endif
+
+/** Public Function */
+void StepTimeline::start(const TimelineModeEnum new_mode) {
+
+  stop();
+  if (new_mode == TIMELINE_OFF) return;
+
+  #if HAS_SD_SUPPORT
+    if (new_mode == TIMELINE_SD) {
+      if (!card.isMounted() || !file.open(card.fat.vwd(), timeline_file_name, O_WRITE | O_CREAT | O_TRUNC)) {
+        SERIAL_LMT(ER, STR_SD_OPEN_FILE_FAIL, timeline_file_name);
+        return;
+      }
+      SERIAL_EMT(STR_SD_WRITE_TO_FILE, timeline_file_name);
+    }
+  #else
+    if (new_mode == TIMELINE_SD) return;
+  #endif
+
+  mode = new_mode;
+
+  // Header: timer rate and steps per unit of each stepper, the host tool needs them
+  char line[80];
+  sprintf_P(line, PSTR("TL:H %lu %lu %lu %lu %lu\n"),
+    (unsigned long)(STEPPER_TIMER_RATE),
+    (unsigned long)LROUND(mechanics.data.axis_steps_per_mm[A_AXIS] * 1000),
+    (unsigned long)LROUND(mechanics.data.axis_steps_per_mm[B_AXIS] * 1000),
+    (unsigned long)LROUND(mechanics.data.axis_steps_per_mm[C_AXIS] * 1000),
+    (unsigned long)LROUND(extruders[toolManager.extruder.active]->data.axis_steps_per_mm * 1000)
+  );
+  write_line(line);
+
+  // The ISR does not touch the ring while inactive
+  head = tail = 0;
+  clock = 0;
+  dropped = dropped_reported = 0;
+  active = true;
+}
+
+void StepTimeline::stop() {
+  if (mode == TIMELINE_OFF) return;
+  active = false;
+  // The ISR adds no more records, write all of them before closing
+  do spin(); while (tail != head);
+  #if HAS_SD_SUPPORT
+    if (mode == TIMELINE_SD) file.close();
+  #endif
+  mode = TIMELINE_OFF;
+}
+
+void StepTimeline::report() {
+  SERIAL_MV("Step timeline mode:", (int)mode);
+  SERIAL_EMV(" dropped:", dropped);
+}
+
+void StepTimeline::spin() {
+
+  if (mode == TIMELINE_OFF) return;
+
+  // Serial is slow, give the rest of idle() a chance between bursts
+  for (uint8_t count = (mode == TIMELINE_SERIAL ? 8 : STEP_TIMELINE_BUFFER_SIZE); count && tail != head; count--) {
+    write_record(buffer[tail & (STEP_TIMELINE_BUFFER_SIZE - 1)]);
+    tail = tail + 1;
+  }
+
+  CRITICAL_SECTION_START();
+    const uint16_t lost = dropped;
+  CRITICAL_SECTION_END();
+
+  if (lost != dropped_reported) {
+    char line[16];
+    sprintf_P(line, PSTR("TL:D %u\n"), lost);
+    write_line(line);
+    dropped_reported = lost;
+  }
+
+}
+
+/** Private Function */
+void StepTimeline::write_record(const timeline_record_t &r) {
+  char line[64];
+  switch (r.type) {
+    case 'B':
+      sprintf_P(line, PSTR("TL:B %lu %lu %lu %lu %u\n"), (unsigned long)r.d, (unsigned long)r.a, (unsigned long)r.b, (unsigned long)r.c, r.aux);
+      break;
+    case 'N':
+      sprintf_P(line, PSTR("TL:N %u %lu %lu %lu %lu\n"), r.aux, (unsigned long)r.a, (unsigned long)r.b, (unsigned long)r.c, (unsigned long)r.d);
+      break;
+    default:
+      sprintf_P(line, PSTR("TL:S %lu %lu %lu %u\n"), (unsigned long)r.c, (unsigned long)r.a, (unsigned long)r.b, r.aux);
+      break;
+  }
+  write_line(line);
+}
+
+void StepTimeline::write_line(const char * const line) {
+  #if HAS_SD_SUPPORT
+    if (mode == TIMELINE_SD) {
+      file.write(line, strlen(line));
+      return;
+    }
+  #endif
+  SERIAL_TXT(line);
+}
+
+#endif // ENABLED(STEP_TIMELINE)
@@ -0,0 +1,145 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * steptimeline.h
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(STEP_TIMELINE)
+
+enum TimelineModeEnum : uint8_t { TIMELINE_OFF, TIMELINE_SERIAL, TIMELINE_SD };
+
+/**
+ * Record written by the Stepper ISR
+ *
+ *  'B' Block start:  aux = oversampling, a = step_event_count, b = accelerate_until, c = decelerate_after, d = clock
+ *  'N' Block steps:  aux = direction_bits, a..d = steps A, B, C, E
+ *  'S' Sample:       aux = steps_per_isr, a = step_events_completed, b = interval, c = clock
+ */
+struct timeline_record_t {
+  char      type;
+  uint8_t   aux;
+  uint32_t  a, b, c, d;
+};
+
+class StepTimeline {
+
+  public: /** Constructor */
+
+    StepTimeline() {}
+
+  public: /** Public Parameters */
+
+    static TimelineModeEnum mode;
+
+  private: /** Private Parameters */
+
+    static timeline_record_t  buffer[STEP_TIMELINE_BUFFER_SIZE];
+    static volatile uint8_t   head, tail;
+    static volatile bool      active;
+    static uint32_t           clock;            // Stepper timer ticks since start, updated by the ISR only
+    static volatile uint16_t  dropped;          // Records lost because the ring was full
+    static uint16_t           dropped_reported;
+
+    #if HAS_SD_SUPPORT
+      static SdFile file;
+    #endif
+
+  public: /** Public Function */
+
+    /**
+     * Start recording to serial or SD, stop with TIMELINE_OFF
+     */
+    static void start(const TimelineModeEnum new_mode);
+    static void stop();
+
+    /**
+     * Print state and dropped records
+     */
+    static void report();
+
+    /**
+     * Drain the ring, called from Printer::idle()
+     */
+    static void spin();
+
+    /**
+     * Stepper ISR: a new block has been fetched
+     */
+    FORCE_INLINE static void block_start(const block_t * const block, const uint32_t event_count,
+                                         const uint32_t accel_until, const uint32_t decel_after, const uint8_t oversampling
+    ) {
+      if (!active) return;
+      if (free_records() < 2) { dropped++; return; }
+      timeline_record_t *r = &buffer[head & (STEP_TIMELINE_BUFFER_SIZE - 1)];
+      r->type = 'B';
+      r->aux  = oversampling;
+      r->a    = event_count;
+      r->b    = accel_until;
+      r->c    = decel_after;
+      r->d    = clock;
+      r = &buffer[(head + 1) & (STEP_TIMELINE_BUFFER_SIZE - 1)];
+      r->type = 'N';
+      r->aux  = block->direction_bits;
+      r->a    = block->steps.a;
+      r->b    = block->steps.b;
+      r->c    = block->steps.c;
+      r->d    = block->steps.e;
+      head = head + 2;  // Publish both records at once
+    }
+
+    /**
+     * Stepper ISR: the block phase has chosen the next interval
+     */
+    FORCE_INLINE static void sample(const bool has_block, const uint32_t completed, const uint32_t interval, const uint8_t steps_per_isr) {
+      if (!active) return;
+      if (has_block) {
+        if (free_records()) {
+          timeline_record_t * const r = &buffer[head & (STEP_TIMELINE_BUFFER_SIZE - 1)];
+          r->type = 'S';
+          r->aux  = steps_per_isr;
+          r->a    = completed;
+          r->b    = interval;
+          r->c    = clock;
+          head = head + 1;
+        }
+        else
+          dropped++;
+      }
+      clock += interval;
+    }
+
+  private: /** Private Function */
+
+    FORCE_INLINE static uint8_t free_records() { return STEP_TIMELINE_BUFFER_SIZE - uint8_t(head - tail); }
+
+    static void write_record(const timeline_record_t &r);
+    static void write_line(const char * const line);
+
+};
+
+extern StepTimeline steptimeline;
+
+#endif // ENABLED(STEP_TIMELINE)
@@ -27,7 +27,7 @@
 #define LCD_MESSAGEPGM(x)         LCD_MESSAGEPGM_P(GET_TEXT(x))
 #define LCD_ALERTMESSAGEPGM(x)    LCD_ALERTMESSAGEPGM_P(GET_TEXT(x))
 
-#define LCD_HAS_WAIT_FOR_MOVE     MECH(DELTA) || HAS_PROBE_MANUALLY || ENABLED(MESH_BED_LEVELING)
+#define LCD_HAS_WAIT_FOR_MOVE     (HAS_LCD_MENU && (MECH(DELTA) || HAS_PROBE_MANUALLY || ENABLED(MESH_BED_LEVELING)))
 
 #if ENABLED(LCD_PROGRESS_BAR) || ENABLED(SHOW_BOOTSCREEN)
   #define LCD_SET_CHARSET(C)      set_custom_characters(C)
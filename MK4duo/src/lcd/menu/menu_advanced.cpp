@@ -133,7 +133,7 @@ void menu_advanced_temperature() {
         EDIT_ITEM_N(float52, h, MSG_PID_I, &hotends[h]->data.pid.Ki, 0.01f, 9990);
         EDIT_ITEM_N(float52, h, MSG_PID_D, &hotends[h]->data.pid.Kd, 1, 9990);
         #if ENABLED(PID_ADD_EXTRUSION_RATE)
-          EDIT_ITEM_N(float3, h, MSG_PID_C, &hotends[h]->data.pid.Kc, 1, 9990);
+          EDIT_ITEM_N(float52, h, MSG_PID_C, &hotends[h]->data.pid.Kc, 0, 9990);
         #endif
         #if ENABLED(PID_AUTOTUNE_MENU)
           EDIT_ITEM_FAST_N(int3, h, MSG_PID_AUTOTUNE, &autotune_temp[h], 150, hotends[h]->data.temp.max - 10, []{
@@ -138,13 +138,44 @@ enum BlockFlagBitEnum : uint8_t {
   BLOCK_BIT_NOMINAL_LENGTH,
 
   // Sync the stepper counts from the block
-  BLOCK_BIT_SYNC_POSITION
+  BLOCK_BIT_SYNC_POSITION,
+
+  // The delta carriages follow the cartesian line of the block
+  BLOCK_BIT_DELTA_LINE,
+
+  // Z follows the mesh along the cartesian line of the block
+  BLOCK_BIT_LEVEL_LINE
 };
 
 enum BlockFlagEnum : uint8_t {
   BLOCK_FLAG_RECALCULATE    = _BV(BLOCK_BIT_RECALCULATE),
   BLOCK_FLAG_NOMINAL_LENGTH = _BV(BLOCK_BIT_NOMINAL_LENGTH),
-  BLOCK_FLAG_SYNC_POSITION  = _BV(BLOCK_BIT_SYNC_POSITION)
+  BLOCK_FLAG_SYNC_POSITION  = _BV(BLOCK_BIT_SYNC_POSITION),
+  BLOCK_FLAG_DELTA_LINE     = _BV(BLOCK_BIT_DELTA_LINE),
+  BLOCK_FLAG_LEVEL_LINE     = _BV(BLOCK_BIT_LEVEL_LINE)
+};
+
+/**
+ * Stepper
+ */
+enum TrapezoidPhaseEnum : uint8_t {
+  PHASE_ACCELERATE,
+  PHASE_CRUISE,
+  PHASE_DECELERATE
+};
+
+enum SegmentFlagBitEnum : uint8_t {
+  // First segment of a block
+  SEGMENT_BIT_BLOCK_START,
+
+  // First segment of the deceleration
+  SEGMENT_BIT_DECEL_START,
+
+  // Sync the stepper counts from the block
+  SEGMENT_BIT_SYNC_POSITION,
+
+  // Advance released after the step events of the block, E steps only
+  SEGMENT_BIT_E_ONLY
 };
 
 /**
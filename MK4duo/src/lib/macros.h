@@ -289,6 +289,7 @@
 #undef FMOD
 #undef COS
 #undef SIN
+#undef EXP
 #define ATAN2(y,x)  atan2f(y, x)
 #define POW(x, y)   powf(x, y)
 #define SQRT(x)     sqrtf(x)
@@ -300,6 +301,7 @@
 #define COS(x)      cosf(x)
 #define SIN(x)      sinf(x)
 #define LOG(x)      logf(x)
+#define EXP(x)      expf(x)
 
 #ifdef __cplusplus
 
@@ -0,0 +1,136 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * @brief   Single Producer Single Consumer Arena Queue class
+ * @details Variable-length NUL-terminated lines packed back-to-back in a
+ *          byte arena of S bytes with wrap-around, plus an SPSC_Queue index
+ *          of up to N records T. T must have a 'char *gcode' member that is
+ *          pointed into the arena, the other members are free for the user.
+ *          A line never wraps: when the tail of the arena is too short the
+ *          line starts again at the beginning and the tail is skipped.
+ *          L is the longest line, isFull() is true when it does not fit.
+ *
+ *          Producer:   T *slot = queue.reserve(len); if (slot) { fill(*slot); queue.commit(); }
+ *          Consumer:   if (!queue.isEmpty()) { use(queue.front()); queue.pop(); }
+ */
+template<typename T, uint16_t S, uint8_t N, uint16_t L>
+class SPSC_Arena {
+
+  static_assert(S >= L && S < 32768, "SPSC_Arena size must be L..32767");
+
+  private: /** Private Parameters */
+
+    SPSC_Queue<T, N>  index;        // Line records, front() is the oldest line
+    uint16_t          write_pos,    // Next free byte, used by the producer only
+                      reserved_end; // End of the reserved line, set by reserve()
+    uint8_t           dropped;      // Lines behind the front one to drop at the next pop()
+    char              arena[S];     // Lines
+
+  public: /** Constructor */
+
+    SPSC_Arena<T, S, N, L>() : write_pos(0), reserved_end(0), dropped(0) {}
+
+  public: /** Public Function */
+
+    /**
+     * Consumer: drop all queued lines. With keep_front the front line is
+     * still in use: its record and bytes stay valid until pop(), which also
+     * drops the lines queued behind it now. Lines queued later are kept.
+     */
+    void clear(const bool keep_front=false) {
+      if (keep_front && !index.isEmpty())
+        dropped = index.count() - 1;
+      else {
+        index.clear();
+        dropped = 0;
+      }
+    }
+
+    /**
+     * Producer: record for a line of len bytes (NUL included), nullptr if
+     * there is no room. slot->gcode points to len bytes in the arena to fill.
+     * The line is not visible to the consumer until commit().
+     */
+    T* reserve(const uint16_t len) {
+      T * const slot = index.reserve();
+      if (!slot) return nullptr;
+      const int16_t pos = find_room(len);
+      if (pos < 0) return nullptr;
+      slot->gcode = &arena[pos];
+      reserved_end = pos + len;
+      return slot;
+    }
+
+    /**
+     * Producer: publish the line returned by reserve()
+     */
+    void commit() {
+      write_pos = reserved_end;
+      index.commit();
+    }
+
+    /**
+     * Consumer: the oldest line, valid until pop()
+     */
+    T& front() { return index.front(); }
+
+    /**
+     * Consumer: release the oldest line and its bytes
+     */
+    void pop() {
+      index.pop();
+      for (; dropped; dropped--) index.pop();
+    }
+
+    bool isEmpty()  { return index.isEmpty(); }
+    bool isFull()   { return index.isFull() || find_room(L) < 0; }
+
+    uint8_t size()  { return N; }
+    uint8_t count() { return index.count() - dropped; }
+
+    // Index slot of the front line and of the next reserved line
+    uint8_t head()  { return index.head(); }
+    uint8_t tail()  { return index.tail(); }
+
+  private: /** Private Function */
+
+    /**
+     * Producer: arena offset for a line of len bytes, -1 if full.
+     * The bytes in use go from the oldest line up to write_pos,
+     * possibly wrapping at the end of the arena.
+     */
+    int16_t find_room(const uint16_t len) {
+      if (index.isEmpty()) {
+        // Keep going after the last line, after a clear() the consumer may still be running it
+        return write_pos + len <= S ? write_pos : (len <= S ? 0 : -1);
+      }
+      const uint16_t read_pos = index.front().gcode - arena;
+      if (write_pos > read_pos) {
+        if (write_pos + len <= S) return write_pos;
+        return len <= read_pos ? 0 : -1;
+      }
+      return write_pos + len <= read_pos ? write_pos : -1;
+    }
+
+};
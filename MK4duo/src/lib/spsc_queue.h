@@ -0,0 +1,117 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#ifndef sw_barrier
+  // A SW memory barrier, to ensure GCC does not reorder the slot access and the index update
+  #define sw_barrier() asm volatile("": : :"memory")
+#endif
+
+/**
+ * @brief   Single Producer Single Consumer Queue class
+ * @details Lock-free ring buffer with separate head and tail indices.
+ *          The producer only writes tail and the consumer only writes head,
+ *          so one side can run in an interrupt without disabling it.
+ *          The indices run over 2*N to distinguish full from empty
+ *          without wasting a slot, N must be 1..127.
+ *
+ *          Producer:   T *slot = queue.reserve(); if (slot) { fill(*slot); queue.commit(); }
+ *          Consumer:   if (!queue.isEmpty()) { use(queue.front()); queue.pop(); }
+ */
+template<typename T, uint8_t N>
+class SPSC_Queue {
+
+  static_assert(N > 0 && N < 128, "SPSC_Queue size must be 1..127");
+
+  private: /** Private Parameters */
+
+    volatile uint8_t  read_index,   // Read position, written by the consumer only
+                      write_index;  // Write position, written by the producer only
+    T queue[N];                     // Queue
+
+  public: /** Constructor */
+
+    SPSC_Queue<T, N>() : read_index(0), write_index(0) {}
+
+  public: /** Public Function */
+
+    /**
+     * Consumer: drop all queued items
+     */
+    void clear() { read_index = write_index; }
+
+    /**
+     * Producer: pointer to the free slot to fill in place, nullptr if full.
+     * The item is not visible to the consumer until commit().
+     */
+    T* reserve() { return isFull() ? nullptr : &queue[slot(write_index)]; }
+
+    /**
+     * Producer: publish the slot returned by reserve()
+     */
+    void commit() {
+      sw_barrier();
+      write_index = next(write_index);
+    }
+
+    bool enqueue(T const &item) {
+      T * const item_slot = reserve();
+      if (!item_slot) return false;
+      *item_slot = item;
+      commit();
+      return true;
+    }
+
+    /**
+     * Consumer: the oldest item, valid until pop()
+     */
+    T& front() { return queue[slot(read_index)]; }
+
+    /**
+     * Consumer: release the oldest item
+     */
+    void pop() {
+      if (isEmpty()) return;
+      sw_barrier();
+      read_index = next(read_index);
+    }
+
+    bool isEmpty()  { return read_index == write_index; }
+    bool isFull()   { return count() >= N; }
+
+    uint8_t size()  { return N; }
+
+    uint8_t count() {
+      const uint8_t r = read_index, w = write_index;
+      return w >= r ? w - r : w + 2 * N - r;
+    }
+
+    // Slot index of the front item and of the next reserved item
+    uint8_t head()  { return slot(read_index); }
+    uint8_t tail()  { return slot(write_index); }
+
+  private: /** Private Function */
+
+    static inline uint8_t slot(const uint8_t index) { return index < N ? index : index - N; }
+    static inline uint8_t next(const uint8_t index) { return index + 1 < 2 * N ? index + 1 : 0; }
+
+};
@@ -222,14 +222,14 @@ typedef uint16_t  ptr_int_t;
 #define ISR_BASE_CYCLES            752UL
 
 // Linear advance base time is 32 cycles
-#if ENABLED(LIN_ADVANCE)
+#if HAS_LIN_ADVANCE_ISR
   #define ISR_LA_BASE_CYCLES        32UL
 #else
   #define ISR_LA_BASE_CYCLES         0UL
 #endif
 
-// Bezier interpolation adds 160 cycles
-#if ENABLED(BEZIER_JERK_CONTROL)
+// Bezier interpolation adds 160 cycles, unless the segment buffer evaluates the curve out of the ISR
+#if ENABLED(BEZIER_JERK_CONTROL) && DISABLED(STEP_SEGMENT_BUFFER)
   #define ISR_BEZIER_CYCLES        160UL
 #else
   #define ISR_BEZIER_CYCLES          0UL
@@ -261,8 +261,8 @@ typedef uint16_t  ptr_int_t;
 // E is always interpolated
 #define ISR_E_STEPPER_CYCLES          ISR_STEPPER_CYCLES
 
-// If linear advance is disabled, then the loop also handles them
-#if DISABLED(LIN_ADVANCE) && ENABLED(COLOR_MIXING_EXTRUDER)
+// If linear advance has no ISR of its own, then the loop also handles them
+#if !HAS_LIN_ADVANCE_ISR && ENABLED(COLOR_MIXING_EXTRUDER)
   #define ISR_MIXING_STEPPER_CYCLES   ((MIXING_STEPPERS) * (ISR_STEPPER_CYCLES))
 #else
   #define ISR_MIXING_STEPPER_CYCLES   0UL
@@ -276,8 +276,8 @@ typedef uint16_t  ptr_int_t;
 
 #define TIMER_SETUP_NS                (1000UL * (TIMER_CYCLES) / ((F_CPU) / 1000000))
 
-// If linear advance is enabled, then it is handled separately
-#if ENABLED(LIN_ADVANCE)
+// If linear advance has its own ISR, then it is handled separately
+#if HAS_LIN_ADVANCE_ISR
 
   // Estimate the minimum LA loop time
   #if ENABLED(COLOR_MIXING_EXTRUDER)
@@ -64,16 +64,16 @@ uint8_t MCUSR;
 
 /** Private Parameters */
 #if HAS_HOTENDS
-  ADCAveragingFilter HAL::HOTENDsensorFilters[MAX_HOTEND];
+  HOTENDAveragingFilter HAL::HOTENDsensorFilters[MAX_HOTEND];
 #endif
 #if HAS_BEDS
-  ADCAveragingFilter HAL::BEDsensorFilters[MAX_BED];
+  BEDAveragingFilter HAL::BEDsensorFilters[MAX_BED];
 #endif
 #if HAS_CHAMBERS
-  ADCAveragingFilter HAL::CHAMBERsensorFilters[MAX_CHAMBER];
+  CHAMBERAveragingFilter HAL::CHAMBERsensorFilters[MAX_CHAMBER];
 #endif
 #if HAS_COOLERS
-  ADCAveragingFilter HAL::COOLERsensorFilters[MAX_COOLER];
+  COOLERAveragingFilter HAL::COOLERsensorFilters[MAX_COOLER];
 #endif
 
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -88,6 +88,14 @@ uint8_t MCUSR;
   ADCAveragingFilter  HAL::mcuFilter;
 #endif
 
+// Blocks of tagged conversions filled by the PDC, one is read while the other one is filled
+static uint16_t adc_buffer[2][ADC_BUFFER_SAMPLES];
+static uint8_t  adc_buffer_index = 0;
+
+// Mean of the last block for every ADC channel
+static_assert(NUM_ANALOG_INPUTS <= ADC_TAG_CHANNELS, "NUM_ANALOG_INPUTS is larger than the ADC channels.");
+static uint16_t adc_channel_value[ADC_TAG_CHANNELS] = { 0 };
+
 __attribute__ ((aligned(256)))
 static DeviceVectors ram_tab = { NULL };
 
@@ -200,17 +208,6 @@ adc_channel_num_t PinToAdcChannel(pin_t pin) {
   return (adc_channel_num_t)g_APinDescription[pin].ulADCChannelNumber;
 }
 
-// Start converting the enabled channels
-void AnalogInStartConversion() {
-  // Clear out any existing conversion complete bits in the status register
-  for (uint32_t chan = 0; chan < 16; ++chan) {
-    if ((adc_get_status(ADC) & (1 << chan)) != 0) {
-      (void)adc_get_channel_value(ADC, static_cast<adc_channel_num_t>(chan));
-    }
-  }
-  ADC->ADC_CR = ADC_CR_START;
-}
-
 // Enable or disable a channel.
 void AnalogInEnablePin(const pin_t r_pin, const bool enable) {
   adc_channel_num_t adc_ch = PinToAdcChannel(r_pin);
@@ -228,12 +225,12 @@ void AnalogInEnablePin(const pin_t r_pin, const bool enable) {
   }
 }   
 
-// Read the most recent 12-bit result from a pin
+// Read the 12-bit mean of the last block of conversions of a pin
 uint16_t AnalogInReadPin(const pin_t r_pin) {
 
   adc_channel_num_t adc_ch = PinToAdcChannel(r_pin);
   if ((unsigned int)adc_ch < NUM_ANALOG_INPUTS)
-    return adc_get_channel_value(ADC, adc_ch);
+    return adc_channel_value[adc_ch];
   else
     return 0;
 }
@@ -304,26 +301,41 @@ void HAL::analogStart() {
   #endif
 
   // Initialize ADC mode register (some of the following params are not used here)
-  // HW trigger disabled, use external Trigger, 12 bit resolution
-  // core and ref voltage stays on, normal sleep mode, normal not free-run mode
+  // HW trigger disabled, 12 bit resolution
+  // core and ref voltage stays on, normal sleep mode, free-run mode
   // startup time 16 clocks, settling time 17 clocks, no changes on channel switch
   // convert channels in numeric order
   // set prescaler rate  MCK/((PRESCALE+1) * 2)
   // set tracking time  (TRACKTIM+1) * clock periods
   // set transfer period  (TRANSFER * 2 + 3)
   ADC->ADC_MR = ADC_MR_TRGEN_DIS | ADC_MR_TRGSEL_ADC_TRIG0 | ADC_MR_LOWRES_BITS_12 |
-                ADC_MR_SLEEP_NORMAL | ADC_MR_FWUP_OFF | ADC_MR_FREERUN_OFF |
+                ADC_MR_SLEEP_NORMAL | ADC_MR_FWUP_OFF | ADC_MR_FREERUN_ON |
                 ADC_MR_STARTUP_SUT64 | ADC_MR_SETTLING_AST17 | ADC_MR_ANACH_NONE |
                 ADC_MR_USEQ_NUM_ORDER |
                 ADC_MR_PRESCAL(AD_PRESCALE_FACTOR) |
                 ADC_MR_TRACKTIM(AD_TRACKING_CYCLES) |
                 ADC_MR_TRANSFER(AD_TRANSFER_CYCLES);
 
-  ADC->ADC_IER = 0;             // no ADC interrupts
+  ADC->ADC_EMR = ADC_EMR_TAG;   // Channel number in the 4 MSB of every conversion
   ADC->ADC_COR = 0;             // Single-ended, no offset
 
-  // start first conversion
-  AnalogInStartConversion();
+  // PDC moves every conversion to the current block and then switches to the next one
+  ADC->ADC_PTCR = ADC_PTCR_RXTDIS | ADC_PTCR_TXTDIS;
+  ADC->ADC_RPR  = (uint32_t)adc_buffer[0];
+  ADC->ADC_RCR  = ADC_BUFFER_SAMPLES;
+  ADC->ADC_RNPR = (uint32_t)adc_buffer[1];
+  ADC->ADC_RNCR = ADC_BUFFER_SAMPLES;
+  adc_buffer_index = 0;
+  ADC->ADC_PTCR = ADC_PTCR_RXTEN;
+
+  // Interrupt only when a block is full
+  ADC->ADC_IDR = 0xFFFFFFFF;
+  ADC->ADC_IER = ADC_IER_ENDRX;
+  NVIC_SetPriority(ADC_IRQn, NvicPriorityAdc);
+  NVIC_EnableIRQ(ADC_IRQn);
+
+  // start free-run conversions
+  ADC->ADC_CR = ADC_CR_START;
 }
 
 void HAL::AdcChangePin(const pin_t old_pin, const pin_t new_pin) {
@@ -542,7 +554,6 @@ void HAL::analogWrite(const pin_t pin, uint32_t ulValue, const uint16_t freq/*=1
  * It is used to update pwm values for heater and some other frequent jobs.
  *
  *  - Manage PWM to all the heaters and fan
- *  - Prepare or Measure one of the raw ADC sensor values
  *  - Step the babysteps value for each axis towards 0
  *  - For PINS_DEBUGGING, monitor and report endstop pins
  *  - For ENDSTOP_INTERRUPTS_FEATURE check endstops if flagged
@@ -566,74 +577,114 @@ void HAL::Tick() {
   // Event 1.0 Second
   if (cycle_1s_timer.expired(1000)) printer.check_periodical_actions();
 
-  // Read analog or SPI values
-  if (adc_get_status(ADC)) { // conversion finished?
-
-    #if HAS_HOTENDS
-      LOOP_HOTEND() {
-        if (WITHIN(hotends[h]->data.sensor.pin, 0, 15)) {
-          ADCAveragingFilter& currentFilter = const_cast<ADCAveragingFilter&>(HOTENDsensorFilters[h]);
-          currentFilter.process_reading(AnalogInReadPin(hotends[h]->data.sensor.pin));
-          if (currentFilter.IsValid())
-            hotends[h]->data.sensor.adc_raw = currentFilter.GetSum();
-        }
+  // Tick endstops state, if required
+  endstops.Tick();
+
+}
+
+/**
+ * ADC Isr is called when the PDC has filled a block of conversions.
+ *
+ *  - Give the block back to the PDC as the next one
+ *  - Restart the PDC on both blocks if it stopped because an interrupt was missed
+ *  - Store the mean of the block for every channel
+ *  - Update the averaging filter and the raw value of every analog sensor
+ */
+void HAL::AdcIsr() {
+
+  if (!(ADC->ADC_ISR & ADC_ISR_ENDRX)) return;
+
+  // The PDC is already filling the other block, unless it has filled
+  // both and stopped: then the other block is the last one
+  const bool stopped = !ADC->ADC_RCR;
+  const uint16_t * const buffer = adc_buffer[adc_buffer_index ^ (stopped ? 1 : 0)];
+
+  uint32_t  sum[ADC_TAG_CHANNELS]    = { 0 };
+  uint16_t  count[ADC_TAG_CHANNELS]  = { 0 };
+
+  for (uint16_t i = 0; i < ADC_BUFFER_SAMPLES; i++) {
+    const uint8_t chan = buffer[i] >> 12;
+    sum[chan] += buffer[i] & 0x0FFF;
+    count[chan]++;
+  }
+
+  // Writing the counters clears ENDRX
+  if (stopped) {
+    ADC->ADC_RPR  = (uint32_t)adc_buffer[0];
+    ADC->ADC_RCR  = ADC_BUFFER_SAMPLES;
+    ADC->ADC_RNPR = (uint32_t)adc_buffer[1];
+    ADC->ADC_RNCR = ADC_BUFFER_SAMPLES;
+    adc_buffer_index = 0;
+  }
+  else {
+    ADC->ADC_RNPR = (uint32_t)buffer;
+    ADC->ADC_RNCR = ADC_BUFFER_SAMPLES;
+    adc_buffer_index ^= 1;
+  }
+
+  for (uint8_t chan = 0; chan < ADC_TAG_CHANNELS; chan++)
+    if (count[chan]) adc_channel_value[chan] = (sum[chan] + (count[chan] >> 1)) / count[chan];
+
+  if (printer.isStopped()) return;
+
+  #if HAS_HOTENDS
+    LOOP_HOTEND() {
+      if (WITHIN(hotends[h]->data.sensor.pin, 0, 15)) {
+        HOTENDAveragingFilter& currentFilter = HOTENDsensorFilters[h];
+        currentFilter.process_reading(AnalogInReadPin(hotends[h]->data.sensor.pin));
+        if (currentFilter.IsValid())
+          hotends[h]->data.sensor.adc_raw = currentFilter.GetSum();
       }
-    #endif
-    #if HAS_BEDS
-      LOOP_BED() {
-        if (WITHIN(beds[h]->data.sensor.pin, 0, 15)) {
-          ADCAveragingFilter& currentFilter = const_cast<ADCAveragingFilter&>(BEDsensorFilters[h]);
-          currentFilter.process_reading(AnalogInReadPin(beds[h]->data.sensor.pin));
-          if (currentFilter.IsValid())
-            beds[h]->data.sensor.adc_raw = currentFilter.GetSum();
-        }
+    }
+  #endif
+  #if HAS_BEDS
+    LOOP_BED() {
+      if (WITHIN(beds[h]->data.sensor.pin, 0, 15)) {
+        BEDAveragingFilter& currentFilter = BEDsensorFilters[h];
+        currentFilter.process_reading(AnalogInReadPin(beds[h]->data.sensor.pin));
+        if (currentFilter.IsValid())
+          beds[h]->data.sensor.adc_raw = currentFilter.GetSum();
       }
-    #endif
-    #if HAS_CHAMBERS
-      LOOP_CHAMBER() {
-        if (WITHIN(chambers[h]->data.sensor.pin, 0, 15)) {
-          ADCAveragingFilter& currentFilter = const_cast<ADCAveragingFilter&>(CHAMBERsensorFilters[h]);
-          currentFilter.process_reading(AnalogInReadPin(chambers[h]->data.sensor.pin));
-          if (currentFilter.IsValid())
-            chambers[h]->data.sensor.adc_raw = currentFilter.GetSum();
-        }
+    }
+  #endif
+  #if HAS_CHAMBERS
+    LOOP_CHAMBER() {
+      if (WITHIN(chambers[h]->data.sensor.pin, 0, 15)) {
+        CHAMBERAveragingFilter& currentFilter = CHAMBERsensorFilters[h];
+        currentFilter.process_reading(AnalogInReadPin(chambers[h]->data.sensor.pin));
+        if (currentFilter.IsValid())
+          chambers[h]->data.sensor.adc_raw = currentFilter.GetSum();
       }
-    #endif
-    #if HAS_COOLERS
-      LOOP_COOLER() {
-        if (WITHIN(coolers[h]->data.sensor.pin, 0, 15)) {
-          ADCAveragingFilter& currentFilter = const_cast<ADCAveragingFilter&>(COOLERsensorFilters[h]);
-          currentFilter.process_reading(AnalogInReadPin(coolers[h]->data.sensor.pin));
-          if (currentFilter.IsValid())
-            coolers[h]->data.sensor.adc_raw = currentFilter.GetSum();
-        }
+    }
+  #endif
+  #if HAS_COOLERS
+    LOOP_COOLER() {
+      if (WITHIN(coolers[h]->data.sensor.pin, 0, 15)) {
+        COOLERAveragingFilter& currentFilter = COOLERsensorFilters[h];
+        currentFilter.process_reading(AnalogInReadPin(coolers[h]->data.sensor.pin));
+        if (currentFilter.IsValid())
+          coolers[h]->data.sensor.adc_raw = currentFilter.GetSum();
       }
-    #endif
-
-    #if ENABLED(FILAMENT_WIDTH_SENSOR)
-      const_cast<ADCAveragingFilter&>(filamentFilter).process_reading(AnalogInReadPin(FILWIDTH_PIN));
-      if (filamentFilter.IsValid())
-        tempManager.current_raw_filwidth = filamentFilter.GetSum();
-    #endif
-
-    #if HAS_POWER_CONSUMPTION_SENSOR
-      const_cast<ADCAveragingFilter&>(powerFilter).process_reading(AnalogInReadPin(POWER_CONSUMPTION_PIN));
-      if (powerFilter.IsValid())
-        powerManager.current_raw_powconsumption = powerFilter.GetSum();
-    #endif
-
-    #if HAS_MCU_TEMPERATURE
-      const_cast<ADCAveragingFilter&>(mcuFilter).process_reading(AnalogInReadPin(ADC_TEMPERATURE_SENSOR));
-      if (mcuFilter.IsValid())
-        tempManager.mcu_current_temperature_raw = mcuFilter.GetSum();
-    #endif
+    }
+  #endif
 
-  }
+  #if ENABLED(FILAMENT_WIDTH_SENSOR)
+    const_cast<ADCAveragingFilter&>(filamentFilter).process_reading(AnalogInReadPin(FILWIDTH_PIN));
+    if (filamentFilter.IsValid())
+      tempManager.current_raw_filwidth = filamentFilter.GetSum();
+  #endif
 
-  AnalogInStartConversion();
+  #if HAS_POWER_CONSUMPTION_SENSOR
+    const_cast<ADCAveragingFilter&>(powerFilter).process_reading(AnalogInReadPin(POWER_CONSUMPTION_PIN));
+    if (powerFilter.IsValid())
+      powerManager.current_raw_powconsumption = powerFilter.GetSum();
+  #endif
 
-  // Tick endstops state, if required
-  endstops.Tick();
+  #if HAS_MCU_TEMPERATURE
+    const_cast<ADCAveragingFilter&>(mcuFilter).process_reading(AnalogInReadPin(ADC_TEMPERATURE_SENSOR));
+    if (mcuFilter.IsValid())
+      tempManager.mcu_current_temperature_raw = mcuFilter.GetSum();
+  #endif
 
 }
 
@@ -662,6 +713,11 @@ extern "C" int sysTickHook() {
   return 0;
 }
 
+// This is the ADC end of block interrupt
+extern "C" void ADC_Handler() {
+  HAL::AdcIsr();
+}
+
 HAL_TONE_TIMER_ISR() {
   static uint8_t pin_state = 0;
   HAL_timer_isr_prologue(TONE_TIMER_NUM);
@@ -191,6 +191,8 @@ typedef uint32_t  ptr_int_t;
 #define AD_RANGE          _BV(ANALOG_INPUT_BITS)
 #define ABS_ZERO        -273.15f
 #define NUM_ADC_SAMPLES   32
+#define ADC_BUFFER_SAMPLES 128
+#define ADC_TAG_CHANNELS   16   // Channels the 4 bit tag of a conversion can name
 #define AD595_MAX        330.0f
 #define AD8495_MAX       660.0f
 
@@ -215,7 +217,11 @@ extern "C" {
 
 extern "C" char *dtostrf (double __val, signed char __width, unsigned char __prec, char *__s);
 
-typedef AveragingFilter<NUM_ADC_SAMPLES> ADCAveragingFilter;
+typedef AveragingFilter<NUM_ADC_SAMPLES>      ADCAveragingFilter;
+typedef AveragingFilter<HOTEND_ADC_SAMPLES>   HOTENDAveragingFilter;
+typedef AveragingFilter<BED_ADC_SAMPLES>      BEDAveragingFilter;
+typedef AveragingFilter<CHAMBER_ADC_SAMPLES>  CHAMBERAveragingFilter;
+typedef AveragingFilter<COOLER_ADC_SAMPLES>   COOLERAveragingFilter;
 
 // ISR handler type
 using pfnISR_Handler = void(*)(void);
@@ -234,16 +240,16 @@ class HAL {
   private: /** Private Parameters */
 
     #if HAS_HOTENDS
-      static ADCAveragingFilter HOTENDsensorFilters[MAX_HOTEND];
+      static HOTENDAveragingFilter HOTENDsensorFilters[MAX_HOTEND];
     #endif
     #if HAS_BEDS
-      static ADCAveragingFilter BEDsensorFilters[MAX_BED];
+      static BEDAveragingFilter BEDsensorFilters[MAX_BED];
     #endif
     #if HAS_CHAMBERS
-      static ADCAveragingFilter CHAMBERsensorFilters[MAX_CHAMBER];
+      static CHAMBERAveragingFilter CHAMBERsensorFilters[MAX_CHAMBER];
     #endif
     #if HAS_COOLERS
-      static ADCAveragingFilter COOLERsensorFilters[MAX_COOLER];
+      static COOLERAveragingFilter COOLERsensorFilters[MAX_COOLER];
     #endif
 
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -262,6 +268,7 @@ class HAL {
 
     static void analogStart();
     static void AdcChangePin(const pin_t old_pin, const pin_t new_pin);
+    static void AdcIsr();
 
     static void hwSetup(void);
 
@@ -62,6 +62,7 @@
 #define NUM_HARDWARE_TIMERS 9
 
 #define NvicPriorityUart    1
+#define NvicPriorityAdc     14
 #define NvicPrioritySystick 15
 
 // Tone for due
@@ -99,14 +100,14 @@
 #define ISR_BASE_CYCLES            792UL
 
 // Linear advance base time is 64 cycles
-#if ENABLED(LIN_ADVANCE)
+#if HAS_LIN_ADVANCE_ISR
   #define ISR_LA_BASE_CYCLES        64UL
 #else
   #define ISR_LA_BASE_CYCLES         0UL
 #endif
 
-// Bezier interpolation adds 40 cycles
-#if ENABLED(BEZIER_JERK_CONTROL)
+// Bezier interpolation adds 40 cycles, unless the segment buffer evaluates the curve out of the ISR
+#if ENABLED(BEZIER_JERK_CONTROL) && DISABLED(STEP_SEGMENT_BUFFER)
   #define ISR_BEZIER_CYCLES         40UL
 #else
   #define ISR_BEZIER_CYCLES          0UL
@@ -138,8 +139,8 @@
 // E is always interpolated
 #define ISR_E_STEPPER_CYCLES          ISR_STEPPER_CYCLES
 
-// If linear advance is disabled, then the loop also handles them
-#if DISABLED(LIN_ADVANCE) && ENABLED(COLOR_MIXING_EXTRUDER)
+// If linear advance has no ISR of its own, then the loop also handles them
+#if !HAS_LIN_ADVANCE_ISR && ENABLED(COLOR_MIXING_EXTRUDER)
   #define ISR_MIXING_STEPPER_CYCLES   ((MIXING_STEPPERS) * 16UL)
 #else
   #define ISR_MIXING_STEPPER_CYCLES   0UL
@@ -153,8 +154,8 @@
 
 #define TIMER_SETUP_NS                (1000UL * TIMER_CYCLES / ((F_CPU) / 1000000UL))
 
-// If linear advance is enabled, then it is handled separately
-#if ENABLED(LIN_ADVANCE)
+// If linear advance has its own ISR, then it is handled separately
+#if HAS_LIN_ADVANCE_ISR
 
   // Estimate the minimum LA loop time
   #if ENABLED(COLOR_MIXING_EXTRUDER)
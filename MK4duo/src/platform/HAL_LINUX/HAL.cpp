@@ -0,0 +1,316 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * This is the main Hardware Abstraction Layer (HAL).
+ * To make the firmware work with different processors and toolchains,
+ * all hardware related code should be packed into the hal files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Description: HAL for native Linux host (simulation and benchmarking)
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * ARDUINO_ARCH_LINUX
+ */
+
+#ifdef ARDUINO_ARCH_LINUX
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+#include "../../../MK4duo.h"
+#include <time.h>
+
+// --------------------------------------------------------------------------
+// Local defines
+// --------------------------------------------------------------------------
+
+// Virtual time spent by one pass of the main loop
+#ifndef HAL_IDLE_US
+  #define HAL_IDLE_US 10
+#endif
+
+// ADC value of a 100K thermistor with 4K7 pullup at 25°C
+#define HAL_ROOM_TEMP_ADC 3912
+
+/** Public Parameters */
+uint8_t MCUSR = RST_POWER_ON;
+
+volatile bool HAL_isr_enabled = true;
+
+uint16_t HAL::analog_value[NUM_ANALOG_INPUTS];
+
+SPIClass SPI;
+
+/** Private Parameters */
+static uint32_t pwm_value[NUM_DIGITAL_PINS] = { 0 };
+
+static struct timespec start_time;
+
+// disable interrupts
+void cli() { DISABLE_ISRS(); }
+
+// enable interrupts
+void sei() { ENABLE_ISRS(); }
+
+// Return available memory, no limit on host
+int freeMemory() { return 0x10000; }
+
+uint32_t wall_micros() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return uint32_t(int64_t(now.tv_sec - start_time.tv_sec) * 1000000LL + (now.tv_nsec - start_time.tv_nsec) / 1000);
+}
+
+char *dtostrf(double __val, signed char __width, unsigned char __prec, char *__s) {
+  sprintf(__s, "%*.*f", __width, __prec, __val);
+  return __s;
+}
+
+// Tone on the virtual tone timer
+static pin_t tone_pin = NoPin;
+static int32_t toggles;
+
+void tone(const pin_t _pin, const uint16_t frequency, const uint16_t duration) {
+  tone_pin = _pin;
+  toggles = 2 * frequency * duration / 1000;
+  HAL_timer_start(TONE_TIMER_NUM, 2 * frequency);
+}
+
+void noTone(const pin_t _pin) {
+  HAL_timer_disable_interrupt(TONE_TIMER_NUM);
+  HAL::digitalWrite(_pin, LOW);
+}
+
+void HAL_tone_isr() {
+  static uint8_t pin_state = 0;
+  if (toggles) {
+    toggles--;
+    HAL::digitalWrite(tone_pin, (pin_state ^= 1));
+  }
+  else noTone(tone_pin);
+}
+
+HAL::HAL() {
+  // ctor
+}
+
+HAL::~HAL() {
+  // dtor
+}
+
+// do any hardware-specific initialization here
+void HAL::hwSetup() {
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  for (uint8_t i = 0; i < NUM_ANALOG_INPUTS; i++) analog_value[i] = HAL_ROOM_TEMP_ADC;
+  pinlog.init();
+  simbed.init();
+}
+
+// Print apparent cause of start/restart
+void HAL::showStartReason() {
+  SERIAL_EM(STR_POWERUP);
+}
+
+void HAL::analogStart() {}
+
+void HAL::AdcChangePin(const pin_t old_pin, const pin_t new_pin) {
+  UNUSED(old_pin);
+  UNUSED(new_pin);
+}
+
+// Reset is the end of the process
+void HAL::resetHardware() {
+  MKSERIAL1.flushTX();
+  pinlog.close();
+  exit(0);
+}
+
+bool HAL::pwm_status(const pin_t pin) {
+  UNUSED(pin);
+  return true;
+}
+
+bool HAL::tc_status(const pin_t pin) {
+  UNUSED(pin);
+  return false;
+}
+
+void HAL::analogWrite(const pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000U*/) {
+  UNUSED(freq);
+  if (WITHIN(pin, 0, NUM_DIGITAL_PINS - 1)) pwm_value[pin] = ulValue;
+}
+
+/**
+ * Tick function, called every 1ms by the virtual clock
+ *  - Set heaters and fans PWM
+ *  - Manage heaters every 100ms
+ *  - Read the virtual ADC values
+ *  - Tick endstops state
+ */
+void HAL::Tick() {
+
+  static short_timer_t  cycle_1s_timer(millis()),
+                        cycle_100_timer(millis());
+
+  if (printer.isStopped()) return;
+
+  // Heaters set output PWM
+  tempManager.set_output_pwm();
+
+  // Fans set output PWM
+  fanManager.set_output_pwm();
+
+  // Event 100 ms
+  if (cycle_100_timer.expired(100)) tempManager.spin();
+
+  // Event 1.0 Second
+  if (cycle_1s_timer.expired(1000)) printer.check_periodical_actions();
+
+  // Read analog values, no filter needed for a noiseless virtual ADC
+  #if HAS_HOTENDS
+    LOOP_HOTEND()
+      if (WITHIN(hotends[h]->data.sensor.pin, 0, NUM_ANALOG_INPUTS - 1))
+        hotends[h]->data.sensor.adc_raw = analog_value[hotends[h]->data.sensor.pin];
+  #endif
+  #if HAS_BEDS
+    LOOP_BED()
+      if (WITHIN(beds[h]->data.sensor.pin, 0, NUM_ANALOG_INPUTS - 1))
+        beds[h]->data.sensor.adc_raw = analog_value[beds[h]->data.sensor.pin];
+  #endif
+  #if HAS_CHAMBERS
+    LOOP_CHAMBER()
+      if (WITHIN(chambers[h]->data.sensor.pin, 0, NUM_ANALOG_INPUTS - 1))
+        chambers[h]->data.sensor.adc_raw = analog_value[chambers[h]->data.sensor.pin];
+  #endif
+  #if HAS_COOLERS
+    LOOP_COOLER()
+      if (WITHIN(coolers[h]->data.sensor.pin, 0, NUM_ANALOG_INPUTS - 1))
+        coolers[h]->data.sensor.adc_raw = analog_value[coolers[h]->data.sensor.pin];
+  #endif
+
+  // Tick endstops state, if required
+  simbed.update();
+  endstops.Tick();
+
+}
+
+/**
+ * Idle task, called from printer idle
+ *  - Exit when stdin is closed and all commands and moves are done
+ *  - With a full planner jump to the next timer event
+ *  - Otherwise account the time of one main loop pass
+ */
+void HAL::idletask() {
+
+  if (MKSERIAL1.eof() && commands.buffer_ring.isEmpty() && !planner.has_blocks_queued()) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    MKSERIAL1.flushTX();
+    pinlog.report();
+    simbed.report();
+    fprintf(stderr, "real %.6f s\n", double(now.tv_sec - start_time.tv_sec) + double(now.tv_nsec - start_time.tv_nsec) * 1e-9);
+    pinlog.close();
+    exit(0);
+  }
+
+  if (planner.is_full())
+    HAL_clock_run(HAL_clock_next_event());
+  else
+    HAL_clock_delay(HAL_IDLE_US * (STEPPER_TIMER_TICKS_PER_US));
+
+}
+
+int32_t HAL::analog2tempMCU(const int16_t adc_raw) {
+  UNUSED(adc_raw);
+  return 25;
+}
+
+pin_t HAL::digital_value_pin() {
+  const pin_t pin = parser.value_pin();
+  return WITHIN(pin, 0 , NUM_DIGITAL_PINS - 1) ? pin : NoPin;
+}
+
+pin_t HAL::analog_value_pin() {
+  const pin_t pin = parser.value_pin();
+  return WITHIN(pin, 0 , NUM_ANALOG_INPUTS - 1) ? pin : NoPin;
+}
+
+/**
+ * Arduino core API on the virtual clock and pins
+ */
+uint32_t millis() { return uint32_t(HAL_clock / (HAL_TICKS_PER_MS)); }
+
+uint32_t micros() { return uint32_t(HAL_clock / (STEPPER_TIMER_TICKS_PER_US)); }
+
+void delay(const uint32_t ms) { HAL_clock_delay(ms * (HAL_TICKS_PER_MS)); }
+
+void delayMicroseconds(const uint32_t us) { HAL_clock_delay(us * (STEPPER_TIMER_TICKS_PER_US)); }
+
+void pinMode(const uint8_t pin, const uint8_t mode) { HAL::pinMode(pin, mode); }
+
+void digitalWrite(const uint8_t pin, const uint8_t value) { WRITE(pin, value); }
+
+int digitalRead(const uint8_t pin) { return READ(pin); }
+
+int analogRead(const uint8_t pin) { return pin < NUM_ANALOG_INPUTS ? HAL::analog_value[pin] : 0; }
+
+void analogWrite(const uint8_t pin, const int value) { HAL::analogWrite(pin, value); }
+
+void attachInterrupt(const uint8_t, void (*)(void), const int) {}
+
+void detachInterrupt(const uint8_t) {}
+
+long random(long howbig) { return howbig ? ::random() % howbig : 0; }
+
+long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : random(howbig - howsmall) + howsmall; }
+
+void randomSeed(unsigned long seed) { if (seed) srandom(seed); }
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+/**
+ * Host entry point, the loop returns after each pass (MK_MAIN_LOOP false)
+ */
+int main(int, char**) {
+  setup();
+  for (;;) loop();
+  return 0;
+}
+
+#endif // ARDUINO_ARCH_LINUX
@@ -0,0 +1,305 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * This is the main Hardware Abstraction Layer (HAL).
+ * To make the firmware work with different processors and toolchains,
+ * all hardware related code should be packed into the hal files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Description: HAL for native Linux host (simulation and benchmarking)
+ *
+ * The firmware core runs as a normal process. Hardware is replaced by:
+ *  - a virtual clock that drives the stepper timer and the 1ms tick,
+ *  - a virtual pin space with an optional step/dir pin log,
+ *  - a serial port on stdin/stdout.
+ *
+ * Time only advances from HAL::idletask() and from the stepper ISR
+ * busy waits, so two runs of the same G-code file are bit-identical.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * ARDUINO_ARCH_LINUX
+ */
+#pragma once
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <Arduino.h>
+
+// --------------------------------------------------------------------------
+// Types
+// --------------------------------------------------------------------------
+typedef uint32_t  hal_timer_t;
+typedef uintptr_t ptr_int_t;
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+#include "hardwareserial/HardwareSerial.h"
+#include "watchdog/watchdog.h"
+#include "fastio.h"
+#include "math.h"
+#include "HAL_timers.h"
+#include "delay.h"
+#include "pinlog.h"
+#include "simbed.h"
+
+// --------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------
+
+// do not use program space memory on host
+#define PROGMEM
+#ifndef PGM_P
+  #define PGM_P const char*
+#endif
+#undef PSTR
+#define PSTR(s) s
+#undef pgm_read_byte_near
+#define pgm_read_byte_near(x) (*(int8_t*)x)
+#undef pgm_read_byte
+#define pgm_read_byte(x) (*(int8_t*)x)
+#undef pgm_read_float
+#define pgm_read_float(addr) (*(const float *)(addr))
+#undef pgm_read_word
+#define pgm_read_word(addr) (*(addr))
+#undef pgm_read_dword
+#define pgm_read_dword(addr) (*(addr))
+#undef pgm_read_dword_near
+#define pgm_read_dword_near(addr) pgm_read_dword(addr)
+#undef pgm_read_ptr
+#define pgm_read_ptr(addr) (*(addr))
+#ifndef strncpy_P
+  #define strncpy_P strncpy
+#endif
+#ifndef strchr_P
+  #define strchr_P strchr
+#endif
+#ifndef vsnprintf_P
+  #define vsnprintf_P vsnprintf
+#endif
+#ifndef snprintf_P
+  #define snprintf_P snprintf
+#endif
+
+// SERIAL ports, stdin/stdout is always the first one
+#define MKSERIAL1 MKSerial1
+
+#if ENABLED(SERIAL_PORT_2) && SERIAL_PORT_2 >= -1
+  #define MKSERIAL2 MKSerial2
+#endif
+
+// CRITICAL SECTION, ISRs only run from the virtual clock so a flag is enough
+#define CRITICAL_SECTION_START()  const bool irqon = HAL_isr_enabled; HAL_isr_enabled = false
+#define CRITICAL_SECTION_END()    HAL_isr_enabled = irqon
+
+// ISR function
+#define ISRS_ENABLED()          HAL_isr_enabled
+#define ENABLE_ISRS()           (HAL_isr_enabled = true)
+#define DISABLE_ISRS()          (HAL_isr_enabled = false)
+
+// Idle task called from printer idle, advances the virtual clock
+#define HAL_IDLETASK
+
+// Voltage
+#define HAL_VOLTAGE_PIN 3.3
+
+// Reset reason
+#define RST_POWER_ON   1
+#define RST_EXTERNAL   2
+#define RST_BROWN_OUT  4
+#define RST_WATCHDOG   8
+#define RST_JTAG      16
+#define RST_SOFTWARE  32
+#define RST_BACKUP    64
+
+#define SPR0    0
+#define SPR1    1
+
+#define PACK    __attribute__ ((packed))
+
+// Macros for stepper.cpp
+#define HAL_MULTI_ACC(A,B)  MultiU32X24toH32(A,B)
+
+#define HAL_TIMER_TYPE_MAX  0xFFFFFFFF
+
+// TEMPERATURE
+#undef analogInputToDigitalPin
+#define analogInputToDigitalPin(p) ((p < 16) ? (p) + 54 : -1)
+#define ADC_TEMPERATURE_SENSOR  15
+// Bits of the ADC converter
+#define ANALOG_INPUT_BITS 12
+#define AD_RANGE          _BV(ANALOG_INPUT_BITS)
+#define ABS_ZERO        -273.15f
+#define NUM_ADC_SAMPLES   32
+#define AD595_MAX        330.0f
+#define AD8495_MAX       660.0f
+
+#define GET_PIN_MAP_PIN(index) index
+#define GET_PIN_MAP_INDEX(pin) pin
+#define PARSED_PIN_INDEX(code, dval) parser.intval(code, dval)
+
+// --------------------------------------------------------------------------
+// Public Variables
+// --------------------------------------------------------------------------
+
+// reset reason
+extern uint8_t MCUSR;
+
+// Virtual interrupt enable flag
+extern volatile bool HAL_isr_enabled;
+
+int freeMemory(void);
+
+// Host wall clock for the benchmarks, micros() follows the virtual timers
+uint32_t wall_micros();
+#define BENCHMARK_MICROS() wall_micros()
+
+char *dtostrf(double __val, signed char __width, unsigned char __prec, char *__s);
+
+typedef AveragingFilter<NUM_ADC_SAMPLES> ADCAveragingFilter;
+
+class HAL {
+
+  public: /** Constructor */
+
+    HAL();
+
+    virtual ~HAL();
+
+  public: /** Public Parameters */
+
+    // Value returned by the virtual ADC for every analog channel
+    static uint16_t analog_value[NUM_ANALOG_INPUTS];
+
+  public: /** Public Function */
+
+    static void analogStart();
+    static void AdcChangePin(const pin_t old_pin, const pin_t new_pin);
+
+    static void hwSetup(void);
+
+    static bool pwm_status(const pin_t pin);
+    static bool tc_status(const pin_t pin);
+
+    static void analogWrite(const pin_t pin, uint32_t ulValue, const uint16_t freq=1000U);
+
+    static void Tick();
+
+    static void idletask();
+
+    static int32_t analog2tempMCU(const int16_t adc_raw);
+
+    static pin_t digital_value_pin();
+    static pin_t analog_value_pin();
+
+    FORCE_INLINE static void pinMode(const pin_t pin, const uint8_t mode) {
+      switch (mode) {
+        case INPUT:         SET_INPUT(pin);         break;
+        case OUTPUT:        SET_OUTPUT(pin);        break;
+        case INPUT_PULLUP:  SET_INPUT_PULLUP(pin);  break;
+        case OUTPUT_LOW:    SET_OUTPUT(pin);        break;
+        case OUTPUT_HIGH:   SET_OUTPUT_HIGH(pin);   break;
+        default:                                    break;
+      }
+    }
+    FORCE_INLINE static void digitalWrite(const pin_t pin, const bool value) {
+      WRITE(pin, value);
+    }
+    FORCE_INLINE static bool digitalRead(const pin_t pin) {
+      return READ(pin);
+    }
+    FORCE_INLINE static void setInputPullup(const pin_t pin, const bool onoff) {
+      if (onoff) SET_INPUT_PULLUP(pin);
+      else SET_INPUT(pin);
+    }
+
+    FORCE_INLINE static void delayNanoseconds(const uint32_t delayNs) {
+      HAL_delay_cycles(delayNs * (CYCLES_PER_US) / 1000UL);
+    }
+    FORCE_INLINE static void delayMicroseconds(const uint32_t delayUs) {
+      HAL_delay_cycles(delayUs * (CYCLES_PER_US));
+    }
+    FORCE_INLINE static void delayMilliseconds(const uint16_t delayMs) {
+      delay(delayMs);
+    }
+    FORCE_INLINE static uint32_t timeInMilliseconds() {
+      return millis();
+    }
+
+    static void showStartReason();
+
+    static void resetHardware();
+
+    //
+    // SPI related functions, no SPI bus on host
+    //
+    static void spiBegin() {}
+    static void spiInit(uint8_t) {}
+    static void spiSend(uint8_t) {}
+    static void spiSend(const uint8_t*, size_t) {}
+    static void spiSend(uint32_t, uint8_t) {}
+    static void spiSend(uint32_t, const uint8_t*, size_t) {}
+    static uint8_t spiReceive(void) { return 0xFF; }
+    static uint8_t spiReceive(uint32_t) { return 0xFF; }
+    static void spiReadBlock(uint8_t* buf, uint16_t nbyte) { memset(buf, 0xFF, nbyte); }
+    static void spiSendBlock(uint8_t, const uint8_t*) {}
+
+};
+
+/**
+ * Public functions
+ */
+
+// Disable interrupts
+void cli(void);
+
+// Enable interrupts
+void sei(void);
+
+// Tone
+void tone(const pin_t _pin, const uint16_t frequency, const uint16_t duration=0);
+void noTone(const pin_t _pin);
+
+// EEPROM
+uint8_t eeprom_read_byte(uint8_t* pos);
+void eeprom_read_block(void* pos, const void* eeprom_address, size_t n);
+void eeprom_write_byte(uint8_t* pos, uint8_t value);
+void eeprom_update_block(const void* pos, void* eeprom_address, size_t n);
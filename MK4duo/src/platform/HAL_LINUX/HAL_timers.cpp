@@ -0,0 +1,188 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * This is the main Hardware Abstraction Layer (HAL).
+ * To make the firmware work with different processors and toolchains,
+ * all hardware related code should be packed into the hal files.
+ *
+ * Description: Virtual timers for native Linux host
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * ARDUINO_ARCH_LINUX
+ */
+
+#ifdef ARDUINO_ARCH_LINUX
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+#include "../../../MK4duo.h"
+#include "HAL_timers.h"
+
+// --------------------------------------------------------------------------
+// Externals
+// --------------------------------------------------------------------------
+extern void HAL_tone_isr();
+
+// --------------------------------------------------------------------------
+// Public Variables
+// --------------------------------------------------------------------------
+
+tTimerConfig TimerConfig[NUM_HARDWARE_TIMERS] = {
+  { false, 0, 0 },  // 0 - Stepper
+  { false, 0, 0 }   // 1 - Tone
+};
+
+uint64_t  HAL_clock               = 0;
+
+uint32_t  HAL_min_pulse_cycle     = 0,
+          HAL_pulse_high_tick     = 0,
+          HAL_pulse_low_tick      = 0,
+          HAL_frequency_limit[8]  = { 0 };
+
+// --------------------------------------------------------------------------
+// Private Variables
+// --------------------------------------------------------------------------
+static uint64_t next_systick  = HAL_TICKS_PER_MS;
+static bool     in_isr        = false;
+
+// --------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------
+
+static inline uint64_t timer_due(const uint8_t timer_num) {
+  const tTimerConfig &t = TimerConfig[timer_num];
+  return t.start + MAX(t.compare, 1U);
+}
+
+static void fire_timer(const uint8_t timer_num) {
+  // Counter is reset on compare match, like the Due TC in UP_RC mode
+  TimerConfig[timer_num].start = timer_due(timer_num);
+  if (timer_num == STEPPER_TIMER_NUM)
+    stepper.Step();
+  else
+    HAL_tone_isr();
+}
+
+// --------------------------------------------------------------------------
+// Public functions
+// --------------------------------------------------------------------------
+
+void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency/*=100*/) {
+  tTimerConfig &t = TimerConfig[timer_num];
+  t.start   = HAL_clock;
+  t.compare = (HAL_TIMER_RATE) / frequency;
+  t.enabled = true;
+}
+
+uint64_t HAL_clock_next_event() {
+  uint64_t next = next_systick;
+  for (uint8_t i = 0; i < NUM_HARDWARE_TIMERS; i++)
+    if (TimerConfig[i].enabled) NOMORE(next, timer_due(i));
+  return next;
+}
+
+void HAL_clock_run(const uint64_t target) {
+
+  // Timers can't preempt a running ISR or a critical section,
+  // they stay pending until the next run
+  if (in_isr || !HAL_isr_enabled) {
+    NOLESS(HAL_clock, target);
+    return;
+  }
+
+  for (;;) {
+    const uint64_t next = HAL_clock_next_event();
+    if (next > target) break;
+    NOLESS(HAL_clock, next);
+
+    in_isr = true;
+    HAL_isr_enabled = false;
+
+    if (next == next_systick) {
+      next_systick += HAL_TICKS_PER_MS;
+      HAL::Tick();
+    }
+    else {
+      for (uint8_t i = 0; i < NUM_HARDWARE_TIMERS; i++) {
+        if (TimerConfig[i].enabled && timer_due(i) == next) {
+          fire_timer(i);
+          break;
+        }
+      }
+    }
+
+    HAL_isr_enabled = true;
+    in_isr = false;
+  }
+
+  NOLESS(HAL_clock, target);
+
+}
+
+void HAL_clock_delay(const uint32_t ticks) {
+  HAL_clock_run(HAL_clock + ticks);
+}
+
+uint32_t HAL_isr_execuiton_cycle(const uint32_t rate) {
+  return (ISR_BASE_CYCLES + ISR_BEZIER_CYCLES + (ISR_LOOP_CYCLES) * rate + ISR_LA_BASE_CYCLES + ISR_LA_LOOP_CYCLES) / rate;
+}
+
+uint32_t HAL_ns_to_pulse_tick(const uint32_t ns) {
+ return (ns + STEPPER_TIMER_PULSE_TICK_NS / 2) / STEPPER_TIMER_PULSE_TICK_NS;
+}
+
+void HAL_calc_pulse_cycle() {
+
+  const uint32_t  HAL_min_step_period_ns = 1000000000UL / stepper.data.maximum_rate;
+  uint32_t        HAL_min_pulse_high_ns,
+                  HAL_min_pulse_low_ns;
+
+  HAL_min_pulse_cycle = MAX((uint32_t)((F_CPU) / stepper.data.maximum_rate), ((F_CPU) / 500000UL) * MAX((uint32_t)stepper.data.minimum_pulse, 1UL));
+
+  if (stepper.data.minimum_pulse) {
+    HAL_min_pulse_high_ns = uint32_t(stepper.data.minimum_pulse) * 1000UL;
+    HAL_min_pulse_low_ns  = MAX((HAL_min_step_period_ns - MIN(HAL_min_step_period_ns, HAL_min_pulse_high_ns)), HAL_min_pulse_high_ns);
+  }
+  else {
+    HAL_min_pulse_high_ns = 500000000UL / stepper.data.maximum_rate;
+    HAL_min_pulse_low_ns  = HAL_min_pulse_high_ns;
+  }
+
+  HAL_pulse_high_tick = uint32_t(HAL_ns_to_pulse_tick(HAL_min_pulse_high_ns - MIN(HAL_min_pulse_high_ns, (TIMER_SETUP_NS))));
+  HAL_pulse_low_tick  = uint32_t(HAL_ns_to_pulse_tick(HAL_min_pulse_low_ns - MIN(HAL_min_pulse_low_ns, (TIMER_SETUP_NS))));
+
+  // The stepping frequency limits for each multistepping rate
+  HAL_frequency_limit[0] = ((F_CPU) / HAL_isr_execuiton_cycle(1))       ;
+  HAL_frequency_limit[1] = ((F_CPU) / HAL_isr_execuiton_cycle(2))   >> 1;
+  HAL_frequency_limit[2] = ((F_CPU) / HAL_isr_execuiton_cycle(4))   >> 2;
+  HAL_frequency_limit[3] = ((F_CPU) / HAL_isr_execuiton_cycle(8))   >> 3;
+  HAL_frequency_limit[4] = ((F_CPU) / HAL_isr_execuiton_cycle(16))  >> 4;
+  HAL_frequency_limit[5] = ((F_CPU) / HAL_isr_execuiton_cycle(32))  >> 5;
+  HAL_frequency_limit[6] = ((F_CPU) / HAL_isr_execuiton_cycle(64))  >> 6;
+  HAL_frequency_limit[7] = ((F_CPU) / HAL_isr_execuiton_cycle(128)) >> 7;
+
+}
+
+#endif // ARDUINO_ARCH_LINUX
@@ -0,0 +1,214 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * This is the main Hardware Abstraction Layer (HAL).
+ * To make the firmware work with different processors and toolchains,
+ * all hardware related code should be packed into the hal files.
+ *
+ * Description: Virtual timers for native Linux host
+ *
+ * All timers count on a single 64 bit virtual clock running at
+ * HAL_TIMER_RATE. A timer fires when the clock reaches its start
+ * plus its compare value, like a SAM3X TC in UP_RC mode.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * ARDUINO_ARCH_LINUX
+ */
+#pragma once
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+#include <stdint.h>
+
+// --------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------
+#define NUM_HARDWARE_TIMERS 2
+
+// Tone
+#define TONE_TIMER_NUM              1
+
+#define HAL_TIMER_RATE              ((F_CPU) / 2) // 42 MHz, same as Due
+
+// Virtual clock ticks per ms, used for the system tick
+#define HAL_TICKS_PER_MS            ((HAL_TIMER_RATE) / 1000UL)
+
+// Stepper Timer
+#define STEPPER_TIMER_NUM           0
+#define STEPPER_TIMER_RATE          HAL_TIMER_RATE
+#define STEPPER_TIMER_TICKS_PER_US  ((STEPPER_TIMER_RATE) / 1000000UL)
+#define STEPPER_TIMER_PULSE_TICK_NS (1000000000UL / STEPPER_TIMER_RATE)
+#define STEPPER_TIMER_PRESCALE      2
+#define STEPPER_TIMER_MIN_INTERVAL  1                                                         // minimum time in µs between stepper interrupts
+#define STEPPER_TIMER_MAX_INTERVAL  (STEPPER_TIMER_TICKS_PER_US * STEPPER_TIMER_MIN_INTERVAL) // maximum time in µs between stepper interrupts
+#define STEPPER_CLOCK_RATE          ((F_CPU) / 128)
+
+#define START_STEPPER_INTERRUPT()   HAL_timer_start(STEPPER_TIMER_NUM)
+#define ENABLE_STEPPER_INTERRUPT()  HAL_timer_enable_interrupt(STEPPER_TIMER_NUM)
+#define DISABLE_STEPPER_INTERRUPT() HAL_timer_disable_interrupt(STEPPER_TIMER_NUM)
+#define STEPPER_ISR_ENABLED()       HAL_timer_interrupt_is_enabled(STEPPER_TIMER_NUM)
+
+// Estimate the amount of time the ISR will take to execute, same as Due
+#define TIMER_CYCLES                34UL
+
+// The base ISR takes 792 cycles
+#define ISR_BASE_CYCLES            792UL
+
+// Linear advance base time is 64 cycles
+#if HAS_LIN_ADVANCE_ISR
+  #define ISR_LA_BASE_CYCLES        64UL
+#else
+  #define ISR_LA_BASE_CYCLES         0UL
+#endif
+
+// Bezier interpolation adds 40 cycles, unless the segment buffer evaluates the curve out of the ISR
+#if ENABLED(BEZIER_JERK_CONTROL) && DISABLED(STEP_SEGMENT_BUFFER)
+  #define ISR_BEZIER_CYCLES         40UL
+#else
+  #define ISR_BEZIER_CYCLES          0UL
+#endif
+
+// Stepper Loop base cycles
+#define ISR_LOOP_BASE_CYCLES         4UL
+
+// And each stepper (start + stop pulse) takes in worst case
+#define ISR_STEPPER_CYCLES          16UL
+
+// For each stepper, we add its time
+#if HAS_X_STEP
+  #define ISR_X_STEPPER_CYCLES        ISR_STEPPER_CYCLES
+#else
+  #define ISR_X_STEPPER_CYCLES        0UL
+#endif
+#if HAS_Y_STEP
+  #define ISR_Y_STEPPER_CYCLES        ISR_STEPPER_CYCLES
+#else
+  #define ISR_Y_STEPPER_CYCLES        0UL
+#endif
+#if HAS_Z_STEP
+  #define ISR_Z_STEPPER_CYCLES        ISR_STEPPER_CYCLES
+#else
+  #define ISR_Z_STEPPER_CYCLES        0UL
+#endif
+
+// E is always interpolated
+#define ISR_E_STEPPER_CYCLES          ISR_STEPPER_CYCLES
+
+// If linear advance has no ISR of its own, then the loop also handles them
+#if !HAS_LIN_ADVANCE_ISR && ENABLED(COLOR_MIXING_EXTRUDER)
+  #define ISR_MIXING_STEPPER_CYCLES   ((MIXING_STEPPERS) * 16UL)
+#else
+  #define ISR_MIXING_STEPPER_CYCLES   0UL
+#endif
+
+// And the total minimum loop time is, without including the base
+#define MIN_ISR_LOOP_CYCLES           (ISR_X_STEPPER_CYCLES + ISR_Y_STEPPER_CYCLES + ISR_Z_STEPPER_CYCLES + ISR_E_STEPPER_CYCLES + ISR_MIXING_STEPPER_CYCLES)
+
+// But the user could be enforcing a minimum time, so the loop time is
+#define ISR_LOOP_CYCLES               (ISR_LOOP_BASE_CYCLES + MAX(HAL_min_pulse_cycle, MIN_ISR_LOOP_CYCLES))
+
+#define TIMER_SETUP_NS                (1000UL * TIMER_CYCLES / ((F_CPU) / 1000000UL))
+
+// If linear advance has its own ISR, then it is handled separately
+#if HAS_LIN_ADVANCE_ISR
+
+  // Estimate the minimum LA loop time
+  #if ENABLED(COLOR_MIXING_EXTRUDER)
+    #define MIN_ISR_LA_LOOP_CYCLES  ((MIXING_STEPPERS) * 16UL)
+  #else
+    #define MIN_ISR_LA_LOOP_CYCLES  16UL
+  #endif
+
+  // And the real loop time
+  #define ISR_LA_LOOP_CYCLES  MAX(HAL_min_pulse_cycle, MIN_ISR_LA_LOOP_CYCLES)
+
+#else
+  #define ISR_LA_LOOP_CYCLES  0UL
+#endif
+
+// --------------------------------------------------------------------------
+// Types
+// --------------------------------------------------------------------------
+
+typedef struct {
+  bool        enabled;
+  hal_timer_t compare;
+  uint64_t    start;
+} tTimerConfig;
+
+// --------------------------------------------------------------------------
+// Public Variables
+// --------------------------------------------------------------------------
+
+extern tTimerConfig TimerConfig[];
+
+extern uint64_t HAL_clock;
+
+extern uint32_t HAL_min_pulse_cycle,
+                HAL_pulse_high_tick,
+                HAL_pulse_low_tick,
+                HAL_frequency_limit[8];
+
+// --------------------------------------------------------------------------
+// Public functions
+// --------------------------------------------------------------------------
+
+void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency=100);
+
+void HAL_calc_pulse_cycle();
+
+// Run the virtual clock up to target, firing every timer due on the way
+void HAL_clock_run(const uint64_t target);
+
+// Time spent busy on the CPU, fires timers only outside of ISRs
+void HAL_clock_delay(const uint32_t ticks);
+
+// Next virtual time a timer is due
+uint64_t HAL_clock_next_event();
+
+FORCE_INLINE static void HAL_timer_enable_interrupt(const uint8_t timer_num) {
+  TimerConfig[timer_num].enabled = true;
+}
+
+FORCE_INLINE static void HAL_timer_disable_interrupt(const uint8_t timer_num) {
+  TimerConfig[timer_num].enabled = false;
+}
+
+FORCE_INLINE static bool HAL_timer_interrupt_is_enabled(const uint8_t timer_num) {
+  return TimerConfig[timer_num].enabled;
+}
+
+FORCE_INLINE static void HAL_timer_set_count(const uint8_t timer_num, const uint32_t count) {
+  TimerConfig[timer_num].compare = count;
+}
+
+// Every read of the counter costs one tick, so busy waits on it always end
+FORCE_INLINE static uint32_t HAL_timer_get_current_count(const uint8_t timer_num) {
+  return uint32_t(HAL_clock++ - TimerConfig[timer_num].start);
+}
+
+FORCE_INLINE static void HAL_timer_isr_prologue(const uint8_t timer_num) {
+  UNUSED(timer_num);
+}
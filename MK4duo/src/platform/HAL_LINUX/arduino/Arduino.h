@@ -0,0 +1,108 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Arduino.h
+ *
+ * Minimal Arduino core API for the native Linux host build.
+ * Only what the firmware core really uses is provided here, everything
+ * time related is routed to the virtual clock of HAL_LINUX.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <avr/pgmspace.h>
+
+#ifndef F_CPU
+  #define F_CPU 84000000UL
+#endif
+
+#define ARDUINO 10812
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define LOW           0
+#define HIGH          1
+
+#define INPUT         0x0
+#define OUTPUT        0x1
+#define INPUT_PULLUP  0x2
+
+#define PI            3.1415926535897932384626433832795
+#define HALF_PI       1.5707963267948966192313216916398
+#define TWO_PI        6.283185307179586476925286766559
+#define DEG_TO_RAD    0.017453292519943295769236907684886
+#define RAD_TO_DEG    57.295779513082320876798154814105
+
+#ifndef _BV
+  #define _BV(b) (1UL << (b))
+#endif
+
+#define radians(deg)  ((deg)*DEG_TO_RAD)
+#define degrees(rad)  ((rad)*RAD_TO_DEG)
+#define sq(x)         ((x)*(x))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+#define lowByte(w)    ((uint8_t) ((w) & 0xFF))
+#define highByte(w)   ((uint8_t) ((w) >> 8))
+
+#define bitRead(value, bit)   (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit)    ((value) |= (1UL << (bit)))
+#define bitClear(value, bit)  ((value) &= ~(1UL << (bit)))
+
+#define digitalPinToInterrupt(p)  (p)
+#define NOT_AN_INTERRUPT          -1
+#define CHANGE                    1
+
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(const uint32_t ms);
+void delayMicroseconds(const uint32_t us);
+
+void pinMode(const uint8_t pin, const uint8_t mode);
+void digitalWrite(const uint8_t pin, const uint8_t value);
+int digitalRead(const uint8_t pin);
+int analogRead(const uint8_t pin);
+void analogWrite(const uint8_t pin, const int value);
+
+void attachInterrupt(const uint8_t irq, void (*userFunc)(void), const int mode);
+void detachInterrupt(const uint8_t irq);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+inline bool isDigit(const int c) { return isdigit(c); }
+
+void setup(void);
+void loop(void);
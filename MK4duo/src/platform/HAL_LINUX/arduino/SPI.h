@@ -0,0 +1,62 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * SPI.h
+ *
+ * No SPI bus on the native Linux host build, transfers are discarded.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+#define MSBFIRST  1
+#define LSBFIRST  0
+
+class SPISettings {
+  public:
+    SPISettings() {}
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+  public:
+    static void begin() {}
+    static void end() {}
+    static void beginTransaction(const SPISettings&) {}
+    static void endTransaction() {}
+    static uint8_t transfer(const uint8_t) { return 0xFF; }
+    static uint16_t transfer16(const uint16_t) { return 0xFFFF; }
+    static void transfer(void*, size_t) {}
+    static void setBitOrder(uint8_t) {}
+    static void setDataMode(uint8_t) {}
+    static void setClockDivider(uint8_t) {}
+};
+
+extern SPIClass SPI;
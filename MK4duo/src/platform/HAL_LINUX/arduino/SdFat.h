@@ -0,0 +1,255 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * SdFat.h
+ *
+ * SD card for the native Linux host build.
+ * When the environment variable MK4DUO_SD is set the card is mounted and
+ * its files are the files of that directory, subdirectories included.
+ * Without it there is no card. The raw block access and the directory
+ * entries are not there, so the card info fails and auto#.g never starts.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SD_FAT_VERSION      10101
+
+#define O_READ              0x01
+#define O_RDONLY            O_READ
+#define O_WRITE             0x02
+#define O_WRONLY            O_WRITE
+#define O_RDWR              (O_READ | O_WRITE)
+#define O_APPEND            0x04
+#define O_SYNC              0x08
+#define O_TRUNC             0x10
+#define O_AT_END            0x20
+#define O_CREAT             0x40
+#define O_EXCL              0x80
+#define FILE_WRITE          (O_RDWR | O_CREAT | O_AT_END)
+
+#define SD_CARD_TYPE_SD1    1
+#define SD_CARD_TYPE_SD2    2
+#define SD_CARD_TYPE_SDHC   3
+
+#define SPI_FULL_SPEED      0
+#define SPI_HALF_SPEED      1
+#define SPI_QUARTER_SPEED   2
+#define SPI_EIGHTH_SPEED    3
+#define SPI_SIXTEENTH_SPEED 4
+
+#define SD_PATH_LENGTH      512
+
+struct dir_t { uint8_t name[11]; uint8_t attributes; uint32_t fileSize; };
+union cache_t { uint8_t data[512]; };
+struct cid_t { uint8_t mid; char oid[2]; char pnm[5]; uint8_t prv; uint32_t psn; };
+struct csd_t { uint8_t data[16]; };
+
+class Sd2Card {
+
+  public: /** Public Function */
+
+    bool begin(const uint8_t=0, const uint8_t=0) { return getenv("MK4DUO_SD") != nullptr; }
+    uint8_t errorCode() { return getenv("MK4DUO_SD") ? 0 : 1; }
+    uint8_t errorData() { return 0; }
+    uint8_t type() { return SD_CARD_TYPE_SDHC; }
+    uint32_t cardSize() { return 0; }
+    bool readCID(cid_t*) { return false; }
+    bool readCSD(csd_t*) { return false; }
+    bool readBlock(const uint32_t, uint8_t*) { return false; }
+    bool writeBlock(const uint32_t, const uint8_t*) { return false; }
+    bool writeStart(const uint32_t, const uint32_t) { return false; }
+    bool writeData(const uint8_t*) { return false; }
+    bool writeStop() { return false; }
+    bool erase(const uint32_t, const uint32_t) { return false; }
+
+};
+
+class SdVolume {
+
+  public: /** Public Function */
+
+    uint8_t fatType() { return 32; }
+    uint8_t blocksPerCluster() { return 8; }
+    uint32_t clusterCount() { return 0; }
+    int32_t freeClusterCount() { return 0; }
+
+};
+
+class FatFile {
+
+  private: /** Private Parameters */
+
+    FILE  *file = nullptr;
+    DIR   *dir  = nullptr;
+    char  path[SD_PATH_LENGTH] = "";
+
+  public: /** Public Function */
+
+    static const char* root() {
+      const char * const sd = getenv("MK4DUO_SD");
+      return sd ? sd : ".";
+    }
+
+    bool open(const char * const name, const uint8_t flags=O_READ) {
+      char full[SD_PATH_LENGTH];
+      snprintf(full, sizeof(full), "%s/%s", root(), name);
+      return open_path(full, flags);
+    }
+
+    bool open(FatFile * const parent, const char * const name, const uint8_t flags=O_READ) {
+      char full[SD_PATH_LENGTH];
+      snprintf(full, sizeof(full), "%s/%s", parent && parent->dir ? parent->path : root(), name);
+      return open_path(full, flags);
+    }
+
+    bool openRoot(SdVolume*) { return open_path(root(), O_READ); }
+
+    bool openNext(FatFile * const parent, const uint8_t=O_READ) {
+      if (!parent->dir) return false;
+      while (struct dirent * const entry = readdir(parent->dir)) {
+        if (!strcmp(entry->d_name, ".")) continue;
+        char full[SD_PATH_LENGTH];
+        snprintf(full, sizeof(full), "%s/%s", parent->path, entry->d_name);
+        return open_path(full, O_READ);
+      }
+      return false;
+    }
+
+    int8_t readDir(dir_t*, char*) { return 0; }
+
+    bool close() {
+      if (file) fclose(file);
+      if (dir) closedir(dir);
+      file = nullptr;
+      dir = nullptr;
+      return true;
+    }
+
+    bool isOpen()   const { return file || dir; }
+    bool isFile()   const { return file; }
+    bool isDir()    const { return dir; }
+    bool isSubDir() const { return dir; }
+    bool isHidden() const { return false; }
+
+    bool getName(char * const name, const size_t size) {
+      const char * const base = strrchr(path, '/');
+      strncpy(name, base ? base + 1 : path, size);
+      name[size - 1] = '\0';
+      return true;
+    }
+
+    uint32_t fileSize() {
+      struct stat st;
+      return file && !fstat(fileno(file), &st) ? st.st_size : 0;
+    }
+    uint32_t curPosition() { return file ? ftell(file) : 0; }
+
+    int16_t read() { return file ? fgetc(file) : -1; }
+    int16_t read(void * const buf, const size_t count) { return file ? fread(buf, 1, count, file) : -1; }
+    int16_t fgets(char * const str, const int16_t num, char* =nullptr) {
+      return file && ::fgets(str, num, file) ? strlen(str) : -1;
+    }
+
+    size_t write(const void * const buf, const size_t count) { return file ? fwrite(buf, 1, count, file) : 0; }
+    size_t write(const char * const str) { return write(str, strlen(str)); }
+    size_t write(const uint8_t c) { return write(&c, 1); }
+
+    bool seekSet(const uint32_t pos) { return file && !fseek(file, pos, SEEK_SET); }
+    bool seekEnd(const int32_t offset=0) { return file && !fseek(file, offset, SEEK_END); }
+    void rewind() {
+      if (file) ::rewind(file);
+      if (dir) rewinddir(dir);
+    }
+    bool sync() { return file && !fflush(file); }
+
+    bool remove(FatFile * const parent, const char * const name) {
+      char full[SD_PATH_LENGTH];
+      snprintf(full, sizeof(full), "%s/%s", parent && parent->dir ? parent->path : root(), name);
+      return !::remove(full);
+    }
+
+    uint8_t getError() { return 0; }
+    bool getWriteError() { return file && ferror(file); }
+    void clearWriteError() { if (file) clearerr(file); }
+
+  private: /** Private Function */
+
+    bool open_path(const char * const full, const uint8_t flags) {
+      close();
+      strncpy(path, full, sizeof(path) - 1);
+      struct stat st;
+      const bool exists = !stat(full, &st);
+      if (exists && S_ISDIR(st.st_mode)) return (dir = opendir(full));
+      if (!(flags & O_WRITE)) return exists && (file = fopen(full, "rb"));
+      if (exists && (flags & O_EXCL)) return false;
+      if (!exists && !(flags & O_CREAT)) return false;
+      if (!(file = fopen(full, exists && !(flags & O_TRUNC) ? "r+b" : "w+b"))) return false;
+      if (flags & (O_AT_END | O_APPEND)) fseek(file, 0, SEEK_END);
+      return true;
+    }
+
+};
+
+class SdFile : public FatFile {};
+
+class SdFat {
+
+  private: /** Private Parameters */
+
+    Sd2Card   sd;
+    SdVolume  volume;
+    SdFile    cwd;
+
+  public: /** Public Function */
+
+    bool begin(const uint8_t cs=0, const uint8_t speed=0) { return sd.begin(cs, speed) && cwd.openRoot(&volume); }
+
+    Sd2Card* card() { return &sd; }
+    SdVolume* vol() { return &volume; }
+    FatFile* vwd() { return &cwd; }
+
+    bool chdir(const bool=true) { return cwd.openRoot(&volume); }
+    bool chdir(const char * const name, const bool=true) { return cwd.open(name); }
+
+    bool remove(const char * const name) { return cwd.remove(&cwd, name); }
+    bool rmdir(const char * const name) { return !::rmdir(full(name)); }
+    bool mkdir(const char * const name, const bool=true) { return !::mkdir(full(name), 0755); }
+
+  private: /** Private Function */
+
+    const char* full(const char * const name) {
+      static char buf[SD_PATH_LENGTH];
+      snprintf(buf, sizeof(buf), "%s/%s", FatFile::root(), name);
+      return buf;
+    }
+
+};
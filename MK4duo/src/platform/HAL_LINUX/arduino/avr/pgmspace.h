@@ -0,0 +1,62 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * avr/pgmspace.h
+ *
+ * Program space is plain memory on host, as on the Arduino Due core.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+#pragma once
+
+#include <string.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P                     const char*
+#define PSTR(s)                   (s)
+
+#define pgm_read_byte(addr)       (*(const unsigned char *)(addr))
+#define pgm_read_word(addr)       (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr)      (*(const unsigned long *)(addr))
+#define pgm_read_float(addr)      (*(const float *)(addr))
+#define pgm_read_ptr(addr)        (*(void * const *)(addr))
+
+#define pgm_read_byte_near(addr)  pgm_read_byte(addr)
+#define pgm_read_word_near(addr)  pgm_read_word(addr)
+#define pgm_read_dword_near(addr) pgm_read_dword(addr)
+
+#define strcpy_P    strcpy
+#define strncpy_P   strncpy
+#define strcat_P    strcat
+#define strcmp_P    strcmp
+#define strncmp_P   strncmp
+#define strcasecmp_P strcasecmp
+#define strchr_P    strchr
+#define strrchr_P   strrchr
+#define strstr_P    strstr
+#define strlen_P    strlen
+#define memcpy_P    memcpy
+#define sprintf_P   sprintf
+#define snprintf_P  snprintf
+#define vsnprintf_P vsnprintf
@@ -0,0 +1,117 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Description: Fast IO functions for native Linux host
+ *
+ * Pins are plain bytes in a virtual pin space. Every write goes
+ * through the pin log so step and dir edges can be recorded with
+ * their virtual time stamp.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+// **************************************************************************
+//
+// Description: Fast IO functions for native Linux host
+//
+// ARDUINO_ARCH_LINUX
+// **************************************************************************
+
+/**
+ * ports and functions
+ */
+
+// UART
+#define RXD (0u)
+#define TXD (1u)
+
+/**
+ * utility functions
+ */
+
+#ifndef MASK
+  #define MASK(PIN) (1 << PIN)
+#endif
+
+#define OUTPUT_LOW  0x3
+#define OUTPUT_HIGH 0x4
+
+/**
+ * Virtual pin state
+ */
+extern uint8_t  HAL_pin_value[NUM_DIGITAL_PINS],
+                HAL_pin_mode[NUM_DIGITAL_PINS];
+
+void HAL_pin_changed(const pin_t pin, const bool flag);
+
+/**
+ * magic I/O routines
+ * now you can simply SET_OUTPUT(STEP); WRITE(STEP, 1); WRITE(STEP, 0);
+ */
+
+FORCE_INLINE static bool READ(const pin_t pin) {
+  return HAL_pin_value[uint8_t(pin)];
+}
+
+FORCE_INLINE static void WRITE(const pin_t pin, const bool flag) {
+  if (HAL_pin_value[uint8_t(pin)] != flag) {
+    HAL_pin_value[uint8_t(pin)] = flag;
+    HAL_pin_changed(pin, flag);
+  }
+}
+
+FORCE_INLINE static void TOGGLE(const pin_t pin) {
+  WRITE(pin, !READ(pin));
+}
+
+FORCE_INLINE static void SET_INPUT(const pin_t pin) {
+  HAL_pin_mode[uint8_t(pin)] = INPUT;
+}
+
+FORCE_INLINE static void SET_INPUT_PULLUP(const pin_t pin) {
+  HAL_pin_mode[uint8_t(pin)] = INPUT_PULLUP;
+  HAL_pin_value[uint8_t(pin)] = HIGH;
+}
+
+FORCE_INLINE static void SET_OUTPUT(const pin_t pin) {
+  HAL_pin_mode[uint8_t(pin)] = OUTPUT;
+  WRITE(pin, LOW);
+}
+
+FORCE_INLINE static void SET_OUTPUT_HIGH(const pin_t pin) {
+  HAL_pin_mode[uint8_t(pin)] = OUTPUT;
+  WRITE(pin, HIGH);
+}
+
+FORCE_INLINE static void OUT_WRITE(const pin_t pin, const uint8_t flag) {
+  if (flag)
+    SET_OUTPUT_HIGH(pin);
+  else
+    SET_OUTPUT(pin);
+}
+
+FORCE_INLINE static bool USEABLE_HARDWARE_PWM(const pin_t pin) {
+  UNUSED(pin);
+  return true;
+}
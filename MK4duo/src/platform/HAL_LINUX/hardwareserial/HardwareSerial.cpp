@@ -0,0 +1,241 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HardwareSerial.cpp - stdin/stdout serial port for native Linux host
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#ifdef ARDUINO_ARCH_LINUX
+
+#include "../../../../MK4duo.h"
+#include <unistd.h>
+#include <poll.h>
+
+/** Protected Parameters */
+template<typename Cfg> typename MKHardwareSerial<Cfg>::ring_buffer_r MKHardwareSerial<Cfg>::rx_buffer = { 0, 0, { 0 } };
+template<typename Cfg> bool MKHardwareSerial<Cfg>::interactive  = false;
+template<typename Cfg> bool MKHardwareSerial<Cfg>::end_of_input = true;
+
+/** Protected Function */
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::fill_rx_buffer() {
+
+  static EmergencyStateEnum emergency_state; // = EP_RESET
+
+  if (end_of_input) return;
+
+  if (interactive) {
+    struct pollfd pfd = { STDIN_FILENO, POLLIN, 0 };
+    if (poll(&pfd, 1, 0) <= 0) return;
+  }
+  else
+    fflush(stdout); // The host may be waiting for an ok before sending more
+
+  // Read only into the contiguous free space, the head never reaches the tail
+  const ring_buffer_pos_t h = rx_buffer.head, t = rx_buffer.tail;
+  const size_t room = (t > h) ? (t - h - 1) : (Cfg::RX_SIZE - h - (t == 0 ? 1 : 0));
+  if (!room) return;
+
+  const ssize_t n = ::read(STDIN_FILENO, &rx_buffer.buffer[h], room);
+  if (n <= 0) {
+    end_of_input = true;
+    return;
+  }
+
+  for (ssize_t i = 0; i < n; i++) {
+    const uint8_t c = rx_buffer.buffer[h + i];
+    if (Cfg::EMERGENCYPARSER) emergency_parser.update(emergency_state, c);
+    UNUSED(c);
+  }
+
+  rx_buffer.head = (ring_buffer_pos_t)((h + n) % Cfg::RX_SIZE);
+
+}
+
+/** Public Function */
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::begin(const long) {
+  if (Cfg::PORT == 0) {
+    interactive = isatty(STDIN_FILENO);
+    end_of_input = false;
+  }
+  rx_buffer.head = rx_buffer.tail = 0;
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::end() {
+  flushTX();
+  end_of_input = true;
+}
+
+template<typename Cfg>
+int MKHardwareSerial<Cfg>::peek(void) {
+  if (rx_buffer.head == rx_buffer.tail) fill_rx_buffer();
+  return rx_buffer.head == rx_buffer.tail ? -1 : rx_buffer.buffer[rx_buffer.tail];
+}
+
+template<typename Cfg>
+int MKHardwareSerial<Cfg>::read(void) {
+  if (rx_buffer.head == rx_buffer.tail) fill_rx_buffer();
+  if (rx_buffer.head == rx_buffer.tail) return -1;
+  const int v = rx_buffer.buffer[rx_buffer.tail];
+  rx_buffer.tail = (ring_buffer_pos_t)((rx_buffer.tail + 1) % Cfg::RX_SIZE);
+  return v;
+}
+
+template<typename Cfg>
+typename MKHardwareSerial<Cfg>::ring_buffer_pos_t MKHardwareSerial<Cfg>::available(void) {
+  if (rx_buffer.head == rx_buffer.tail) fill_rx_buffer();
+  return (ring_buffer_pos_t)(Cfg::RX_SIZE + rx_buffer.head - rx_buffer.tail) % Cfg::RX_SIZE;
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::flush(void) {
+  rx_buffer.head = rx_buffer.tail = 0;
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::write(const uint8_t c) {
+  if (Cfg::PORT != 0) return;
+  putchar(c);
+  if (interactive && c == '\n') fflush(stdout);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::flushTX(void) {
+  if (Cfg::PORT == 0) fflush(stdout);
+}
+
+/**
+ * Imports from print.h
+ */
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(char c, int base) {
+  print((long)c, base);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(unsigned char b, int base) {
+  print((unsigned long)b, base);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(int n, int base) {
+  print((long)n, base);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(unsigned int n, int base) {
+  print((unsigned long)n, base);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(long n, int base) {
+  if (base == 0) write(n);
+  else if (base == 10) {
+    if (n < 0) { print('-'); n = -n; }
+    printNumber(n, 10);
+  }
+  else
+    printNumber(n, base);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(unsigned long n, int base) {
+  if (base == 0) write(n);
+  else printNumber(n, base);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::print(double n, int digits) {
+  printFloat(n, digits);
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::println(void) {
+  print('\r');
+  print('\n');
+}
+
+/** Private Function */
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::printNumber(unsigned long n, uint8_t base) {
+
+  if (n) {
+    unsigned char buf[8 * sizeof(long)]; // Enough space for base 2
+    int8_t i = 0;
+    while (n) {
+      buf[i++] = n % base;
+      n /= base;
+    }
+    while (i--)
+      print((char)(buf[i] + (buf[i] < 10 ? '0' : 'A' - 10)));
+  }
+  else
+    print('0');
+
+}
+
+template<typename Cfg>
+void MKHardwareSerial<Cfg>::printFloat(double number, uint8_t digits) {
+
+  // Handle negative numbers
+  if (number < 0.0) {
+    print('-');
+    number = -number;
+  }
+
+  // Round correctly so that print(1.999, 2) prints as "2.00"
+  double rounding = 0.5;
+  for (uint8_t i = 0; i < digits; ++i) rounding *= 0.1;
+  number += rounding;
+
+  // Extract the integer part of the number and print it
+  unsigned long int_part = (unsigned long)number;
+  double remainder = number - (double)int_part;
+  print(int_part);
+
+  // Print the decimal point, but only if there are digits beyond
+  if (digits) {
+    print('.');
+    // Extract digits from the remainder one at a time
+    while (digits--) {
+      remainder *= 10.0;
+      int toPrint = int(remainder);
+      print(toPrint);
+      remainder -= toPrint;
+    }
+  }
+
+}
+
+// Instantiate Class
+template class MKHardwareSerial<MK4duoSerialHostCfg<0>>;
+MKHardwareSerial<MK4duoSerialHostCfg<0>> MKSerial1;
+
+#if ENABLED(SERIAL_PORT_2) && SERIAL_PORT_2 >= -1
+  template class MKHardwareSerial<MK4duoSerialHostCfg<1>>;
+  MKHardwareSerial<MK4duoSerialHostCfg<1>> MKSerial2;
+#endif
+
+#endif // ARDUINO_ARCH_LINUX
@@ -0,0 +1,109 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * HardwareSerial for native Linux host
+ *
+ * Port 0 reads stdin and writes stdout, any other port has no input
+ * and drops its output.
+ *
+ * When stdin is a file or a pipe reads are blocking, so a run never
+ * depends on how fast the input arrives. On a terminal reads are polled
+ * and the firmware keeps running while waiting for input.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+template<typename Cfg>
+class MKHardwareSerial {
+
+  public: /** Constructor */
+
+    MKHardwareSerial() {}
+
+  protected: /** Protected Parameters */
+
+    // Base size of type on buffer size
+    typedef typename TypeSelector<(Cfg::RX_SIZE>256), uint16_t, uint8_t>::type ring_buffer_pos_t;
+
+    struct ring_buffer_r {
+      ring_buffer_pos_t head, tail;
+      unsigned char buffer[Cfg::RX_SIZE];
+    };
+
+    static ring_buffer_r rx_buffer;
+
+    static bool interactive,
+                end_of_input;
+
+  protected: /** Protected Function */
+
+    static void fill_rx_buffer();
+
+  public: /** Public Function */
+
+    static void begin(const long);
+    static void end();
+    static int peek(void);
+    static int read(void);
+    static void flush(void);
+    static ring_buffer_pos_t available(void);
+    static void write(const uint8_t c);
+    static void flushTX(void);
+
+    // True once stdin is closed and every received byte has been read
+    FORCE_INLINE static bool eof() { return end_of_input && rx_buffer.head == rx_buffer.tail; }
+
+    FORCE_INLINE static uint8_t dropped() { return 0; }
+    FORCE_INLINE static uint8_t buffer_overruns() { return 0; }
+    FORCE_INLINE static uint8_t framing_errors() { return 0; }
+    FORCE_INLINE static ring_buffer_pos_t rxMaxEnqueued() { return 0; }
+
+    FORCE_INLINE static void write(const char* str) { while (*str) write(*str++); }
+    FORCE_INLINE static void write(const uint8_t* buffer, size_t size) { while (size--) write(*buffer++); }
+    FORCE_INLINE static void print(const char* str) { write(str); }
+
+    static void print(char, int=BYTE);
+    static void print(unsigned char, int=DEC);
+    static void print(int, int=DEC);
+    static void print(unsigned int, int=DEC);
+    static void print(long, int=DEC);
+    static void print(unsigned long, int=DEC);
+    static void print(double, int=2);
+
+    static void println(void);
+
+    operator bool() { return true; }
+
+  private: /** Private Function */
+
+    static void printNumber(unsigned long, const uint8_t);
+    static void printFloat(double, uint8_t);
+
+};
+
+extern MKHardwareSerial<MK4duoSerialHostCfg<0>> MKSerial1;
+
+#if ENABLED(SERIAL_PORT_2) && SERIAL_PORT_2 >= -1
+  extern MKHardwareSerial<MK4duoSerialHostCfg<1>> MKSerial2;
+#endif
@@ -0,0 +1,129 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef ARDUINO_ARCH_LINUX
+
+#include "../../../MK4duo.h"
+
+#if HAS_EEPROM
+
+MemoryStore memorystore;
+
+/** Public Parameters */
+#if HAS_EEPROM_SD
+  char MemoryStore::eeprom_data[EEPROM_SIZE];
+#endif
+
+/**
+ * The EEPROM is a RAM image, loaded from and saved to the file
+ * named by MK4DUO_EEPROM when set. Without it every run starts
+ * from the firmware defaults, what a benchmark usually wants.
+ */
+static uint8_t eeprom_image[EEPROM_SIZE + 1];
+
+static const char* eeprom_file() { return getenv("MK4DUO_EEPROM"); }
+
+/** Public Function */
+bool MemoryStore::access_start() {
+  static bool loaded = false;
+  if (!loaded) {
+    loaded = true;
+    memset(eeprom_image, 0xFF, sizeof(eeprom_image));
+    const char * const name = eeprom_file();
+    if (name) {
+      FILE * const fp = fopen(name, "rb");
+      if (fp) {
+        if (fread(eeprom_image, 1, sizeof(eeprom_image), fp)) { /* nada */ }
+        fclose(fp);
+      }
+    }
+  }
+  return false;
+}
+
+bool MemoryStore::access_write() {
+  #if HAS_EEPROM_SD
+    card.write_eeprom();
+  #else
+    const char * const name = eeprom_file();
+    if (name) {
+      FILE * const fp = fopen(name, "wb");
+      if (!fp) return true;
+      fwrite(eeprom_image, 1, sizeof(eeprom_image), fp);
+      fclose(fp);
+    }
+  #endif
+  return false;
+}
+
+bool MemoryStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+
+  while (size--) {
+    uint8_t v = *value;
+    #if HAS_EEPROM_SD
+      eeprom_data[pos] = v;
+    #else
+      eeprom_image[pos] = v;
+    #endif
+    crc16(crc, &v, 1);
+    pos++;
+    value++;
+  };
+
+  return false;
+}
+
+bool MemoryStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+
+  while (size--) {
+    #if HAS_EEPROM_SD
+      uint8_t c = eeprom_data[pos];
+    #else
+      uint8_t c = eeprom_image[pos];
+    #endif
+    if (writing) *value = c;
+    crc16(crc, &c, 1);
+    pos++;
+    value++;
+  };
+
+  return false;
+}
+
+size_t MemoryStore::capacity() { return EEPROM_SIZE + 1; }
+
+/** EEPROM access for code that works on addresses */
+uint8_t eeprom_read_byte(uint8_t* pos) { return eeprom_image[ptr_int_t(pos)]; }
+
+void eeprom_read_block(void* pos, const void* eeprom_address, size_t n) {
+  memcpy(pos, &eeprom_image[ptr_int_t(eeprom_address)], n);
+}
+
+void eeprom_write_byte(uint8_t* pos, uint8_t value) { eeprom_image[ptr_int_t(pos)] = value; }
+
+void eeprom_update_block(const void* pos, void* eeprom_address, size_t n) {
+  memcpy(&eeprom_image[ptr_int_t(eeprom_address)], pos, n);
+}
+
+#endif // HAS_EEPROM
+
+#endif // ARDUINO_ARCH_LINUX
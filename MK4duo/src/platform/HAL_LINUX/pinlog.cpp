@@ -0,0 +1,179 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * pinlog.cpp
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#ifdef ARDUINO_ARCH_LINUX
+
+#include "../../../MK4duo.h"
+
+PinLog pinlog;
+
+// Channels are step pins at 2*n and dir pins at 2*n+1
+static const char * const channel_name[] = {
+  "XS", "XD", "YS", "YD", "ZS", "ZD",
+  "E0S", "E0D", "E1S", "E1D", "E2S", "E2D",
+  "E3S", "E3D", "E4S", "E4D", "E5S", "E5D"
+};
+
+/** Private Parameters */
+FILE*     PinLog::file                        = nullptr;
+int8_t    PinLog::channel[NUM_DIGITAL_PINS]   = { 0 };
+uint32_t  PinLog::steps[XYZ + 6]              = { 0 };
+bool      PinLog::dir[XYZ + 6]                = { false };
+int32_t   PinLog::position[XYZ + 6]           = { 0 },
+          PinLog::low[XYZ + 6]                = { 0 },
+          PinLog::high[XYZ + 6]               = { 0 };
+uint64_t  PinLog::window_start[XYZ + 6]       = { 0 };
+uint16_t  PinLog::window_steps[XYZ + 6]       = { 0 },
+          PinLog::peak_steps[XYZ + 6]         = { 0 };
+
+/** Virtual pin state */
+uint8_t   HAL_pin_value[NUM_DIGITAL_PINS]     = { 0 },
+          HAL_pin_mode[NUM_DIGITAL_PINS]      = { 0 };
+
+void HAL_pin_changed(const pin_t pin, const bool flag) {
+  if (pinlog.change(pin, flag)) simbed.update();
+}
+
+/** Public Function */
+void PinLog::init() {
+
+  for (uint8_t p = 0; p < NUM_DIGITAL_PINS; p++) channel[p] = -1;
+
+  #if HAS_X_STEP
+    add(X_STEP_PIN, 0);
+  #endif
+  #if HAS_X_DIR
+    add(X_DIR_PIN, 1);
+  #endif
+  #if HAS_Y_STEP
+    add(Y_STEP_PIN, 2);
+  #endif
+  #if HAS_Y_DIR
+    add(Y_DIR_PIN, 3);
+  #endif
+  #if HAS_Z_STEP
+    add(Z_STEP_PIN, 4);
+  #endif
+  #if HAS_Z_DIR
+    add(Z_DIR_PIN, 5);
+  #endif
+  #if HAS_E0_STEP
+    add(E0_STEP_PIN, 6);
+  #endif
+  #if HAS_E0_DIR
+    add(E0_DIR_PIN, 7);
+  #endif
+  #if HAS_E1_STEP
+    add(E1_STEP_PIN, 8);
+  #endif
+  #if HAS_E1_DIR
+    add(E1_DIR_PIN, 9);
+  #endif
+  #if HAS_E2_STEP
+    add(E2_STEP_PIN, 10);
+  #endif
+  #if HAS_E2_DIR
+    add(E2_DIR_PIN, 11);
+  #endif
+  #if HAS_E3_STEP
+    add(E3_STEP_PIN, 12);
+  #endif
+  #if HAS_E3_DIR
+    add(E3_DIR_PIN, 13);
+  #endif
+  #if HAS_E4_STEP
+    add(E4_STEP_PIN, 14);
+  #endif
+  #if HAS_E4_DIR
+    add(E4_DIR_PIN, 15);
+  #endif
+  #if HAS_E5_STEP
+    add(E5_STEP_PIN, 16);
+  #endif
+  #if HAS_E5_DIR
+    add(E5_DIR_PIN, 17);
+  #endif
+
+  const char * const name = getenv("MK4DUO_PINLOG");
+  if (name) file = strcmp(name, "-") ? fopen(name, "w") : stderr;
+
+}
+
+bool PinLog::change(const pin_t pin, const bool flag) {
+  const int8_t ch = channel[uint8_t(pin)];
+  if (ch < 0) return false;
+  if (file) fprintf(file, "%llu %s %d\n", (unsigned long long)HAL_clock, channel_name[ch], int(flag));
+  const uint8_t m = ch >> 1;
+  if (ch & 1) {
+    dir[m] = flag;
+    return false;
+  }
+  if (!flag) return false;
+  if (HAL_clock - window_start[m] >= (PINLOG_RATE_WINDOW) * HAL_TICKS_PER_MS) {
+    window_start[m] = HAL_clock;
+    window_steps[m] = 0;
+  }
+  NOLESS(peak_steps[m], ++window_steps[m]);
+  steps[m]++;
+  position[m] += dir[m] ? 1 : -1;
+  NOLESS(high[m], position[m]);
+  NOMORE(low[m], position[m]);
+  return true;
+}
+
+void PinLog::report() {
+  fprintf(stderr, "time %.6f s", double(HAL_clock) / double(HAL_TIMER_RATE));
+  for (uint8_t i = 0; i < COUNT(steps); i++)
+    if (steps[i]) fprintf(stderr, " %.*s:%lu", int(strlen(channel_name[i << 1]) - 1), channel_name[i << 1], (unsigned long)steps[i]);
+  fprintf(stderr, "\n");
+  if (!steps[X_AXIS] && !steps[Y_AXIS] && !steps[Z_AXIS]) return;
+  fprintf(stderr, "span");
+  for (uint8_t i = 0; i < COUNT(steps); i++)
+    if (steps[i]) fprintf(stderr, " %.*s:%ld..%ld", int(strlen(channel_name[i << 1]) - 1), channel_name[i << 1], long(low[i]), long(high[i]));
+  fprintf(stderr, "\n");
+  fprintf(stderr, "end");
+  for (uint8_t i = 0; i < COUNT(steps); i++)
+    if (steps[i]) fprintf(stderr, " %.*s:%ld", int(strlen(channel_name[i << 1]) - 1), channel_name[i << 1], long(position[i]));
+  fprintf(stderr, "\n");
+  fprintf(stderr, "rate");
+  for (uint8_t i = 0; i < COUNT(steps); i++)
+    if (steps[i]) fprintf(stderr, " %.*s:%lu", int(strlen(channel_name[i << 1]) - 1), channel_name[i << 1], (unsigned long)peak_steps[i] * 1000UL / (PINLOG_RATE_WINDOW));
+  fprintf(stderr, "\n");
+}
+
+void PinLog::close() {
+  if (file && file != stderr) fclose(file);
+  file = nullptr;
+}
+
+/** Private Function */
+void PinLog::add(const pin_t pin, const int8_t ch) {
+  if (WITHIN(pin, 0, NUM_DIGITAL_PINS - 1)) channel[uint8_t(pin)] = ch;
+}
+
+#endif // ARDUINO_ARCH_LINUX
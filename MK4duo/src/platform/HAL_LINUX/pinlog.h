@@ -0,0 +1,86 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * pinlog.h
+ *
+ * Step and dir pin log for native Linux host
+ *
+ * Every edge on a step or dir pin is counted and, when the environment
+ * variable MK4DUO_PINLOG names a file ("-" for stderr), written as
+ *
+ *   <virtual clock ticks> <pin name> <0|1>
+ *
+ * The virtual clock runs at HAL_TIMER_RATE.
+ *
+ * The steps also move a position for each motor, forward with the dir
+ * pin high, and its lowest and highest values are kept for the report.
+ * The peak step rate of a motor is its most steps in a window of
+ * PINLOG_RATE_WINDOW ms.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#define PINLOG_RATE_WINDOW  10  // (ms)
+
+class PinLog {
+
+  public: /** Constructor */
+
+    PinLog() {}
+
+  private: /** Private Parameters */
+
+    static FILE*    file;
+    static int8_t   channel[NUM_DIGITAL_PINS];
+    static uint32_t steps[XYZ + 6];
+    static bool     dir[XYZ + 6];
+    static int32_t  position[XYZ + 6],
+                    low[XYZ + 6],
+                    high[XYZ + 6];
+    static uint64_t window_start[XYZ + 6];
+    static uint16_t window_steps[XYZ + 6],
+                    peak_steps[XYZ + 6];    // Most steps in a window of PINLOG_RATE_WINDOW ms
+
+  public: /** Public Function */
+
+    static void init();
+
+    // Return true on a step
+    static bool change(const pin_t pin, const bool flag);
+
+    FORCE_INLINE static int32_t get_position(const uint8_t motor) { return position[motor]; }
+
+    // Print step counts, virtual time, the span and the end of the positions
+    // and the peak step rates to stderr
+    static void report();
+
+    static void close();
+
+  private: /** Private Function */
+
+    static void add(const pin_t pin, const int8_t ch);
+
+};
+
+extern PinLog pinlog;
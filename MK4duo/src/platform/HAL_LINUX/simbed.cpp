@@ -0,0 +1,106 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * simbed.cpp
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+#ifdef ARDUINO_ARCH_LINUX
+
+#include "../../../MK4duo.h"
+
+SimBed simbed;
+
+/** Public Parameters */
+bool SimBed::enabled = false;
+
+/** Private Parameters */
+bool      SimBed::touching  = false;
+uint16_t  SimBed::touches   = 0;
+float     SimBed::depth     = 0;
+
+/** Public Function */
+void SimBed::init() {
+  #if MECH(CARTESIAN) || CORE_IS_XY
+    enabled = getenv("MK4DUO_SIM_BED") != nullptr;
+  #else
+    if (getenv("MK4DUO_SIM_BED")) fprintf(stderr, "MK4DUO_SIM_BED: Cartesian and COREXY/COREYX only\n");
+  #endif
+}
+
+void SimBed::update() {
+
+  if (!enabled) return;
+
+  #if MECH(CARTESIAN) || CORE_IS_XY
+
+    // Motor travel in mm, forward when the dir pin is not the inverted level
+    const float a = pinlog.get_position(X_AXIS) / mechanics.data.axis_steps_per_mm.x * (driver.x->isDir() ? -1 : 1),
+                b = pinlog.get_position(Y_AXIS) / mechanics.data.axis_steps_per_mm.y * (driver.y->isDir() ? -1 : 1),
+                c = pinlog.get_position(Z_AXIS) / mechanics.data.axis_steps_per_mm.z * (driver.z->isDir() ? -1 : 1);
+
+    #if CORE_IS_XY
+      const xyz_pos_t nozzle = { 100 + (a + b) * 0.5f, 100 + CORESIGN(a - b) * 0.5f, 10 + c };
+    #else
+      const xyz_pos_t nozzle = { 100 + a, 100 + b, 10 + c };
+    #endif
+
+    #if HAS_BED_PROBE
+      const xyz_pos_t tip = nozzle + probe.data.offset;
+    #else
+      const xyz_pos_t tip = nozzle;
+    #endif
+    const float under = bed_z(tip.x, tip.y) - tip.z;
+    const bool touch = under >= 0;
+    if (touch && !touching) touches++;
+    touching = touch;
+    NOLESS(depth, under);
+
+    // An endstop reads triggered when the pin differs from its logic
+    #if HAS_X_MIN
+      HAL_pin_value[X_MIN_PIN] = (nozzle.x <= 0) != endstops.isLogic(X_MIN);
+    #endif
+    #if HAS_Y_MIN
+      HAL_pin_value[Y_MIN_PIN] = (nozzle.y <= 0) != endstops.isLogic(Y_MIN);
+    #endif
+    #if HAS_Z_MIN
+      HAL_pin_value[Z_MIN_PIN] = touch != endstops.isLogic(Z_MIN);
+    #endif
+    #if HAS_Z_PROBE_PIN
+      HAL_pin_value[Z_PROBE_PIN] = touch != endstops.isLogic(Z_PROBE);
+    #endif
+
+  #endif
+
+}
+
+void SimBed::report() {
+  if (enabled) fprintf(stderr, "bed touches %u depth %.4f mm\n", unsigned(touches), double(depth));
+}
+
+float SimBed::bed_z(const float x, const float y) {
+  return 0.15f * sinf(x / 30.0f) + 0.1f * cosf(y / 45.0f) + 0.0005f * x;
+}
+
+#endif // ARDUINO_ARCH_LINUX
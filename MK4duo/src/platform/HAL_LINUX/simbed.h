@@ -0,0 +1,74 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * simbed.h
+ *
+ * Simulated bed for native Linux host
+ *
+ * When the environment variable MK4DUO_SIM_BED is set, the motor steps
+ * counted by the pin log move a nozzle that starts at X100 Y100 Z10,
+ * Cartesian and COREXY/COREYX only. The endstop pins follow it:
+ *
+ *  - X and Y min trigger at 0
+ *  - Z min and the probe trigger when the probe touches a bumpy bed
+ *
+ *      z = 0.15 * sin(x / 30) + 0.1 * cos(y / 45) + 0.0005 * x
+ *
+ * so homing and probing run as on a machine. The times the probe touched
+ * the bed and how deep it went under it are reported at the end.
+ *
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ */
+
+class SimBed {
+
+  public: /** Constructor */
+
+    SimBed() {}
+
+  public: /** Public Parameters */
+
+    static bool enabled;
+
+  private: /** Private Parameters */
+
+    static bool     touching;
+    static uint16_t touches;
+    static float    depth;
+
+  public: /** Public Function */
+
+    static void init();
+
+    // Set the endstop pins for the nozzle position
+    static void update();
+
+    static void report();
+
+    // Height of the bed under a point
+    static float bed_z(const float x, const float y);
+
+};
+
+extern SimBed simbed;
@@ -0,0 +1,44 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (c) 2020 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#define WDTO_15MS 15
+
+// No watchdog on host, a stuck firmware is simply a stuck process
+class Watchdog {
+
+  public: /** Constructor */
+
+    Watchdog() {}
+
+  public: /** Public Function */
+
+    static void init(void) {}
+
+    static void reset(void) {}
+
+    // Used to force a reset, on host the process exits
+    static void enable(uint32_t timeout);
+
+};
+
+extern Watchdog watchdog;
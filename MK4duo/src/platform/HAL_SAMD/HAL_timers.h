@@ -106,14 +106,14 @@ typedef struct {
 #define ENABLE_ISRS()               __enable_irq()
 #define DISABLE_ISRS()              __disable_irq()
 
-#if ENABLED(LIN_ADVANCE)
+#if HAS_LIN_ADVANCE_ISR
   #define ISR_LA_BASE_CYCLES          64UL
 #else
   #define ISR_LA_BASE_CYCLES          0UL
 #endif
 
-// Bezier interpolation adds 40 cycles
-#if ENABLED(BEZIER_JERK_CONTROL)
+// Bezier interpolation adds 40 cycles, unless the segment buffer evaluates the curve out of the ISR
+#if ENABLED(BEZIER_JERK_CONTROL) && DISABLED(STEP_SEGMENT_BUFFER)
   #define ISR_BEZIER_CYCLES           40UL
 #else
   #define ISR_BEZIER_CYCLES           0UL
@@ -157,8 +157,8 @@ typedef struct {
 
 #define ISR_E_STEPPER_CYCLES          ISR_STEPPER_CYCLES
 
-// If linear advance is disabled, then the loop also handles them
-#if DISABLED(LIN_ADVANCE) && ENABLED(COLOR_MIXING_EXTRUDER)
+// If linear advance has no ISR of its own, then the loop also handles them
+#if !HAS_LIN_ADVANCE_ISR && ENABLED(COLOR_MIXING_EXTRUDER)
   #define ISR_MIXING_STEPPER_CYCLES   ((MIXING_STEPPERS) * 16UL)
 #else
   #define ISR_MIXING_STEPPER_CYCLES   0UL
@@ -168,8 +168,8 @@ typedef struct {
 
 // But the user could be enforcing a minimum time, so the loop time is
 #define ISR_LOOP_CYCLES               (ISR_LOOP_BASE_CYCLES + MAX(HAL_min_pulse_cycle, MIN_ISR_LOOP_CYCLES))
-// If linear advance is enabled, then it is handled separately
-#if ENABLED(LIN_ADVANCE)
+// If linear advance has its own ISR, then it is handled separately
+#if HAS_LIN_ADVANCE_ISR
 
   // Estimate the minimum LA loop time
   #if ENABLED(COLOR_MIXING_EXTRUDER)
@@ -29,6 +29,7 @@
  *    ARDUINO_ARCH_SAM  : For Arduino Due and other boards based on Atmel SAM3X8E
  *    ARDUINO_ARCH_SAMD : For Arduino Due and other boards based on Atmel SAMD21J18
  *    STM32             : For Arduino STM32 and otherboards based on STM32xx ARM-Cortex M3
+ *    ARDUINO_ARCH_LINUX: For native Linux host build (simulation and benchmarking)
  *
  */
 
@@ -57,6 +58,16 @@
   #define MK_MAIN_LOOP false
   #include "HAL_STM32/spi_pins.h"
   #include "HAL_STM32/HAL.h"
+#elif ENABLED(ARDUINO_ARCH_LINUX)
+  #define CPU_32_BIT
+  #define MK_MAIN_LOOP false
+  #include "HAL_LINUX/spi_pins.h"
+  #include "HAL_LINUX/HAL.h"
 #else
   #error "Unsupported Platform!"
 #endif
+
+// Clock of the benchmarks
+#ifndef BENCHMARK_MICROS
+  #define BENCHMARK_MICROS() micros()
+#endif
@@ -0,0 +1,14 @@
+; Fast G29 probing on the simulated bumpy bed: G29 K0.2 probes 26 of the
+; 49 points and interpolates the others. The probe travels 0.3mm over the
+; highest point probed around its path, it touches the bed only on the
+; two Z homing touches and once for each probed point.
+;
+; enable: AUTO_BED_LEVELING_BILINEAR PROBE_FIX_MOUNTED Z_SAFE_HOMING ABL_FAST_PROBING
+; set: GRID_MAX_POINTS_X 7
+; set: GRID_MAX_POINTS_Y 7
+; set: Z_PROBE_MESH_CLEARANCE 0.3
+; env: MK4DUO_SIM_BED=1
+; expect: ^Probed 26 interpolated 23 of 49$
+; expect: ^bed touches 28 depth 0\.00[0-9]+ mm$
+G28
+G29 K0.2 V1
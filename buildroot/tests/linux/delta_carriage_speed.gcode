@@ -0,0 +1,14 @@
+; Segment-free delta line near tower A: the rear carriage runs faster
+; than the line, up to the worst ratio of line_step_events, and the
+; line speed is cut so it stays within its max feedrate, 100 mm/s at
+; 80 steps/mm (8000 steps/s, it ran at 8800 with the end-to-end limit).
+;
+; mechanism: MECH_DELTA
+; enable: STEP_SEGMENT_BUFFER DELTA_SEGMENT_FREE
+; expect: ^FromStp: X:-(54\.99[0-9]|55\.00[0-9]) Y:-(44\.99[0-9]|45\.00[0-9]) Z:(49\.99[0-9]|50\.00[0-9])
+; expect: ^rate X:[0-9]+ Y:[0-9]+ Z:(7[0-9]{3}|8000)$
+M203 X100 Y100 Z100
+G92 X-20 Y20 Z50
+G1 X-55 Y-45 F6000
+M400
+M114 D
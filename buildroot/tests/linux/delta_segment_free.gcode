@@ -0,0 +1,18 @@
+; Segment-free delta moves: lines changing XY and Z together end with
+; the carriages on the steps of the target point (M114 D FromStp), and
+; back on the start point they end on its steps again.
+;
+; mechanism: MECH_DELTA
+; enable: STEP_SEGMENT_BUFFER DELTA_SEGMENT_FREE
+; expect: ^FromStp: X:(29\.99[0-9]|30\.0[01][0-9]) Y:(19\.99[0-9]|20\.0[01][0-9]) Z:(79\.99[0-9]|80\.0[01][0-9])
+; expect: ^FromStp: X:-(19\.99[0-9]|20\.0[01][0-9]) Y:(9\.99[0-9]|10\.0[01][0-9]) Z:(59\.99[0-9]|60\.0[01][0-9])
+; expect: ^Stepper: X:23242 Y:23242 Z:23242
+G92 X0 Y0 Z100
+G1 X30 Y20 Z80 F3000
+M114 D
+G1 X-20 Y10 Z60
+M114 D
+G1 X0 Y0 Z100
+G1 X40 Y-30 Z40 F6000
+G1 X0 Y0 Z100
+M114 D
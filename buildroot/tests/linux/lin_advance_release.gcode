@@ -0,0 +1,16 @@
+; Smoothed pressure advance: the advance the last step events of a move
+; can't take before a stop is released after them, so the E motor ends
+; on the nominal steps of the extrusion (5 mm at 625 steps/mm).
+;
+; enable: LIN_ADVANCE LIN_ADVANCE_SMOOTHING STEP_SEGMENT_BUFFER
+; expect: ^Stepper: X:4000 Y:2400 Z:0 E:3125
+; expect: ^end X:4000 Y:2400 E0:3125$
+M302 P1
+M900 K0.5
+G92 X0 Y0 Z0 E0
+G1 X20 E2 F3000
+G1 X40 E4 F6000
+M400
+G1 Y10 E5 F1200
+M400
+M114 D
@@ -0,0 +1,21 @@
+; Segment-free mesh leveling with fade: a line going down over a mesh
+; raised by 1mm, faded out at 10mm. Leveled the nozzle goes straight
+; from Z5.05 down to Z1.18 (3200 steps/mm), its Z never passes the ends.
+;
+; enable: MESH_BED_LEVELING ENABLE_LEVELING_FADE_HEIGHT
+; enable: STEP_SEGMENT_BUFFER MESH_SEGMENT_FREE
+; expect: ^Stepper: X:28800 Y:0 Z:3776 
+; expect: ^span X:0..25600 Z:-12384..0$
+G92 X20 Y20 Z5
+M421 I0 J0 Z1
+M421 I1 J0 Z1
+M421 I2 J0 Z1
+M421 I0 J1 Z1
+M421 I1 J1 Z1
+M421 I2 J1 Z1
+M421 I0 J2 Z1
+M421 I1 J2 Z1
+M421 I2 J2 Z1
+M420 S1 Z10
+G1 X180 Y180 Z0.2 F6000
+M114 D
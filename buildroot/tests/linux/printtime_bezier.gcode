@@ -0,0 +1,14 @@
+; Print time estimate (M37) with BEZIER_JERK_CONTROL, the blocks are
+; timed by their acceleration and deceleration times and must give the
+; durations in buildroot/tests/linux/sd/timing.gco too.
+;
+; enable: SDSUPPORT PRINT_TIME_ESTIMATE BEZIER_JERK_CONTROL
+; env: MK4DUO_SD=buildroot/tests/linux/sd
+; expect: ^echo:Print time estimate: 9s Layers: 2
+; expect-file: buildroot/tests/linux/sd/timing.tim ^TIME: +922[01] LAYERS: +2$
+; expect-file: buildroot/tests/linux/sd/timing.tim ^LAYER:1 START:172[34] TIME:399[89] POS:592$
+; expect-file: buildroot/tests/linux/sd/timing.tim ^LAYER:2 START:572[23] TIME:349[89] POS:634$
+; expect-file: buildroot/tests/linux/sd/timing.tim ^PROGRESS:586 172[34]$
+; expect-file: buildroot/tests/linux/sd/timing.tim ^PROGRESS:626 522[23]$
+; expect-file: buildroot/tests/linux/sd/timing.tim ^PROGRESS:671 922[01]$
+M37 timing.gco
@@ -0,0 +1,694 @@
+; Trapezoid generator: the blocks of a short print are planned with the
+; fixed point generator and checked against the float one (M962 P1),
+; then the same is done for a stream of random blocks (M962 S).
+;
+; enable: FIXED_POINT_TRAPEZOID
+; expect: ^Blocks:[1-9][0-9]* Mismatch:0 Max diff steps:[01] rate:[01]$
+; expect: ^Blocks:[1-9][0-9]* Mismatch:0 .*Float
+M302 P1
+G92 X0 Y0 Z0 E0
+M962 P1
+G1 Z0.20 F600
+M204 P500 T1000
+G1 X80.000 Y60.000 F6000
+G1 X79.904 Y61.960 E0.06477 F1800
+G1 X79.616 Y63.902 E0.12954 F1800
+G1 X79.139 Y65.806 E0.19431 F1800
+G1 X78.478 Y67.654 E0.25908 F1800
+G1 X77.638 Y69.428 E0.32385 F1800
+G1 X76.629 Y71.111 E0.38862 F1800
+G1 X75.460 Y72.688 E0.45339 F1800
+G1 X74.142 Y74.142 E0.51815 F1800
+G1 X72.688 Y75.460 E0.58292 F1800
+G1 X71.111 Y76.629 E0.64769 F1800
+G1 X69.428 Y77.638 E0.71246 F1800
+G1 X67.654 Y78.478 E0.77723 F1800
+G1 X65.806 Y79.139 E0.84200 F1800
+G1 X63.902 Y79.616 E0.90677 F1800
+G1 X61.960 Y79.904 E0.97154 F1800
+G1 X60.000 Y80.000 E1.03631 F1800
+G1 X58.040 Y79.904 E1.10108 F1800
+G1 X56.098 Y79.616 E1.16585 F1800
+G1 X54.194 Y79.139 E1.23062 F1800
+G1 X52.346 Y78.478 E1.29539 F1800
+G1 X50.572 Y77.638 E1.36016 F1800
+G1 X48.889 Y76.629 E1.42493 F1800
+G1 X47.312 Y75.460 E1.48969 F1800
+G1 X45.858 Y74.142 E1.55446 F1800
+G1 X44.540 Y72.688 E1.61923 F1800
+G1 X43.371 Y71.111 E1.68400 F1800
+G1 X42.362 Y69.428 E1.74877 F1800
+G1 X41.522 Y67.654 E1.81354 F1800
+G1 X40.861 Y65.806 E1.87831 F1800
+G1 X40.384 Y63.902 E1.94308 F1800
+G1 X40.096 Y61.960 E2.00785 F1800
+G1 X40.000 Y60.000 E2.07262 F1800
+G1 X40.096 Y58.040 E2.13739 F1800
+G1 X40.384 Y56.098 E2.20216 F1800
+G1 X40.861 Y54.194 E2.26693 F1800
+G1 X41.522 Y52.346 E2.33170 F1800
+G1 X42.362 Y50.572 E2.39647 F1800
+G1 X43.371 Y48.889 E2.46123 F1800
+G1 X44.540 Y47.312 E2.52600 F1800
+G1 X45.858 Y45.858 E2.59077 F1800
+G1 X47.312 Y44.540 E2.65554 F1800
+G1 X48.889 Y43.371 E2.72031 F1800
+G1 X50.572 Y42.362 E2.78508 F1800
+G1 X52.346 Y41.522 E2.84985 F1800
+G1 X54.194 Y40.861 E2.91462 F1800
+G1 X56.098 Y40.384 E2.97939 F1800
+G1 X58.040 Y40.096 E3.04416 F1800
+G1 X60.000 Y40.000 E3.10893 F1800
+G1 X61.960 Y40.096 E3.17370 F1800
+G1 X63.902 Y40.384 E3.23847 F1800
+G1 X65.806 Y40.861 E3.30324 F1800
+G1 X67.654 Y41.522 E3.36801 F1800
+G1 X69.428 Y42.362 E3.43277 F1800
+G1 X71.111 Y43.371 E3.49754 F1800
+G1 X72.688 Y44.540 E3.56231 F1800
+G1 X74.142 Y45.858 E3.62708 F1800
+G1 X75.460 Y47.312 E3.69185 F1800
+G1 X76.629 Y48.889 E3.75662 F1800
+G1 X77.638 Y50.572 E3.82139 F1800
+G1 X78.478 Y52.346 E3.88616 F1800
+G1 X79.139 Y54.194 E3.95093 F1800
+G1 X79.616 Y56.098 E4.01570 F1800
+G1 X79.904 Y58.040 E4.08047 F1800
+G1 X80.000 Y60.000 E4.14524 F1800
+G1 X79.600 Y60.000 F6000
+G1 X79.506 Y61.921 E4.20871 F1800
+G1 X79.223 Y63.824 E4.27219 F1800
+G1 X78.756 Y65.690 E4.33566 F1800
+G1 X78.108 Y67.501 E4.39913 F1800
+G1 X77.286 Y69.239 E4.46261 F1800
+G1 X76.297 Y70.889 E4.52608 F1800
+G1 X75.151 Y72.434 E4.58955 F1800
+G1 X73.859 Y73.859 E4.65303 F1800
+G1 X72.434 Y75.151 E4.71650 F1800
+G1 X70.889 Y76.297 E4.77998 F1800
+G1 X69.239 Y77.286 E4.84345 F1800
+G1 X67.501 Y78.108 E4.90692 F1800
+G1 X65.690 Y78.756 E4.97040 F1800
+G1 X63.824 Y79.223 E5.03387 F1800
+G1 X61.921 Y79.506 E5.09735 F1800
+G1 X60.000 Y79.600 E5.16082 F1800
+G1 X58.079 Y79.506 E5.22429 F1800
+G1 X56.176 Y79.223 E5.28777 F1800
+G1 X54.310 Y78.756 E5.35124 F1800
+G1 X52.499 Y78.108 E5.41472 F1800
+G1 X50.761 Y77.286 E5.47819 F1800
+G1 X49.111 Y76.297 E5.54166 F1800
+G1 X47.566 Y75.151 E5.60514 F1800
+G1 X46.141 Y73.859 E5.66861 F1800
+G1 X44.849 Y72.434 E5.73209 F1800
+G1 X43.703 Y70.889 E5.79556 F1800
+G1 X42.714 Y69.239 E5.85903 F1800
+G1 X41.892 Y67.501 E5.92251 F1800
+G1 X41.244 Y65.690 E5.98598 F1800
+G1 X40.777 Y63.824 E6.04946 F1800
+G1 X40.494 Y61.921 E6.11293 F1800
+G1 X40.400 Y60.000 E6.17640 F1800
+G1 X40.494 Y58.079 E6.23988 F1800
+G1 X40.777 Y56.176 E6.30335 F1800
+G1 X41.244 Y54.310 E6.36683 F1800
+G1 X41.892 Y52.499 E6.43030 F1800
+G1 X42.714 Y50.761 E6.49377 F1800
+G1 X43.703 Y49.111 E6.55725 F1800
+G1 X44.849 Y47.566 E6.62072 F1800
+G1 X46.141 Y46.141 E6.68419 F1800
+G1 X47.566 Y44.849 E6.74767 F1800
+G1 X49.111 Y43.703 E6.81114 F1800
+G1 X50.761 Y42.714 E6.87462 F1800
+G1 X52.499 Y41.892 E6.93809 F1800
+G1 X54.310 Y41.244 E7.00156 F1800
+G1 X56.176 Y40.777 E7.06504 F1800
+G1 X58.079 Y40.494 E7.12851 F1800
+G1 X60.000 Y40.400 E7.19199 F1800
+G1 X61.921 Y40.494 E7.25546 F1800
+G1 X63.824 Y40.777 E7.31893 F1800
+G1 X65.690 Y41.244 E7.38241 F1800
+G1 X67.501 Y41.892 E7.44588 F1800
+G1 X69.239 Y42.714 E7.50936 F1800
+G1 X70.889 Y43.703 E7.57283 F1800
+G1 X72.434 Y44.849 E7.63630 F1800
+G1 X73.859 Y46.141 E7.69978 F1800
+G1 X75.151 Y47.566 E7.76325 F1800
+G1 X76.297 Y49.111 E7.82673 F1800
+G1 X77.286 Y50.761 E7.89020 F1800
+G1 X78.108 Y52.499 E7.95367 F1800
+G1 X78.756 Y54.310 E8.01715 F1800
+G1 X79.223 Y56.176 E8.08062 F1800
+G1 X79.506 Y58.079 E8.14410 F1800
+G1 X79.600 Y60.000 E8.20757 F1800
+G1 E6.20757 F2400
+G1 X42.000 Y50.000 F9000
+G1 E8.20757 F2400
+G1 X43.845 Y50.000 E8.22757
+G1 X76.155 Y50.000 E9.29383 F4200
+G1 X76.624 Y50.800 E9.31383
+G1 X43.376 Y50.800 E10.41102 F4200
+G1 X42.958 Y51.600 E10.43102
+G1 X77.042 Y51.600 E11.55581 F4200
+G1 X77.414 Y52.400 E11.57581
+G1 X42.586 Y52.400 E12.72512 F4200
+G1 X42.259 Y53.200 E12.74512
+G1 X77.741 Y53.200 E13.91606 F4200
+G1 X78.028 Y54.000 E13.93606
+G1 X41.972 Y54.000 E15.12589 F4200
+G1 X41.725 Y54.800 E15.14589
+G1 X78.275 Y54.800 E16.35201 F4200
+G1 X78.484 Y55.600 E16.37201
+G1 X41.516 Y55.600 E17.59193 F4200
+G1 X41.344 Y56.400 E17.61193
+G1 X78.656 Y56.400 E18.84321 F4200
+G1 X78.793 Y57.200 E18.86321
+G1 X41.207 Y57.200 E20.10352 F4200
+G1 X41.106 Y58.000 E20.12352
+G1 X78.894 Y58.000 E21.37055 F4200
+G1 X78.962 Y58.800 E21.39055
+G1 X41.038 Y58.800 E22.64205 F4200
+G1 X41.004 Y59.600 E22.66205
+G1 X78.996 Y59.600 E23.91577 F4200
+G1 X78.996 Y60.400 E23.93577
+G1 X41.004 Y60.400 E25.18949 F4200
+G1 X41.038 Y61.200 E25.20949
+G1 X78.962 Y61.200 E26.46099 F4200
+G1 X78.894 Y62.000 E26.48099
+G1 X41.106 Y62.000 E27.72802 F4200
+G1 X41.207 Y62.800 E27.74802
+G1 X78.793 Y62.800 E28.98833 F4200
+G1 X78.656 Y63.600 E29.00833
+G1 X41.344 Y63.600 E30.23962 F4200
+G1 X41.516 Y64.400 E30.25962
+G1 X78.484 Y64.400 E31.47953 F4200
+G1 X78.275 Y65.200 E31.49953
+G1 X41.725 Y65.200 E32.70565 F4200
+G1 X41.972 Y66.000 E32.72565
+G1 X78.028 Y66.000 E33.91548 F4200
+G1 X77.741 Y66.800 E33.93548
+G1 X42.259 Y66.800 E35.10642 F4200
+G1 X42.586 Y67.600 E35.12642
+G1 X77.414 Y67.600 E36.27573 F4200
+G1 X77.042 Y68.400 E36.29573
+G1 X42.958 Y68.400 E37.42052 F4200
+G1 X43.376 Y69.200 E37.44052
+G1 X76.624 Y69.200 E38.53771 F4200
+G1 X76.155 Y70.000 E38.55771
+G1 X43.845 Y70.000 E39.62397 F4200
+G1 X60.300 Y60.000 E39.62797 F1200
+G1 X60.162 Y60.252 E39.63197 F1200
+G1 X59.875 Y60.273 E39.63597 F1200
+G1 X59.703 Y60.042 E39.63997 F1200
+G1 X59.804 Y59.773 E39.64397 F1200
+G1 X60.085 Y59.712 E39.64797 F1200
+G1 X60.288 Y59.916 E39.65197 F1200
+G1 X60.226 Y60.197 E39.65597 F1200
+G1 X59.956 Y60.297 E39.65997 F1200
+G1 X59.727 Y60.124 E39.66397 F1200
+G1 X59.748 Y59.837 E39.66797 F1200
+G1 X60.001 Y59.700 E39.67197 F1200
+G1 X60.253 Y59.839 E39.67597 F1200
+G1 X60.272 Y60.126 E39.67997 F1200
+G1 X60.041 Y60.297 E39.68397 F1200
+G1 X59.772 Y60.195 E39.68797 F1200
+G1 X59.713 Y59.914 E39.69197 F1200
+G1 X59.917 Y59.712 E39.69597 F1200
+G1 X60.198 Y59.775 E39.69997 F1200
+G1 X60.297 Y60.045 E39.70397 F1200
+G1 X60.122 Y60.274 E39.70797 F1200
+G1 X59.836 Y60.251 E39.71197 F1200
+G1 X59.700 Y59.997 E39.71597 F1200
+G1 X59.840 Y59.746 E39.71997 F1200
+G1 X60.127 Y59.728 E39.72397 F1200
+G1 X60.297 Y59.960 E39.72797 F1200
+G1 X60.194 Y60.229 E39.73197 F1200
+G1 X59.912 Y60.287 E39.73597 F1200
+G1 X59.711 Y60.081 E39.73997 F1200
+G1 X59.776 Y59.801 E39.74397 F1200
+G1 X60.046 Y59.704 E39.74797 F1200
+G1 X60.274 Y59.879 E39.75197 F1200
+G1 X60.250 Y60.165 E39.75597 F1200
+G1 X59.996 Y60.300 E39.75997 F1200
+G1 X59.745 Y60.159 E39.76397 F1200
+G1 X59.729 Y59.872 E39.76797 F1200
+G1 X59.962 Y59.702 E39.77197 F1200
+G1 X60.230 Y59.807 E39.77597 F1200
+G1 X60.287 Y60.089 E39.77997 F1200
+G1 X60.080 Y60.289 E39.78397 F1200
+G1 Z0.40 F600
+M204 P1500 T2000
+G1 X80.000 Y60.000 F6000
+G1 X79.904 Y61.960 E39.84874 F2700
+G1 X79.616 Y63.902 E39.91351 F2700
+G1 X79.139 Y65.806 E39.97828 F2700
+G1 X78.478 Y67.654 E40.04305 F2700
+G1 X77.638 Y69.428 E40.10782 F2700
+G1 X76.629 Y71.111 E40.17259 F2700
+G1 X75.460 Y72.688 E40.23736 F2700
+G1 X74.142 Y74.142 E40.30213 F2700
+G1 X72.688 Y75.460 E40.36690 F2700
+G1 X71.111 Y76.629 E40.43167 F2700
+G1 X69.428 Y77.638 E40.49643 F2700
+G1 X67.654 Y78.478 E40.56120 F2700
+G1 X65.806 Y79.139 E40.62597 F2700
+G1 X63.902 Y79.616 E40.69074 F2700
+G1 X61.960 Y79.904 E40.75551 F2700
+G1 X60.000 Y80.000 E40.82028 F2700
+G1 X58.040 Y79.904 E40.88505 F2700
+G1 X56.098 Y79.616 E40.94982 F2700
+G1 X54.194 Y79.139 E41.01459 F2700
+G1 X52.346 Y78.478 E41.07936 F2700
+G1 X50.572 Y77.638 E41.14413 F2700
+G1 X48.889 Y76.629 E41.20890 F2700
+G1 X47.312 Y75.460 E41.27367 F2700
+G1 X45.858 Y74.142 E41.33844 F2700
+G1 X44.540 Y72.688 E41.40321 F2700
+G1 X43.371 Y71.111 E41.46797 F2700
+G1 X42.362 Y69.428 E41.53274 F2700
+G1 X41.522 Y67.654 E41.59751 F2700
+G1 X40.861 Y65.806 E41.66228 F2700
+G1 X40.384 Y63.902 E41.72705 F2700
+G1 X40.096 Y61.960 E41.79182 F2700
+G1 X40.000 Y60.000 E41.85659 F2700
+G1 X40.096 Y58.040 E41.92136 F2700
+G1 X40.384 Y56.098 E41.98613 F2700
+G1 X40.861 Y54.194 E42.05090 F2700
+G1 X41.522 Y52.346 E42.11567 F2700
+G1 X42.362 Y50.572 E42.18044 F2700
+G1 X43.371 Y48.889 E42.24521 F2700
+G1 X44.540 Y47.312 E42.30998 F2700
+G1 X45.858 Y45.858 E42.37475 F2700
+G1 X47.312 Y44.540 E42.43951 F2700
+G1 X48.889 Y43.371 E42.50428 F2700
+G1 X50.572 Y42.362 E42.56905 F2700
+G1 X52.346 Y41.522 E42.63382 F2700
+G1 X54.194 Y40.861 E42.69859 F2700
+G1 X56.098 Y40.384 E42.76336 F2700
+G1 X58.040 Y40.096 E42.82813 F2700
+G1 X60.000 Y40.000 E42.89290 F2700
+G1 X61.960 Y40.096 E42.95767 F2700
+G1 X63.902 Y40.384 E43.02244 F2700
+G1 X65.806 Y40.861 E43.08721 F2700
+G1 X67.654 Y41.522 E43.15198 F2700
+G1 X69.428 Y42.362 E43.21675 F2700
+G1 X71.111 Y43.371 E43.28152 F2700
+G1 X72.688 Y44.540 E43.34629 F2700
+G1 X74.142 Y45.858 E43.41105 F2700
+G1 X75.460 Y47.312 E43.47582 F2700
+G1 X76.629 Y48.889 E43.54059 F2700
+G1 X77.638 Y50.572 E43.60536 F2700
+G1 X78.478 Y52.346 E43.67013 F2700
+G1 X79.139 Y54.194 E43.73490 F2700
+G1 X79.616 Y56.098 E43.79967 F2700
+G1 X79.904 Y58.040 E43.86444 F2700
+G1 X80.000 Y60.000 E43.92921 F2700
+G1 X79.600 Y60.000 F6000
+G1 X79.506 Y61.921 E43.99268 F2700
+G1 X79.223 Y63.824 E44.05616 F2700
+G1 X78.756 Y65.690 E44.11963 F2700
+G1 X78.108 Y67.501 E44.18310 F2700
+G1 X77.286 Y69.239 E44.24658 F2700
+G1 X76.297 Y70.889 E44.31005 F2700
+G1 X75.151 Y72.434 E44.37353 F2700
+G1 X73.859 Y73.859 E44.43700 F2700
+G1 X72.434 Y75.151 E44.50047 F2700
+G1 X70.889 Y76.297 E44.56395 F2700
+G1 X69.239 Y77.286 E44.62742 F2700
+G1 X67.501 Y78.108 E44.69090 F2700
+G1 X65.690 Y78.756 E44.75437 F2700
+G1 X63.824 Y79.223 E44.81784 F2700
+G1 X61.921 Y79.506 E44.88132 F2700
+G1 X60.000 Y79.600 E44.94479 F2700
+G1 X58.079 Y79.506 E45.00827 F2700
+G1 X56.176 Y79.223 E45.07174 F2700
+G1 X54.310 Y78.756 E45.13521 F2700
+G1 X52.499 Y78.108 E45.19869 F2700
+G1 X50.761 Y77.286 E45.26216 F2700
+G1 X49.111 Y76.297 E45.32564 F2700
+G1 X47.566 Y75.151 E45.38911 F2700
+G1 X46.141 Y73.859 E45.45258 F2700
+G1 X44.849 Y72.434 E45.51606 F2700
+G1 X43.703 Y70.889 E45.57953 F2700
+G1 X42.714 Y69.239 E45.64301 F2700
+G1 X41.892 Y67.501 E45.70648 F2700
+G1 X41.244 Y65.690 E45.76995 F2700
+G1 X40.777 Y63.824 E45.83343 F2700
+G1 X40.494 Y61.921 E45.89690 F2700
+G1 X40.400 Y60.000 E45.96038 F2700
+G1 X40.494 Y58.079 E46.02385 F2700
+G1 X40.777 Y56.176 E46.08732 F2700
+G1 X41.244 Y54.310 E46.15080 F2700
+G1 X41.892 Y52.499 E46.21427 F2700
+G1 X42.714 Y50.761 E46.27775 F2700
+G1 X43.703 Y49.111 E46.34122 F2700
+G1 X44.849 Y47.566 E46.40469 F2700
+G1 X46.141 Y46.141 E46.46817 F2700
+G1 X47.566 Y44.849 E46.53164 F2700
+G1 X49.111 Y43.703 E46.59511 F2700
+G1 X50.761 Y42.714 E46.65859 F2700
+G1 X52.499 Y41.892 E46.72206 F2700
+G1 X54.310 Y41.244 E46.78554 F2700
+G1 X56.176 Y40.777 E46.84901 F2700
+G1 X58.079 Y40.494 E46.91248 F2700
+G1 X60.000 Y40.400 E46.97596 F2700
+G1 X61.921 Y40.494 E47.03943 F2700
+G1 X63.824 Y40.777 E47.10291 F2700
+G1 X65.690 Y41.244 E47.16638 F2700
+G1 X67.501 Y41.892 E47.22985 F2700
+G1 X69.239 Y42.714 E47.29333 F2700
+G1 X70.889 Y43.703 E47.35680 F2700
+G1 X72.434 Y44.849 E47.42028 F2700
+G1 X73.859 Y46.141 E47.48375 F2700
+G1 X75.151 Y47.566 E47.54722 F2700
+G1 X76.297 Y49.111 E47.61070 F2700
+G1 X77.286 Y50.761 E47.67417 F2700
+G1 X78.108 Y52.499 E47.73765 F2700
+G1 X78.756 Y54.310 E47.80112 F2700
+G1 X79.223 Y56.176 E47.86459 F2700
+G1 X79.506 Y58.079 E47.92807 F2700
+G1 X79.600 Y60.000 E47.99154 F2700
+G1 E45.99154 F2400
+G1 X42.000 Y50.000 F9000
+G1 E47.99154 F2400
+G1 X43.845 Y50.000 E48.01154
+G1 X76.155 Y50.000 E49.07780 F4200
+G1 X76.624 Y50.800 E49.09780
+G1 X43.376 Y50.800 E50.19499 F4200
+G1 X42.958 Y51.600 E50.21499
+G1 X77.042 Y51.600 E51.33979 F4200
+G1 X77.414 Y52.400 E51.35979
+G1 X42.586 Y52.400 E52.50910 F4200
+G1 X42.259 Y53.200 E52.52910
+G1 X77.741 Y53.200 E53.70003 F4200
+G1 X78.028 Y54.000 E53.72003
+G1 X41.972 Y54.000 E54.90986 F4200
+G1 X41.725 Y54.800 E54.92986
+G1 X78.275 Y54.800 E56.13599 F4200
+G1 X78.484 Y55.600 E56.15599
+G1 X41.516 Y55.600 E57.37590 F4200
+G1 X41.344 Y56.400 E57.39590
+G1 X78.656 Y56.400 E58.62718 F4200
+G1 X78.793 Y57.200 E58.64718
+G1 X41.207 Y57.200 E59.88749 F4200
+G1 X41.106 Y58.000 E59.90749
+G1 X78.894 Y58.000 E61.15452 F4200
+G1 X78.962 Y58.800 E61.17452
+G1 X41.038 Y58.800 E62.42602 F4200
+G1 X41.004 Y59.600 E62.44602
+G1 X78.996 Y59.600 E63.69974 F4200
+G1 X78.996 Y60.400 E63.71974
+G1 X41.004 Y60.400 E64.97346 F4200
+G1 X41.038 Y61.200 E64.99346
+G1 X78.962 Y61.200 E66.24496 F4200
+G1 X78.894 Y62.000 E66.26496
+G1 X41.106 Y62.000 E67.51199 F4200
+G1 X41.207 Y62.800 E67.53199
+G1 X78.793 Y62.800 E68.77230 F4200
+G1 X78.656 Y63.600 E68.79230
+G1 X41.344 Y63.600 E70.02359 F4200
+G1 X41.516 Y64.400 E70.04359
+G1 X78.484 Y64.400 E71.26350 F4200
+G1 X78.275 Y65.200 E71.28350
+G1 X41.725 Y65.200 E72.48962 F4200
+G1 X41.972 Y66.000 E72.50962
+G1 X78.028 Y66.000 E73.69945 F4200
+G1 X77.741 Y66.800 E73.71945
+G1 X42.259 Y66.800 E74.89039 F4200
+G1 X42.586 Y67.600 E74.91039
+G1 X77.414 Y67.600 E76.05970 F4200
+G1 X77.042 Y68.400 E76.07970
+G1 X42.958 Y68.400 E77.20449 F4200
+G1 X43.376 Y69.200 E77.22449
+G1 X76.624 Y69.200 E78.32168 F4200
+G1 X76.155 Y70.000 E78.34168
+G1 X43.845 Y70.000 E79.40794 F4200
+G1 X60.300 Y60.000 E79.41194 F1200
+G1 X60.162 Y60.252 E79.41594 F1200
+G1 X59.875 Y60.273 E79.41994 F1200
+G1 X59.703 Y60.042 E79.42394 F1200
+G1 X59.804 Y59.773 E79.42794 F1200
+G1 X60.085 Y59.712 E79.43194 F1200
+G1 X60.288 Y59.916 E79.43594 F1200
+G1 X60.226 Y60.197 E79.43994 F1200
+G1 X59.956 Y60.297 E79.44394 F1200
+G1 X59.727 Y60.124 E79.44794 F1200
+G1 X59.748 Y59.837 E79.45194 F1200
+G1 X60.001 Y59.700 E79.45594 F1200
+G1 X60.253 Y59.839 E79.45994 F1200
+G1 X60.272 Y60.126 E79.46394 F1200
+G1 X60.041 Y60.297 E79.46794 F1200
+G1 X59.772 Y60.195 E79.47194 F1200
+G1 X59.713 Y59.914 E79.47594 F1200
+G1 X59.917 Y59.712 E79.47994 F1200
+G1 X60.198 Y59.775 E79.48394 F1200
+G1 X60.297 Y60.045 E79.48794 F1200
+G1 X60.122 Y60.274 E79.49194 F1200
+G1 X59.836 Y60.251 E79.49594 F1200
+G1 X59.700 Y59.997 E79.49994 F1200
+G1 X59.840 Y59.746 E79.50394 F1200
+G1 X60.127 Y59.728 E79.50794 F1200
+G1 X60.297 Y59.960 E79.51194 F1200
+G1 X60.194 Y60.229 E79.51594 F1200
+G1 X59.912 Y60.287 E79.51994 F1200
+G1 X59.711 Y60.081 E79.52394 F1200
+G1 X59.776 Y59.801 E79.52794 F1200
+G1 X60.046 Y59.704 E79.53194 F1200
+G1 X60.274 Y59.879 E79.53594 F1200
+G1 X60.250 Y60.165 E79.53994 F1200
+G1 X59.996 Y60.300 E79.54394 F1200
+G1 X59.745 Y60.159 E79.54794 F1200
+G1 X59.729 Y59.872 E79.55194 F1200
+G1 X59.962 Y59.702 E79.55594 F1200
+G1 X60.230 Y59.807 E79.55994 F1200
+G1 X60.287 Y60.089 E79.56394 F1200
+G1 X60.080 Y60.289 E79.56794 F1200
+G1 Z0.60 F600
+M204 P3000 T4000
+G1 X80.000 Y60.000 F6000
+G1 X79.904 Y61.960 E79.63271 F2700
+G1 X79.616 Y63.902 E79.69748 F2700
+G1 X79.139 Y65.806 E79.76225 F2700
+G1 X78.478 Y67.654 E79.82702 F2700
+G1 X77.638 Y69.428 E79.89179 F2700
+G1 X76.629 Y71.111 E79.95656 F2700
+G1 X75.460 Y72.688 E80.02133 F2700
+G1 X74.142 Y74.142 E80.08610 F2700
+G1 X72.688 Y75.460 E80.15087 F2700
+G1 X71.111 Y76.629 E80.21564 F2700
+G1 X69.428 Y77.638 E80.28041 F2700
+G1 X67.654 Y78.478 E80.34518 F2700
+G1 X65.806 Y79.139 E80.40995 F2700
+G1 X63.902 Y79.616 E80.47471 F2700
+G1 X61.960 Y79.904 E80.53948 F2700
+G1 X60.000 Y80.000 E80.60425 F2700
+G1 X58.040 Y79.904 E80.66902 F2700
+G1 X56.098 Y79.616 E80.73379 F2700
+G1 X54.194 Y79.139 E80.79856 F2700
+G1 X52.346 Y78.478 E80.86333 F2700
+G1 X50.572 Y77.638 E80.92810 F2700
+G1 X48.889 Y76.629 E80.99287 F2700
+G1 X47.312 Y75.460 E81.05764 F2700
+G1 X45.858 Y74.142 E81.12241 F2700
+G1 X44.540 Y72.688 E81.18718 F2700
+G1 X43.371 Y71.111 E81.25195 F2700
+G1 X42.362 Y69.428 E81.31672 F2700
+G1 X41.522 Y67.654 E81.38149 F2700
+G1 X40.861 Y65.806 E81.44625 F2700
+G1 X40.384 Y63.902 E81.51102 F2700
+G1 X40.096 Y61.960 E81.57579 F2700
+G1 X40.000 Y60.000 E81.64056 F2700
+G1 X40.096 Y58.040 E81.70533 F2700
+G1 X40.384 Y56.098 E81.77010 F2700
+G1 X40.861 Y54.194 E81.83487 F2700
+G1 X41.522 Y52.346 E81.89964 F2700
+G1 X42.362 Y50.572 E81.96441 F2700
+G1 X43.371 Y48.889 E82.02918 F2700
+G1 X44.540 Y47.312 E82.09395 F2700
+G1 X45.858 Y45.858 E82.15872 F2700
+G1 X47.312 Y44.540 E82.22349 F2700
+G1 X48.889 Y43.371 E82.28826 F2700
+G1 X50.572 Y42.362 E82.35303 F2700
+G1 X52.346 Y41.522 E82.41779 F2700
+G1 X54.194 Y40.861 E82.48256 F2700
+G1 X56.098 Y40.384 E82.54733 F2700
+G1 X58.040 Y40.096 E82.61210 F2700
+G1 X60.000 Y40.000 E82.67687 F2700
+G1 X61.960 Y40.096 E82.74164 F2700
+G1 X63.902 Y40.384 E82.80641 F2700
+G1 X65.806 Y40.861 E82.87118 F2700
+G1 X67.654 Y41.522 E82.93595 F2700
+G1 X69.428 Y42.362 E83.00072 F2700
+G1 X71.111 Y43.371 E83.06549 F2700
+G1 X72.688 Y44.540 E83.13026 F2700
+G1 X74.142 Y45.858 E83.19503 F2700
+G1 X75.460 Y47.312 E83.25980 F2700
+G1 X76.629 Y48.889 E83.32457 F2700
+G1 X77.638 Y50.572 E83.38933 F2700
+G1 X78.478 Y52.346 E83.45410 F2700
+G1 X79.139 Y54.194 E83.51887 F2700
+G1 X79.616 Y56.098 E83.58364 F2700
+G1 X79.904 Y58.040 E83.64841 F2700
+G1 X80.000 Y60.000 E83.71318 F2700
+G1 X79.600 Y60.000 F6000
+G1 X79.506 Y61.921 E83.77666 F2700
+G1 X79.223 Y63.824 E83.84013 F2700
+G1 X78.756 Y65.690 E83.90360 F2700
+G1 X78.108 Y67.501 E83.96708 F2700
+G1 X77.286 Y69.239 E84.03055 F2700
+G1 X76.297 Y70.889 E84.09402 F2700
+G1 X75.151 Y72.434 E84.15750 F2700
+G1 X73.859 Y73.859 E84.22097 F2700
+G1 X72.434 Y75.151 E84.28445 F2700
+G1 X70.889 Y76.297 E84.34792 F2700
+G1 X69.239 Y77.286 E84.41139 F2700
+G1 X67.501 Y78.108 E84.47487 F2700
+G1 X65.690 Y78.756 E84.53834 F2700
+G1 X63.824 Y79.223 E84.60182 F2700
+G1 X61.921 Y79.506 E84.66529 F2700
+G1 X60.000 Y79.600 E84.72876 F2700
+G1 X58.079 Y79.506 E84.79224 F2700
+G1 X56.176 Y79.223 E84.85571 F2700
+G1 X54.310 Y78.756 E84.91919 F2700
+G1 X52.499 Y78.108 E84.98266 F2700
+G1 X50.761 Y77.286 E85.04613 F2700
+G1 X49.111 Y76.297 E85.10961 F2700
+G1 X47.566 Y75.151 E85.17308 F2700
+G1 X46.141 Y73.859 E85.23656 F2700
+G1 X44.849 Y72.434 E85.30003 F2700
+G1 X43.703 Y70.889 E85.36350 F2700
+G1 X42.714 Y69.239 E85.42698 F2700
+G1 X41.892 Y67.501 E85.49045 F2700
+G1 X41.244 Y65.690 E85.55393 F2700
+G1 X40.777 Y63.824 E85.61740 F2700
+G1 X40.494 Y61.921 E85.68087 F2700
+G1 X40.400 Y60.000 E85.74435 F2700
+G1 X40.494 Y58.079 E85.80782 F2700
+G1 X40.777 Y56.176 E85.87130 F2700
+G1 X41.244 Y54.310 E85.93477 F2700
+G1 X41.892 Y52.499 E85.99824 F2700
+G1 X42.714 Y50.761 E86.06172 F2700
+G1 X43.703 Y49.111 E86.12519 F2700
+G1 X44.849 Y47.566 E86.18866 F2700
+G1 X46.141 Y46.141 E86.25214 F2700
+G1 X47.566 Y44.849 E86.31561 F2700
+G1 X49.111 Y43.703 E86.37909 F2700
+G1 X50.761 Y42.714 E86.44256 F2700
+G1 X52.499 Y41.892 E86.50603 F2700
+G1 X54.310 Y41.244 E86.56951 F2700
+G1 X56.176 Y40.777 E86.63298 F2700
+G1 X58.079 Y40.494 E86.69646 F2700
+G1 X60.000 Y40.400 E86.75993 F2700
+G1 X61.921 Y40.494 E86.82340 F2700
+G1 X63.824 Y40.777 E86.88688 F2700
+G1 X65.690 Y41.244 E86.95035 F2700
+G1 X67.501 Y41.892 E87.01383 F2700
+G1 X69.239 Y42.714 E87.07730 F2700
+G1 X70.889 Y43.703 E87.14077 F2700
+G1 X72.434 Y44.849 E87.20425 F2700
+G1 X73.859 Y46.141 E87.26772 F2700
+G1 X75.151 Y47.566 E87.33120 F2700
+G1 X76.297 Y49.111 E87.39467 F2700
+G1 X77.286 Y50.761 E87.45814 F2700
+G1 X78.108 Y52.499 E87.52162 F2700
+G1 X78.756 Y54.310 E87.58509 F2700
+G1 X79.223 Y56.176 E87.64857 F2700
+G1 X79.506 Y58.079 E87.71204 F2700
+G1 X79.600 Y60.000 E87.77551 F2700
+G1 E85.77551 F2400
+G1 X42.000 Y50.000 F9000
+G1 E87.77551 F2400
+G1 X43.845 Y50.000 E87.79551
+G1 X76.155 Y50.000 E88.86178 F4200
+G1 X76.624 Y50.800 E88.88178
+G1 X43.376 Y50.800 E89.97897 F4200
+G1 X42.958 Y51.600 E89.99897
+G1 X77.042 Y51.600 E91.12376 F4200
+G1 X77.414 Y52.400 E91.14376
+G1 X42.586 Y52.400 E92.29307 F4200
+G1 X42.259 Y53.200 E92.31307
+G1 X77.741 Y53.200 E93.48400 F4200
+G1 X78.028 Y54.000 E93.50400
+G1 X41.972 Y54.000 E94.69384 F4200
+G1 X41.725 Y54.800 E94.71384
+G1 X78.275 Y54.800 E95.91996 F4200
+G1 X78.484 Y55.600 E95.93996
+G1 X41.516 Y55.600 E97.15987 F4200
+G1 X41.344 Y56.400 E97.17987
+G1 X78.656 Y56.400 E98.41115 F4200
+G1 X78.793 Y57.200 E98.43115
+G1 X41.207 Y57.200 E99.67146 F4200
+G1 X41.106 Y58.000 E99.69146
+G1 X78.894 Y58.000 E100.93850 F4200
+G1 X78.962 Y58.800 E100.95850
+G1 X41.038 Y58.800 E102.20999 F4200
+G1 X41.004 Y59.600 E102.22999
+G1 X78.996 Y59.600 E103.48371 F4200
+G1 X78.996 Y60.400 E103.50371
+G1 X41.004 Y60.400 E104.75744 F4200
+G1 X41.038 Y61.200 E104.77744
+G1 X78.962 Y61.200 E106.02893 F4200
+G1 X78.894 Y62.000 E106.04893
+G1 X41.106 Y62.000 E107.29597 F4200
+G1 X41.207 Y62.800 E107.31597
+G1 X78.793 Y62.800 E108.55627 F4200
+G1 X78.656 Y63.600 E108.57627
+G1 X41.344 Y63.600 E109.80756 F4200
+G1 X41.516 Y64.400 E109.82756
+G1 X78.484 Y64.400 E111.04747 F4200
+G1 X78.275 Y65.200 E111.06747
+G1 X41.725 Y65.200 E112.27359 F4200
+G1 X41.972 Y66.000 E112.29359
+G1 X78.028 Y66.000 E113.48342 F4200
+G1 X77.741 Y66.800 E113.50342
+G1 X42.259 Y66.800 E114.67436 F4200
+G1 X42.586 Y67.600 E114.69436
+G1 X77.414 Y67.600 E115.84367 F4200
+G1 X77.042 Y68.400 E115.86367
+G1 X42.958 Y68.400 E116.98846 F4200
+G1 X43.376 Y69.200 E117.00846
+G1 X76.624 Y69.200 E118.10565 F4200
+G1 X76.155 Y70.000 E118.12565
+G1 X43.845 Y70.000 E119.19192 F4200
+G1 X60.300 Y60.000 E119.19592 F1200
+G1 X60.162 Y60.252 E119.19992 F1200
+G1 X59.875 Y60.273 E119.20392 F1200
+G1 X59.703 Y60.042 E119.20792 F1200
+G1 X59.804 Y59.773 E119.21192 F1200
+G1 X60.085 Y59.712 E119.21592 F1200
+G1 X60.288 Y59.916 E119.21992 F1200
+G1 X60.226 Y60.197 E119.22392 F1200
+G1 X59.956 Y60.297 E119.22792 F1200
+G1 X59.727 Y60.124 E119.23192 F1200
+G1 X59.748 Y59.837 E119.23592 F1200
+G1 X60.001 Y59.700 E119.23992 F1200
+G1 X60.253 Y59.839 E119.24392 F1200
+G1 X60.272 Y60.126 E119.24792 F1200
+G1 X60.041 Y60.297 E119.25192 F1200
+G1 X59.772 Y60.195 E119.25592 F1200
+G1 X59.713 Y59.914 E119.25992 F1200
+G1 X59.917 Y59.712 E119.26392 F1200
+G1 X60.198 Y59.775 E119.26792 F1200
+G1 X60.297 Y60.045 E119.27192 F1200
+G1 X60.122 Y60.274 E119.27592 F1200
+G1 X59.836 Y60.251 E119.27992 F1200
+G1 X59.700 Y59.997 E119.28392 F1200
+G1 X59.840 Y59.746 E119.28792 F1200
+G1 X60.127 Y59.728 E119.29192 F1200
+G1 X60.297 Y59.960 E119.29592 F1200
+G1 X60.194 Y60.229 E119.29992 F1200
+G1 X59.912 Y60.287 E119.30392 F1200
+G1 X59.711 Y60.081 E119.30792 F1200
+G1 X59.776 Y59.801 E119.31192 F1200
+G1 X60.046 Y59.704 E119.31592 F1200
+G1 X60.274 Y59.879 E119.31992 F1200
+G1 X60.250 Y60.165 E119.32392 F1200
+G1 X59.996 Y60.300 E119.32792 F1200
+G1 X59.745 Y60.159 E119.33192 F1200
+G1 X59.729 Y59.872 E119.33592 F1200
+G1 X59.962 Y59.702 E119.33992 F1200
+G1 X60.230 Y59.807 E119.34392 F1200
+G1 X60.287 Y60.089 E119.34792 F1200
+G1 X60.080 Y60.289 E119.35192 F1200
+G1 Z5 F600
+M962 P0
+M962 S2000 R7
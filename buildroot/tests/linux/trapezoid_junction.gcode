@@ -0,0 +1,16 @@
+; Trapezoid exit speed: with the classic jerk a slow move followed by a
+; faster one within the jerk enters the fast one at its safe speed, above
+; the nominal speed of the slow one. The slow block must still end at its
+; nominal rate, as the fixed point generator does (M962 P1).
+;
+; enable: FIXED_POINT_TRAPEZOID
+; expect: ^Blocks:[1-9][0-9]* Mismatch:0 Max diff steps:[01] rate:[01]$
+; expect: ^ X:40\.000 Y:0\.000 Z:2\.000
+G92 X0 Y0 Z0
+M962 P1
+G1 X2 F60
+G1 X40 F480
+G1 Z1 F30
+G1 Z2 F240
+M962 P0
+M114
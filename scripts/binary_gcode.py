@@ -0,0 +1,89 @@
+#!/usr/bin/python3
+
+# Encode G-code into MK4duo binary protocol frames (BINARY_PROTOCOL, M880).
+#
+# usage: binary_gcode.py <in.gcode> <out.bin>
+#
+# The output starts with "M880 S1" in ASCII, then every line is one frame:
+# G0-G3 with numeric E F I J P R S X Y Z parameters become packed float
+# records, any other line is sent as an ASCII frame.
+#
+# Frame: 0xB5, sequence, type (0-3 G0-G3, 0x7F ASCII), payload length,
+#        payload, CRC16 CCITT (init 0xFFFF) of sequence..payload, little endian.
+# Motion payload: uint16 mask (bit 0-9 = E F I J P R S X Y Z), one float32 per bit.
+#
+# A streaming host must wait for the "BINARY_PROTOCOL:1" reply of M880 before
+# the first frame, then for "ok" per frame like for ASCII lines and,
+# on "rs <n>", send again starting from the frame with sequence n.
+# A frame that stops arriving for 100 ms is dropped and answered with "rs".
+
+import re
+import struct
+import sys
+
+SYNC = 0xB5
+TYPE_ASCII = 0x7F
+LETTERS = 'EFIJPRSXYZ'
+MOTION = re.compile(r'^G0*([0-3])(?![0-9.])((?:\s*[A-Z]\s*[-+]?(?:\d+\.?\d*|\.\d+))*)\s*$')
+PARAM = re.compile(r'([A-Z])\s*([-+]?(?:\d+\.?\d*|\.\d+))')
+
+
+def crc16(data):
+  crc = 0xFFFF
+  for b in data:
+    crc ^= b << 8
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+      crc &= 0xFFFF
+  return crc
+
+
+def frame(seq, ftype, payload):
+  body = bytes([seq & 0xFF, ftype, len(payload)]) + payload
+  return bytes([SYNC]) + body + struct.pack('<H', crc16(body))
+
+
+def encode_line(line):
+  """Return (type, payload) for a stripped G-code line"""
+  m = MOTION.match(line)
+  if m:
+    values = {}
+    for letter, value in PARAM.findall(m.group(2)):
+      if letter not in LETTERS:
+        break
+      values[letter] = float(value)
+    else:
+      mask = 0
+      payload = b''
+      for bit, letter in enumerate(LETTERS):
+        if letter in values:
+          mask |= 1 << bit
+          payload += struct.pack('<f', values[letter])
+      return int(m.group(1)), struct.pack('<H', mask) + payload
+  return TYPE_ASCII, line.encode('ascii')
+
+
+def main():
+  if len(sys.argv) != 3:
+    sys.exit('usage: binary_gcode.py <in.gcode> <out.bin>')
+
+  out = bytearray(b'M880 S1\n')
+  seq, ascii_size = 0, 0
+  with open(sys.argv[1]) as f:
+    for raw in f:
+      ascii_size += len(raw)
+      line = raw.split(';', 1)[0].strip()
+      if not line:
+        continue
+      ftype, payload = encode_line(line)
+      out += frame(seq, ftype, payload)
+      seq += 1
+
+  with open(sys.argv[2], 'wb') as f:
+    f.write(out)
+
+  sys.stderr.write('%d frames, %d bytes (ASCII %d bytes)\n' % (seq, len(out), ascii_size))
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,128 @@
+#!/usr/bin/python3
+
+# Rebuild per-axis velocity and acceleration profiles from a MK4duo step timeline.
+#
+# Enable STEP_TIMELINE in Configuration_Feature.h, then record with
+#   M960 S1   (serial, capture the host log)   or   M960 S2   (SD file timeline.log)
+# and stop with M960 S0.
+#
+# usage: steptimeline.py <log> [-o profile.csv] [--plot]
+#
+# Log lines (all other lines are ignored, so a raw host log can be used):
+#   TL:H <timer rate> <A steps/mm*1000> <B steps/mm*1000> <C steps/mm*1000> <E steps/mm*1000>
+#   TL:B <clock> <step event count> <accelerate until> <decelerate after> <oversampling>
+#   TL:N <direction bits> <steps A> <steps B> <steps C> <steps E>
+#   TL:S <clock> <step events completed> <interval> <steps per isr>
+#   TL:D <dropped records>
+#
+# The clock is the sum of the stepper ISR intervals in timer ticks, so the time
+# base stays correct even when records are dropped because the ring was full.
+
+import argparse
+import csv
+import sys
+
+AXES = ('A', 'B', 'C', 'E')
+
+
+def parse(lines):
+  rate, spmm = None, None
+  block, samples, dropped = None, [], 0
+  clock_base, last_clock = 0, None
+
+  def unwrap(clock):
+    nonlocal clock_base, last_clock
+    if last_clock is not None and clock < last_clock:
+      clock_base += 1 << 32
+    last_clock = clock
+    return clock_base + clock
+
+  for line in lines:
+    pos = line.find('TL:')
+    if pos < 0:
+      continue
+    f = line[pos + 3:].split()
+    if not f:
+      continue
+    kind, v = f[0], [int(x) for x in f[1:]]
+    if kind == 'H':
+      rate, spmm = v[0], [x / 1000.0 for x in v[1:5]]
+      block, clock_base, last_clock = None, 0, None
+    elif kind == 'B':
+      block = {'clock': unwrap(v[0]), 'events': v[1], 'accel_until': v[2],
+               'decel_after': v[3], 'oversampling': v[4], 'steps': None}
+    elif kind == 'N' and block is not None:
+      dirs = v[0]
+      block['steps'] = [-s if dirs & (1 << i) else s for i, s in enumerate(v[1:5])]
+    elif kind == 'S' and block is not None and block['steps'] is not None:
+      clock, completed, interval, spi = unwrap(v[0]), v[1], v[2], v[3]
+      samples.append((clock, completed, interval, spi, block))
+    elif kind == 'D':
+      dropped = v[0]
+
+  if rate is None:
+    sys.exit('No TL:H header found, start the recording with M960')
+  return rate, spmm, samples, dropped
+
+
+def profile(rate, spmm, samples):
+  rows, prev = [], None
+  for clock, completed, interval, spi, block in samples:
+    t = clock / float(rate)
+    event_rate = spi * float(rate) / interval if interval else 0.0
+    vel = [event_rate * s / block['events'] / spmm[i] if block['events'] and spmm[i] else 0.0
+           for i, s in enumerate(block['steps'])]
+    if prev is not None and t > prev[0]:
+      acc = [(vel[i] - prev[1][i]) / (t - prev[0]) for i in range(len(AXES))]
+    else:
+      acc = [0.0] * len(AXES)
+    if completed <= block['accel_until']:
+      phase = 'accel'
+    elif completed > block['decel_after']:
+      phase = 'decel'
+    else:
+      phase = 'cruise'
+    rows.append([t, completed, block['events'], phase, spi, interval] + vel + acc)
+    prev = (t, vel)
+  return rows
+
+
+def main():
+  ap = argparse.ArgumentParser(description='Rebuild velocity and acceleration profiles from a MK4duo step timeline')
+  ap.add_argument('log', help='serial capture or timeline.log from SD')
+  ap.add_argument('-o', '--output', help='CSV output file (default stdout)')
+  ap.add_argument('--plot', action='store_true', help='plot the profiles with matplotlib')
+  args = ap.parse_args()
+
+  with open(args.log, errors='replace') as f:
+    rate, spmm, samples, dropped = parse(f)
+
+  rows = profile(rate, spmm, samples)
+  header = ['time_s', 'events_completed', 'event_count', 'phase', 'steps_per_isr', 'interval'] \
+         + ['v%s_mm_s' % a for a in AXES] + ['a%s_mm_s2' % a for a in AXES]
+
+  out = open(args.output, 'w', newline='') if args.output else sys.stdout
+  w = csv.writer(out)
+  w.writerow(header)
+  w.writerows(rows)
+  if args.output:
+    out.close()
+
+  sys.stderr.write('%d samples, %d dropped records\n' % (len(rows), dropped))
+
+  if args.plot:
+    import matplotlib.pyplot as plt
+    t = [r[0] for r in rows]
+    fig, (pv, pa) = plt.subplots(2, 1, sharex=True)
+    for i, a in enumerate(AXES):
+      pv.plot(t, [r[6 + i] for r in rows], label=a)
+      pa.plot(t, [r[10 + i] for r in rows], label=a)
+    pv.set_ylabel('mm/s')
+    pa.set_ylabel('mm/s²')
+    pa.set_xlabel('s')
+    pv.legend()
+    plt.show()
+
+
+if __name__ == '__main__':
+  main()